@@ -28,6 +28,7 @@
 #include <bitcoin/system/version.hpp>
 #include <bitcoin/system/warnings.hpp>
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_view.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
@@ -78,6 +79,7 @@
 #include <bitcoin/system/crypto/pseudo_random.hpp>
 #include <bitcoin/system/crypto/ring_signature.hpp>
 #include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/crypto/signature_cache.hpp>
 #include <bitcoin/system/data/array_cast.hpp>
 #include <bitcoin/system/data/byte_cast.hpp>
 #include <bitcoin/system/data/collection.hpp>
@@ -125,6 +127,7 @@
 #include <bitcoin/system/hash/rmd/rmd128.hpp>
 #include <bitcoin/system/hash/rmd/rmd160.hpp>
 #include <bitcoin/system/hash/sha/algorithm.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
 #include <bitcoin/system/hash/sha/sha.hpp>
 #include <bitcoin/system/hash/sha/sha160.hpp>
 #include <bitcoin/system/hash/sha/sha256.hpp>
@@ -133,6 +136,7 @@
 #include <bitcoin/system/intrinsics/haves.hpp>
 #include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/intrinsics/rotate.hpp>
+#include <bitcoin/system/intrinsics/wide.hpp>
 #include <bitcoin/system/intrinsics/arm/arm.hpp>
 #include <bitcoin/system/intrinsics/arm/functional.hpp>
 #include <bitcoin/system/intrinsics/arm/sha.hpp>
@@ -146,6 +150,7 @@
 #include <bitcoin/system/machine/interpreter.hpp>
 #include <bitcoin/system/machine/machine.hpp>
 #include <bitcoin/system/machine/number.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/machine/stack.hpp>
 #include <bitcoin/system/math/addition.hpp>
@@ -155,6 +160,7 @@
 #include <bitcoin/system/math/cast.hpp>
 #include <bitcoin/system/math/division.hpp>
 #include <bitcoin/system/math/functional.hpp>
+#include <bitcoin/system/math/limbs.hpp>
 #include <bitcoin/system/math/limits.hpp>
 #include <bitcoin/system/math/logarithm.hpp>
 #include <bitcoin/system/math/math.hpp>
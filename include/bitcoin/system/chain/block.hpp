@@ -102,6 +102,12 @@ public:
         uint64_t initial_subsidy) const NOEXCEPT;
     code connect(const context& state) const NOEXCEPT;
 
+    /// Concurrent connect evaluates transactions on tasks posted to the
+    /// caller-owned pool (the caller also evaluates), batching signature
+    /// verification, returning the first failing transaction code.
+    code connect(const context& state,
+        boost::asio::thread_pool& pool) const NOEXCEPT;
+
 protected:
     block(const chain::header::cptr& header,
         const chain::transactions_cptr& txs, bool valid) NOEXCEPT;
@@ -160,7 +166,11 @@ private:
     // delegated
     code check_transactions() const NOEXCEPT;
     code accept_transactions(const context& state) const NOEXCEPT;
+    bool connect_deferred(const context& state,
+        boost::asio::thread_pool& pool) const NOEXCEPT;
     code connect_transactions(const context& state) const NOEXCEPT;
+    code connect_transactions(const context& state,
+        boost::asio::thread_pool& pool) const NOEXCEPT;
 
     // Block should be stored as shared (adds 16 bytes).
     // copy: 4 * 64 + 1 = 33 bytes (vs. 16 when shared).
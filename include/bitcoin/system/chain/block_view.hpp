@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CHAIN_BLOCK_VIEW_HPP
+#define LIBBITCOIN_SYSTEM_CHAIN_BLOCK_VIEW_HPP
+
+#include <vector>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+class block_view;
+
+/// Views reference the serialized bytes of a block_view (zero copy). A view
+/// is valid only for the lifetime (and location) of its block_view, which
+/// must not be moved while its views are in use.
+
+/// Non-owning view of a serialized input.
+class BC_API input_view
+{
+public:
+    /// Native properties.
+    hash_digest previous_hash() const NOEXCEPT;
+    uint32_t previous_index() const NOEXCEPT;
+    const data_slice& script() const NOEXCEPT;
+    uint32_t sequence() const NOEXCEPT;
+
+    /// Witness elements (empty if transaction is not segregated).
+    size_t witness_count() const NOEXCEPT;
+    const data_slice& witness_at(size_t index) const NOEXCEPT;
+
+    /// Computed properties.
+    chain::point point() const NOEXCEPT;
+    bool is_null() const NOEXCEPT;
+
+protected:
+    friend class transaction_view;
+    input_view(const block_view& block, size_t index) NOEXCEPT;
+
+private:
+    const block_view* block_;
+    size_t index_;
+};
+
+/// Non-owning view of a serialized output.
+class BC_API output_view
+{
+public:
+    /// Native properties.
+    uint64_t value() const NOEXCEPT;
+    const data_slice& script() const NOEXCEPT;
+
+protected:
+    friend class transaction_view;
+    output_view(const block_view& block, size_t index) NOEXCEPT;
+
+private:
+    const block_view* block_;
+    size_t index_;
+};
+
+/// Non-owning view of a serialized transaction.
+class BC_API transaction_view
+{
+public:
+    /// Native properties.
+    uint32_t version() const NOEXCEPT;
+    size_t input_count() const NOEXCEPT;
+    input_view input_at(size_t index) const NOEXCEPT;
+    size_t output_count() const NOEXCEPT;
+    output_view output_at(size_t index) const NOEXCEPT;
+    uint32_t locktime() const NOEXCEPT;
+
+    /// Computed properties.
+    hash_digest hash(bool witness) const NOEXCEPT;
+    bool is_coinbase() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+    size_t serialized_size(bool witness) const NOEXCEPT;
+
+    /// Serialized bytes (with witness if segregated) referenced by the view.
+    const data_slice& data() const NOEXCEPT;
+
+    /// Deserialize the referenced bytes into a transaction (allocating).
+    chain::transaction to_transaction(bool witness) const NOEXCEPT;
+
+protected:
+    friend class block_view;
+    transaction_view(const block_view& block, size_t index) NOEXCEPT;
+
+private:
+    const block_view* block_;
+    size_t index_;
+};
+
+/// Block parsed without copying scripts or witnesses. All views reference
+/// the source buffer, which is either retained (chunk_cptr) or borrowed
+/// (data_slice). Parsing allocates only the flat record tables, a handful
+/// of allocations per block as opposed to one or more per object.
+class BC_API block_view
+{
+public:
+    DEFAULT_COPY_MOVE_DESTRUCT(block_view);
+
+    /// Default block_view is an invalid object.
+    block_view() NOEXCEPT;
+
+    /// The buffer is retained by the view.
+    block_view(const chunk_cptr& data) NOEXCEPT;
+
+    /// The buffer must remain valid for the lifetime of the view.
+    block_view(const data_slice& data) NOEXCEPT;
+
+    // Properties.
+    // ------------------------------------------------------------------------
+
+    /// Native properties.
+    bool is_valid() const NOEXCEPT;
+    const chain::header& header() const NOEXCEPT;
+    size_t transaction_count() const NOEXCEPT;
+    transaction_view transaction_at(size_t index) const NOEXCEPT;
+    hashes transaction_hashes(bool witness) const NOEXCEPT;
+
+    /// Computed properties.
+    hash_digest hash() const NOEXCEPT;
+    bool is_segregated() const NOEXCEPT;
+    size_t serialized_size(bool witness) const NOEXCEPT;
+
+    /// Serialized bytes referenced by the view.
+    const data_slice& data() const NOEXCEPT;
+
+    /// Deserialize the referenced bytes into a block (allocating).
+    chain::block to_block(bool witness) const NOEXCEPT;
+
+protected:
+    friend class input_view;
+    friend class output_view;
+    friend class transaction_view;
+
+    struct input_record
+    {
+        const uint8_t* previous_hash;
+        uint32_t previous_index;
+        data_slice script;
+        uint32_t sequence;
+        size_t witness_offset;
+        size_t witness_count;
+    };
+
+    struct output_record
+    {
+        uint64_t value;
+        data_slice script;
+    };
+
+    struct transaction_record
+    {
+        data_slice data;
+        uint32_t version;
+        uint32_t locktime;
+        size_t input_offset;
+        size_t input_count;
+        size_t output_offset;
+        size_t output_count;
+
+        /// Offset of witnesses from start of data (segregated only).
+        size_t witness_start;
+        bool segregated;
+    };
+
+private:
+    bool parse(reader& source) NOEXCEPT;
+    bool parse_transaction(reader& source) NOEXCEPT;
+
+    // Null when the buffer is borrowed.
+    chunk_cptr buffer_;
+    data_slice data_;
+    chain::header header_;
+    std::vector<transaction_record> transactions_;
+    std::vector<input_record> inputs_;
+    std::vector<output_record> outputs_;
+    std::vector<data_slice> witnesses_;
+    bool valid_;
+};
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
+
+#endif
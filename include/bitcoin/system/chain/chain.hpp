@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_CHAIN_CHAIN_HPP
 
 #include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/block_view.hpp>
 #include <bitcoin/system/chain/chain.hpp>
 #include <bitcoin/system/chain/chain_state.hpp>
 #include <bitcoin/system/chain/checkpoint.hpp>
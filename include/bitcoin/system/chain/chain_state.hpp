@@ -24,6 +24,7 @@
 #include <bitcoin/system/chain/checkpoint.hpp>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/forks.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/math/math.hpp>
 
@@ -211,10 +212,28 @@ protected:
         uint32_t maximum_transaction_version;
     };
 
+    /// Counts of the version sample at or above each bip34-based version.
+    struct tallies
+    {
+        size_t bip34;
+        size_t bip66;
+        size_t bip65;
+    };
+
+    /// The most recent timestamps of the sample, ordered by value.
+    struct sample
+    {
+        size_t size;
+        std_array<uint32_t, median_time_past_interval> times;
+    };
+
     static activations activation(const data& values, uint32_t forks,
         const system::settings& settings) NOEXCEPT;
+    static activations activation(const data& values, const tallies& counts,
+        uint32_t forks, const system::settings& settings) NOEXCEPT;
     static uint32_t median_time_past(const data& values,
         uint32_t forks) NOEXCEPT;
+    static uint32_t median_time_past(const sample& times) NOEXCEPT;
     static uint32_t work_required(const data& values, uint32_t forks,
         const system::settings& settings) NOEXCEPT;
 
@@ -239,6 +258,14 @@ private:
     static data to_header(const chain_state& parent, const header& header,
         const system::settings& settings) NOEXCEPT;
 
+    static tallies to_tallies(const data& values,
+        const system::settings& settings) NOEXCEPT;
+    static tallies roll_tallies(const chain_state& parent, const data& values,
+        const system::settings& settings) NOEXCEPT;
+    static sample to_sample(const data& values) NOEXCEPT;
+    static sample roll_sample(const chain_state& parent,
+        const data& values) NOEXCEPT;
+
     static uint32_t work_required_retarget(const data& values, uint32_t forks,
         uint32_t proof_of_work_limit, uint32_t minimum_timespan,
         uint32_t maximum_timespan, uint32_t retargeting_interval_seconds) NOEXCEPT;
@@ -261,6 +288,11 @@ private:
     // Checkpoints do not affect the data that is collected or promoted.
     const checkpoints& checkpoints_;
 
+    // These are rolled forward from the parent state by one height, so that
+    // promotion does not rescan the version and timestamp samples.
+    const tallies tallies_;
+    const sample sample_;
+
     // These are computed on construct from sample and checkpoints.
     const activations active_;
     const uint32_t work_required_;
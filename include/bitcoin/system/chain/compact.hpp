@@ -42,7 +42,9 @@ struct compact
 public:
     /// A zero value implies an invalid (including zero) parameter.
     /// Non-minimal exponent encoding allowed only for mantissa sign bug.
-    static constexpr span_type expand(small_type exponential) NOEXCEPT;
+    /// Expand to limbs256 to avoid uint256_t on hot paths (proof of work).
+    template <typename Number = span_type>
+    static constexpr Number expand(small_type exponential) NOEXCEPT;
 
     /// (m * 256^e) bit-encoded as [0eeeeee][mmmmmmmm][mmmmmmmm][mmmmmmmm].
     /// Uses non-minimal exponent encoding to avoid mantissa sign (bug).
@@ -30,6 +30,10 @@ namespace chain {
 /// Comments from: bitcoin.org/en/developer-guide#standard-transactions
 enum coverage : uint8_t
 {
+    /// Taproot only (bip341), signs as hash_all but is committed as zero.
+    /// This is implied by a 64 byte schnorr signature (no sighash byte).
+    hash_default = 0,
+
     /// The default, signs all the inputs and outputs, protecting everything
     /// except the signature scripts against modification.
     hash_all = bit_right<uint8_t>(0),
@@ -133,7 +133,11 @@ enum forks : uint32_t
     /// Reduces threshold segregated witness signaling (soft fork, feature).
     bip91_rule = bit_right<uint32_t>(26),
 
-    /// TODO: taproot rules.
+    /// Schnorr signatures and taproot key/script spends (soft fork, feature).
+    bip341_rule = bit_right<uint32_t>(27),
+
+    /// Tapscript validation of taproot script spends (soft fork, feature).
+    bip342_rule = bit_right<uint32_t>(28),
 
     /// Rules that use bip34-based activation.
     bip34_activations =
@@ -160,7 +164,11 @@ enum forks : uint32_t
     bip9_bit4_group =
         forks::bip91_rule,
 
-    /// TODO: rules that use taproot-style activation.
+    /// Rules active for all blocks (after bip141), excepting one mainnet
+    /// block that violates them (taproot buried deployment).
+    taproot_group =
+        forks::bip341_rule |
+        forks::bip342_rule,
 
     /// Mask to set all rule bits.
     all_rules = bit_all<uint32_t>
@@ -83,6 +83,20 @@ constexpr uint32_t witness_head = 0xaa21a9ed;
 constexpr uint8_t witness_marker = 0x00;
 constexpr uint8_t witness_enabled = 0x01;
 
+// Taproot consensus constants (bip341/bip342).
+// ----------------------------------------------------------------------------
+
+constexpr uint8_t taproot_annex = 0x50;
+constexpr uint8_t taproot_leaf_mask = 0xfe;
+constexpr uint8_t tapscript_leaf_version = 0xc0;
+constexpr size_t taproot_control_base_size = 33;
+constexpr size_t taproot_control_node_size = 32;
+constexpr size_t taproot_max_path = 128;
+constexpr size_t taproot_signature_size = 64;
+constexpr int64_t tapscript_sigops_cost = 50;
+constexpr int64_t tapscript_budget_offset = 50;
+constexpr uint32_t tapscript_no_separator = max_uint32;
+
 // Policy constants.
 // ----------------------------------------------------------------------------
 
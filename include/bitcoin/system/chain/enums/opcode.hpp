@@ -232,7 +232,7 @@ enum class opcode : uint8_t
     // These are enumerated to provide explicit deserialization of byte opcode.
     // is_reserved [unnamed]
 
-    reserved_186 = 186,     // To be subsumed by bip342 (tapscript).
+    reserved_186 = 186,     // op_checksigadd in tapscript (bip342).
     reserved_187 = 187,
     reserved_188 = 188,
     reserved_189 = 189,
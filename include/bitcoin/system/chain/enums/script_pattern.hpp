@@ -68,6 +68,18 @@ enum class script_pattern
     /// Witness coinbase reserved value [BIP141].
     witness_reservation,
 
+    /// Pay to Witness Public Key Hash [P2WPKH/BIP141]
+    /// Pubkey script: OP_0 <PubKeyHash>
+    pay_witness_key_hash,
+
+    /// Pay to Witness Script Hash [P2WSH/BIP141]
+    /// Pubkey script: OP_0 <Sha256(witnessScript)>
+    pay_witness_script_hash,
+
+    /// Pay to Taproot [P2TR/BIP341] (classification only, not validated)
+    /// Pubkey script: OP_1 <TweakedPubKey>
+    pay_taproot,
+
     /// The script may be valid but does not conform to the common templates.
     /// Such scripts are always accepted if they are mined into blocks, but
     /// transactions with uncommon scripts may not be forwarded by peers.
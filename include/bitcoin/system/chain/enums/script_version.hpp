@@ -31,7 +31,10 @@ enum class script_version
     /// Defined by bip141. 
     zero,
 
-    /// All reserved script versions (1..16).
+    /// Defined by bip341 (version 1 with a 32 byte program).
+    taproot,
+
+    /// All reserved script versions (1..16), excluding taproot.
     reserved,
 
     /// All unversioned scripts.
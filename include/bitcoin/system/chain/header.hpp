@@ -100,12 +100,28 @@ public:
     hash_digest hash() const NOEXCEPT;
     uint256_t difficulty() const NOEXCEPT;
 
+    /// Double hash a set of headers, vectorized across headers (as available).
+    static hashes to_hashes(const std::vector<cptr>& headers) NOEXCEPT;
+
     // Validation.
     // ------------------------------------------------------------------------
 
     code check(uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
         bool scrypt=false) const NOEXCEPT;
 
+    /// Check a set of headers, returning the first failure (in order).
+    /// Scrypt proofs of work are hashed as a batch (vectorized).
+    static code check(const std::vector<header>& headers,
+        uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+        bool scrypt=false) NOEXCEPT;
+
+    /// As above, for a contiguous set of headers (e.g. a headers message),
+    /// where each must also link to its predecessor (the first to previous).
+    /// Header hashes are computed as a batch (vectorized).
+    static code check(const std::vector<cptr>& headers,
+        const hash_digest& previous, uint32_t timestamp_limit_seconds,
+        uint32_t proof_of_work_limit, bool scrypt=false) NOEXCEPT;
+
     code accept(const chain_state& state) const NOEXCEPT;
 
 protected:
@@ -121,6 +137,8 @@ protected:
 
     bool is_invalid_proof_of_work(uint32_t proof_of_work_limit,
         bool scrypt=false) const NOEXCEPT;
+    bool is_invalid_proof_of_work(uint32_t proof_of_work_limit,
+        const hash_digest& work_hash) const NOEXCEPT;
     bool is_invalid_timestamp(uint32_t timestamp_limit_seconds) const NOEXCEPT;
 
     // Accept (relative to chain_state).
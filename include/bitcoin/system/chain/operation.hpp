@@ -348,6 +348,47 @@ public:
         }
     }
 
+    /// opcode: [80, 98, 126..129, 131..134, 137..138, 141..142, 149..153,
+    /// 187..254]
+    /// ************************************************************************
+    /// CONSENSUS: Any of these codes in a tapscript cause unconditional script
+    /// success, prior to evaluation and without regard to conditionals. This
+    /// is a superset of the invalid and reserved codes (other than op_verif,
+    /// op_vernotif, op_return and reserved_255), redefinable by soft fork.
+    /// The reserved_186 code is excluded, as it is op_checksigadd (bip342).
+    /// ************************************************************************
+    static constexpr bool is_success(opcode code) NOEXCEPT
+    {
+        constexpr auto op_187 = opcode::reserved_187;
+        constexpr auto op_254 = opcode::reserved_254;
+
+        switch (code)
+        {
+            case opcode::reserved_80:
+            case opcode::op_ver:
+            case opcode::op_cat:
+            case opcode::op_substr:
+            case opcode::op_left:
+            case opcode::op_right:
+            case opcode::op_invert:
+            case opcode::op_and:
+            case opcode::op_or:
+            case opcode::op_xor:
+            case opcode::reserved_137:
+            case opcode::reserved_138:
+            case opcode::op_mul2:
+            case opcode::op_div2:
+            case opcode::op_mul:
+            case opcode::op_div:
+            case opcode::op_mod:
+            case opcode::op_lshift:
+            case opcode::op_rshift:
+                return true;
+            default:
+                return code >= op_187 && code <= op_254;
+        }
+    }
+
     // Constructors.
     // ------------------------------------------------------------------------
 
@@ -419,6 +460,7 @@ public:
     bool is_numeric() const NOEXCEPT;
     bool is_positive() const NOEXCEPT;
     bool is_reserved() const NOEXCEPT;
+    bool is_success() const NOEXCEPT;
     bool is_conditional() const NOEXCEPT;
     bool is_relaxed_push() const NOEXCEPT;
     bool is_minimal_push() const NOEXCEPT;
@@ -262,6 +262,15 @@ public:
             && ops[1].code() == opcode::push_size_32;
     }
 
+    // C++20 constexpr.
+    static inline bool is_pay_taproot_pattern(
+        const operations& ops) NOEXCEPT
+    {
+        return ops.size() == 2
+            && ops[0].code() == opcode::push_positive_1
+            && ops[1].code() == opcode::push_size_32;
+    }
+
     // C++20 constexpr.
     // The first push is based on wacky satoshi op_check_multisig behavior that
     // we must perpetuate, though it's appearance here is policy not consensus.
@@ -504,6 +513,14 @@ public:
     bool is_oversized() const NOEXCEPT;
     bool is_unspendable() const NOEXCEPT;
 
+    /// Precomputed properties (computed once on construct and assign).
+    bool is_roller() const NOEXCEPT;
+    bool is_push_only() const NOEXCEPT;
+
+    /// Common output template (p2pkh, p2sh, p2wpkh, p2wsh, p2tr), otherwise
+    /// non_standard. Use output_pattern() for full classification.
+    script_pattern common_pattern() const NOEXCEPT;
+
 protected:
     script(operations&& ops, bool valid, bool fails) NOEXCEPT;
     script(const operations& ops, bool valid, bool fails) NOEXCEPT;
@@ -513,6 +530,8 @@ private:
     static script from_string(const std::string& mnemonic) NOEXCEPT;
     static script from_data(reader& source, bool prefix) NOEXCEPT;
     static size_t op_count(reader& source) NOEXCEPT;
+    static script_pattern common_pattern(const operations& ops) NOEXCEPT;
+    void initialize_metadata() NOEXCEPT;
 
     // Script should be stored as shared.
     operations ops_;
@@ -520,7 +539,13 @@ private:
     // TODO: pack these flags.
     bool valid_;
     bool prefail_;
-    ////bool roller_{ false };
+
+    // Precomputed from ops_, avoiding repeated iteration in validation.
+    bool roller_;
+    bool push_only_;
+    script_pattern common_pattern_;
+    size_t sigops_;
+    size_t accurate_sigops_;
 
 public:
     using iterator = operations::const_iterator;
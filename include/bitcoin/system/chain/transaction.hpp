@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_HPP
 #define LIBBITCOIN_SYSTEM_CHAIN_TRANSACTION_HPP
 
+#include <atomic>
 #include <istream>
 #include <memory>
 #include <vector>
@@ -100,7 +101,11 @@ public:
     uint64_t fee() const NOEXCEPT;
     uint64_t claim() const NOEXCEPT;
     uint64_t value() const NOEXCEPT;
+
+    /// Both hashes are computed (from one serialization) and cached upon the
+    /// first call, thread safe.
     hash_digest hash(bool witness) const NOEXCEPT;
+    bool is_hashed() const NOEXCEPT;
     bool is_coinbase() const NOEXCEPT;
     bool is_segregated() const NOEXCEPT;
     size_t serialized_size(bool witness) const NOEXCEPT;
@@ -121,6 +126,14 @@ public:
         uint64_t value, uint8_t flags, script_version version,
         bool bip143) const NOEXCEPT;
 
+    /// Taproot signature hash (bip341), false if flags are undefined, if
+    /// hash_single has no corresponding output, or if missing prevouts.
+    /// A non-empty annex is committed, as is the tapscript extension (bip342)
+    /// if tapleaf is not null (with the position of the last codeseparator).
+    bool signature_hash(hash_digest& out, const input_iterator& input,
+        uint8_t flags, const data_slice& annex, const hash_digest* tapleaf,
+        uint32_t codeseparator) const NOEXCEPT;
+
     bool check_signature(const ec_signature& signature,
         const data_slice& public_key, const script& sub, uint32_t index,
         uint64_t value, uint8_t flags, script_version version,
@@ -143,6 +156,17 @@ public:
     code accept(const context& state) const NOEXCEPT;
     code connect(const context& state) const NOEXCEPT;
 
+    /// Concurrent connect evaluates input scripts on tasks posted to the
+    /// caller-owned pool (the caller also evaluates), returning the code of
+    /// the lowest failing input (same result as sequential connect).
+    code connect(const context& state,
+        boost::asio::thread_pool& pool) const NOEXCEPT;
+
+    /// Connect with signature verification deferred to checks (assumed
+    /// valid), success is conditional upon verification of all checks.
+    code connect(const context& state,
+        ec_signature_checks& checks) const NOEXCEPT;
+
 protected:
     transaction(uint32_t version, const chain::inputs_cptr& inputs,
         const chain::outputs_cptr& outputs, uint32_t locktime, bool segregated,
@@ -188,6 +212,13 @@ protected:
     bool is_unconfirmed_spend(size_t height) const NOEXCEPT;
     bool is_confirmed_double_spend(size_t height) const NOEXCEPT;
 
+    // Signature hash caching.
+    // ------------------------------------------------------------------------
+
+    /// Built by connect for large transactions with an unversioned spend, and
+    /// released upon connect completion (not thread safe).
+    void initialize_sighash_cache() const NOEXCEPT;
+    bool is_sighash_cached() const NOEXCEPT;
 
 private:
     static transaction from_data(reader& source, bool witness) NOEXCEPT;
@@ -207,9 +238,17 @@ private:
         const script& sub, uint8_t flags) const NOEXCEPT;
     hash_digest unversioned_signature_hash(const input_iterator& input,
         const script& sub, uint8_t flags) const NOEXCEPT;
+    hash_digest cached_signature_hash(const input_iterator& input,
+        const script& sub, uint8_t flags) const NOEXCEPT;
     hash_digest version_0_signature_hash(const input_iterator& input,
         const script& sub, uint64_t value, uint8_t flags,
         bool bip143) const NOEXCEPT;
+    bool is_taproot_spend() const NOEXCEPT;
+    bool is_unversioned_spend() const NOEXCEPT;
+
+    // delegated
+    code connect_input(const context& state, const input_iterator& input,
+        ec_signature_checks* checks) const NOEXCEPT;
 
     // Transaction should be stored as shared (adds 16 bytes).
     // copy: 5 * 64 + 2 = 41 bytes (vs. 16 when shared).
@@ -230,10 +269,49 @@ private:
         hash_digest sequences;
     } hash_cache;
 
+    // Taproot (bip341) single sha256 hashes, including spent prevouts.
+    typedef struct
+    {
+        hash_digest points;
+        hash_digest amounts;
+        hash_digest scripts;
+        hash_digest sequences;
+        hash_digest outputs;
+    } taproot_cache;
+
+    // Unversioned preimage segments, with sequences as committed by all and
+    // as zeroed by none/single, and the sha256 state at each block boundary.
+    typedef struct
+    {
+        data_chunk all;
+        data_chunk zeroed;
+        std_vector<sha256::state_t> all_states;
+        std_vector<sha256::state_t> zeroed_states;
+        data_chunk outputs;
+    } sighash_cache;
+
+    // Transaction hashes (txid and wtxid).
+    typedef struct
+    {
+        hash_digest nominal;
+        hash_digest witness;
+    } txid_cache;
+
     void initialize_hash_cache() const NOEXCEPT;
+    const txid_cache& hashes() const NOEXCEPT;
+    taproot_cache taproot_hashes() const NOEXCEPT;
 
     // Witness transaction hash caching.
     mutable std::unique_ptr<hash_cache> cache_;
+
+    // Taproot signature hash caching (taproot spends only).
+    mutable std::unique_ptr<taproot_cache> taproot_cache_;
+
+    // Unversioned signature hash caching (large legacy spends, connect only).
+    mutable std::unique_ptr<sighash_cache> sighash_cache_;
+
+    // Transaction hash caching, published once (owned).
+    mutable std::atomic<const txid_cache*> txid_cache_{};
 };
 
 typedef std::vector<transaction> transactions;
@@ -111,6 +111,14 @@ public:
         return stack.size() == one && stack.front()->size() == hash_size;
     }
 
+    // C++20: constexpr.
+    // The taproot annex is the last of two or more elements (bip341).
+    static inline bool is_annex_pattern(const chunk_cptrs& stack) NOEXCEPT
+    {
+        return stack.size() > one && !stack.back()->empty() &&
+            stack.back()->front() == taproot_annex;
+    }
+
     bool extract_sigop_script(script& out_script,
         const script& program_script) const NOEXCEPT;
     bool extract_script(script::cptr& out_script, chunk_cptrs_ptr& out_stack,
@@ -24,6 +24,7 @@
 
 #include <istream>
 #include <ostream>
+#include <vector>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/hash.hpp>
@@ -49,14 +50,26 @@ BC_API void construct(std::ostream& stream, const data_stack& items,
     uint8_t bits, const siphash_key& entropy,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
+// Golomb-coded set construction from item hashes
+// ----------------------------------------------------------------------------
+
+/// Order and remove duplicates from the siphash values of set items (in
+/// place), so that the set size is hashes.size() (distinct by hash value).
+BC_API void distinct_hashes(std::vector<uint64_t>& hashes) NOEXCEPT;
+
+/// Construct from ordered and distinct siphash values of the set items.
+BC_API void construct(std::ostream& stream,
+    const std::vector<uint64_t>& hashes, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT;
+
 // Single element match
 // ----------------------------------------------------------------------------
 
-BC_API bool match(const data_chunk& target, const data_chunk& compressed_set,
+BC_API bool match(const data_chunk& target, const data_slice& compressed_set,
     uint64_t set_size, const half_hash& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
-BC_API bool match(const data_chunk& target, const data_chunk& compressed_set,
+BC_API bool match(const data_chunk& target, const data_slice& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
@@ -71,11 +84,11 @@ BC_API bool match(const data_chunk& target, std::istream& compressed_set,
 // Intersection match
 // ----------------------------------------------------------------------------
 
-BC_API bool match(const data_stack& targets, const data_chunk& compressed_set,
+BC_API bool match(const data_stack& targets, const data_slice& compressed_set,
     uint64_t set_size, const half_hash& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
-BC_API bool match(const data_stack& targets, const data_chunk& compressed_set,
+BC_API bool match(const data_stack& targets, const data_slice& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
@@ -87,6 +100,21 @@ BC_API bool match(const data_stack& targets, std::istream& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT;
 
+// Multiple element match
+// ----------------------------------------------------------------------------
+
+/// Membership of each target in the set (subject to false positives).
+/// Targets are merged with the set in one pass of the decoder.
+BC_API std::vector<bool> matches(const data_stack& targets,
+    const data_slice& compressed_set, uint64_t set_size,
+    const half_hash& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT;
+
+BC_API std::vector<bool> matches(const data_stack& targets,
+    const data_slice& compressed_set, uint64_t set_size,
+    const siphash_key& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT;
+
 } // namespace golomb
 } // namespace system
 } // namespace libbitcoin
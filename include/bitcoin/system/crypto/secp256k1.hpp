@@ -46,6 +46,10 @@ static constexpr size_t ec_uncompressed_size = 65;
 typedef data_array<ec_uncompressed_size> ec_uncompressed;
 typedef std::vector<ec_uncompressed> uncompressed_list;
 
+/// X-only public key (bip340):
+static constexpr size_t ec_xonly_size = 32;
+typedef data_array<ec_xonly_size> ec_xonly;
+
 // Parsed ECDSA signature:
 static constexpr size_t ec_signature_size = 64;
 typedef data_array<ec_signature_size> ec_signature;
@@ -92,6 +96,11 @@ BC_API bool ec_add(ec_compressed& point, const ec_secret& scalar) NOEXCEPT;
 /// Compute the sum a += G * b.
 BC_API bool ec_add(ec_uncompressed& point, const ec_secret& scalar) NOEXCEPT;
 
+/// Compute the sums out[n] = a + G * b[n], with a parsed only once.
+/// False if a is invalid, a failed sum is set to null_ec_compressed.
+BC_API bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT;
+
 /// Compute the sum a = (a + b) % n.
 BC_API bool ec_add(ec_secret& left, const ec_secret& right) NOEXCEPT;
 
@@ -203,6 +212,51 @@ BC_API bool sign(ec_signature& out, const ec_secret& secret,
 BC_API bool verify_signature(const data_slice& point, const hash_digest& hash,
     const ec_signature& signature) NOEXCEPT;
 
+// Schnorr sign/verify (bip340)
+// ----------------------------------------------------------------------------
+
+namespace schnorr {
+
+/// Create a bip340 signature using a private key and auxiliary randomness.
+BC_API bool sign(ec_signature& out, const ec_secret& secret,
+    const hash_digest& hash, const hash_digest& auxiliary) NOEXCEPT;
+
+/// Verify a bip340 signature using a potential x-only point.
+BC_API bool verify_signature(const data_slice& x_point,
+    const hash_digest& hash, const ec_signature& signature) NOEXCEPT;
+
+/// Compute the x-only point out = point + G * tweak, with odd set to the
+/// parity of the resulting point (bip341 taproot output key).
+BC_API bool tweak(ec_xonly& out, bool& odd, const ec_xonly& point,
+    const hash_digest& tweak) NOEXCEPT;
+
+/// Verify that x_point (of parity odd) is point + G * tweak (bip341).
+BC_API bool verify_tweak(const data_slice& x_point, bool odd,
+    const data_slice& point, const hash_digest& tweak) NOEXCEPT;
+
+} // namespace schnorr
+
+// Deferred sign/verify
+// ----------------------------------------------------------------------------
+
+/// Deferred signature verification (collected by script evaluation).
+/// A schnorr check has an x-only point and a bip340 signature.
+struct BC_API ec_signature_check
+{
+    data_chunk point;
+    hash_digest hash;
+    ec_signature signature;
+    bool schnorr{};
+};
+
+typedef std::vector<ec_signature_check> ec_signature_checks;
+
+/// Verify a batch of EC (ECDSA and/or schnorr) signatures, true if all valid.
+/// Verification is distributed across tasks posted to the caller-owned pool
+/// (the caller also verifies), sharing the verify context.
+BC_API bool verify_signatures(const ec_signature_checks& checks,
+    boost::asio::thread_pool& pool) NOEXCEPT;
+
 // Recoverable sign/recover
 // ----------------------------------------------------------------------------
 
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+#define LIBBITCOIN_SYSTEM_CRYPTO_SIGNATURE_CACHE_HPP
+
+#include <array>
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Bounded, thread safe, salted cache of verified EC signatures.
+/// Entries are 128 bits (two independently salted siphashes of the sighash,
+/// signature and point), stored in a direct mapped table of fixed capacity.
+/// A colliding insert displaces the existing entry (most recent wins).
+class BC_API signature_cache
+{
+public:
+    DELETE_COPY_MOVE(signature_cache);
+
+    /// Default capacity of 2^16 entries (1MiB).
+    static constexpr size_t default_capacity = power2(16u);
+
+    /// The process-wide cache, consulted by script signature validation.
+    /// Created with default capacity, which may be changed by resize (only
+    /// before validation begins, such as upon configuration).
+    static signature_cache& instance() NOEXCEPT;
+
+    /// Capacity is the fixed number of entries, zero disables the cache.
+    signature_cache(size_t capacity) NOEXCEPT;
+
+    /// True if the signature has been cached as valid.
+    bool contains(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) const NOEXCEPT;
+
+    /// Cache a valid signature.
+    void insert(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) NOEXCEPT;
+
+    /// Remove all entries and reset counters.
+    void clear() NOEXCEPT;
+
+    /// Remove all entries and reset capacity (e.g. from configuration).
+    /// Not thread safe, lookups read the table size without a lock, so this
+    /// must not be called while any other method may be executing.
+    void resize(size_t capacity) NOEXCEPT;
+
+    /// Properties.
+    size_t capacity() const NOEXCEPT;
+
+    /// Lookup counters (totals of relaxed per shard counters).
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+
+private:
+    typedef std::array<uint64_t, 2> entry;
+    static constexpr size_t shards = 64;
+
+    // Counters of a shard, on their own cache line to avoid false sharing.
+    struct alignas(64) counters
+    {
+        std::atomic<size_t> hits{};
+        std::atomic<size_t> misses{};
+    };
+
+    void reset_counters() NOEXCEPT;
+
+    entry to_entry(const data_slice& point, const hash_digest& hash,
+        const ec_signature& signature) const NOEXCEPT;
+
+    // These are thread safe.
+    const siphash_key key0_;
+    const siphash_key key1_;
+    mutable std::array<counters, shards> counters_{};
+
+    // These are protected by mutex (entry index modulo shards).
+    std::vector<entry> entries_;
+    mutable std::array<std::shared_mutex, shards> mutexes_{};
+};
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -20,6 +20,8 @@
 #define LIBBITCOIN_SYSTEM_DATA_MEMORY_HPP
 
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #include <bitcoin/system/define.hpp>
@@ -78,6 +80,24 @@ inline std::shared_ptr<const Type> to_shared(Args&&... values) NOEXCEPT
     BC_POP_WARNING()
 }
 
+/// Construct shared pointer to const from moved constructor parameters, with
+/// object and control block allocated together from the arena (or the heap if
+/// arena is nullptr). Memory owned by the object (such as vector buffers) is
+/// not allocated from the arena. The arena must outlive the object.
+template <typename Type, typename... Args>
+inline std::shared_ptr<const Type> to_allocated(
+    std::pmr::memory_resource* arena, Args&&... values) NOEXCEPT
+{
+    using value_type = std::remove_const_t<Type>;
+
+    if (is_null(arena))
+        return std::make_shared<value_type>(std::forward<Args>(values)...);
+
+    return std::allocate_shared<value_type>(
+        std::pmr::polymorphic_allocator<value_type>{ arena },
+        std::forward<Args>(values)...);
+}
+
 /// Create shared pointer to vector of const shared pointers from moved vector.
 template <typename Type>
 std::shared_ptr<std::vector<std::shared_ptr<const Type>>>
@@ -68,6 +68,9 @@ enum block_error_t : uint8_t
     // confirm block
     unspent_coinbase_collision,
 
+    // check headers (linked)
+    orphan_header,
+
     // not currently used
     block_error_last
 };
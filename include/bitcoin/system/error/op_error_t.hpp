@@ -122,7 +122,16 @@ enum op_error_t : uint8_t
     op_check_sequence_verify2,
     op_check_sequence_verify3,
     op_check_sequence_verify4,
-    op_check_sequence_verify5
+    op_check_sequence_verify5,
+    op_check_schnorr_sig1,
+    op_check_schnorr_sig2,
+    op_check_schnorr_sig3,
+    op_check_schnorr_sig4,
+    op_check_schnorr_sig5,
+    op_check_schnorr_sig_verify,
+    op_check_sig_add1,
+    op_check_sig_add2,
+    op_check_multisig_tapscript
 };
 
 DECLARE_ERROR_T_CODE_CATEGORY(op_error);
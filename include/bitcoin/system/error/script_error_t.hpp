@@ -48,6 +48,9 @@ enum script_error_t : uint8_t
     invalid_witness_stack,
     dirty_witness,
     stack_false,
+    invalid_control_block,
+    invalid_taproot_commitment,
+    invalid_schnorr_signature,
 
     // chained to op_error_t
     script_error_last
@@ -110,6 +110,10 @@ INLINE short_hash bitcoin_short_hash(const Type& data) NOEXCEPT;
 template <typename Type>
 INLINE data_chunk bitcoin_short_chunk(const Type& data) NOEXCEPT;
 
+/// Bitcoin short hashes of a set, vectorized across the set [script, wallet].
+INLINE short_hashes bitcoin_short_hashes(
+    const std_vector<data_slice>& set) NOEXCEPT;
+
 /// Bitcoin hash (sha256(sha256)) [script, chain, wallet].
 template <typename Type>
 INLINE hash_digest bitcoin_hash(const Type& data) NOEXCEPT;
@@ -124,9 +128,17 @@ INLINE data_chunk bitcoin_chunk(const Type& data) NOEXCEPT;
 /// Merkle root from a bitcoin_hash set [chain].
 INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT;
 
+/// Tagged hash, sha256(sha256(tag) || sha256(tag) || data) [bip340, script].
+INLINE hash_digest tagged_hash(const std::string& tag,
+    const data_slice& data) NOEXCEPT;
+
 /// Litecoin scrypt hash [chain].
 INLINE hash_digest scrypt_hash(const data_slice& data) NOEXCEPT;
 
+/// Litecoin scrypt hashes of a set, vectorized across the set [chain].
+/// Empty if out of memory.
+INLINE hashes scrypt_hashes(const std_vector<data_slice>& set) NOEXCEPT;
+
 /// Hash table keying.
 /// ---------------------------------------------------------------------------
 
@@ -35,6 +35,8 @@ class hmac
 public:
     DEFAULT_COPY_MOVE_DESTRUCT(hmac);
     using digest_t = typename Algorithm::digest_t;
+    using state_t = typename Algorithm::state_t;
+    using digests_t = std_vector<digest_t>;
 
     /// hmac accumulator, not resettable.
     inline hmac(const data_slice& key) NOEXCEPT;
@@ -46,6 +48,15 @@ public:
     static inline digest_t code(const data_slice& data,
         const data_slice& key) NOEXCEPT;
 
+    /// finalized authentication codes of a set under one key (key is padded
+    /// and compressed once, for example child derivations of one parent).
+    static inline digests_t codes(const std_vector<data_slice>& set,
+        const data_slice& key) NOEXCEPT;
+
+    /// Key pad midstates, for batch iteration (see pbkd::keys).
+    static inline void midstates(state_t& inner, state_t& outer,
+        const data_slice& key) NOEXCEPT;
+
 protected:
     using byte_t = typename Algorithm::byte_t;
     using block_t = typename Algorithm::block_t;
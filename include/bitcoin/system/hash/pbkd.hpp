@@ -52,6 +52,14 @@ struct pbkd
     static inline data_array<Size> key(const data_slice& password,
         const data_slice& salt, size_t count) NOEXCEPT;
 
+    /// Multiple derivation (sha256/512), vectorized across passwords.
+    /// Each password is derived with its corresponding salt.
+    template <size_t Size,
+        if_not_greater<Size, pbkd_maximum_size<Algorithm>> = true>
+    static inline std_vector<data_array<Size>> keys(
+        const std_vector<data_slice>& passwords,
+        const std_vector<data_slice>& salts, size_t count) NOEXCEPT;
+
 protected:
     template <size_t Length>
     static constexpr auto xor_n(data_array<Length>& to,
@@ -22,6 +22,7 @@
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/algorithm.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
  // This file is a common include for rmd.
@@ -34,7 +35,9 @@ namespace system {
 namespace rmd {
 
 /// RMD hashing algorithm.
-template <typename RMD, if_same<typename RMD::T, rmdh_t> = true>
+/// Vectorization of multiple half block hashes (e.g. rmd160(sha256)).
+template <typename RMD, bool Vectorized = true,
+    if_same<typename RMD::T, rmdh_t> = true>
 class algorithm
   : algorithm_t
 {
@@ -64,6 +67,10 @@ public:
     using ablocks_t = std_array<block_t, Size>;
     using iblocks_t = iterable<block_t>;
 
+    /// Collection types.
+    using halves_t  = std_vector<half_t>;
+    using digests_t = std_vector<digest_t>;
+
     /// Constants (and count_t).
     /// -----------------------------------------------------------------------
     /// count_t is always uint64_t for rmd.
@@ -85,6 +92,10 @@ public:
     static constexpr digest_t hash(const half_t& half) NOEXCEPT;
     static digest_t hash(iblocks_t&& blocks) NOEXCEPT;
 
+    /// Multiple half block hashing, vectorized across halves.
+    /// -----------------------------------------------------------------------
+    static digests_t hashes(const halves_t& halves) NOEXCEPT;
+
     /// Streamed hashing (unfinalized).
     /// -----------------------------------------------------------------------
 
@@ -123,9 +134,9 @@ protected:
 
     template<size_t Round>
     INLINE static constexpr void round(auto& state, const auto& words) NOEXCEPT;
-    INLINE static constexpr void summarize(state_t& out, const state_t& batch1,
-        const state_t& batch2) NOEXCEPT;
-    static constexpr void compress(state_t& state, const words_t& words) NOEXCEPT;
+    INLINE static constexpr void summarize(auto& out, const auto& batch1,
+        const auto& batch2) NOEXCEPT;
+    static constexpr void compress(auto& state, const auto& words) NOEXCEPT;
     
     /// Parsing
     /// -----------------------------------------------------------------------
@@ -139,6 +150,11 @@ protected:
     static constexpr void pad_half(words_t& words) NOEXCEPT;
     static constexpr void pad_n(words_t& words, count_t blocks) NOEXCEPT;
 
+    /// Multiple half block hashing.
+    /// -----------------------------------------------------------------------
+    INLINE static void hashes_(digests_t& digests, const halves_t& halves,
+        size_t offset = zero) NOEXCEPT;
+
 private:
     using pad_t = std_array<word_t, subtract(RMD::block_words,
         count_bytes / RMD::word_bytes)>;
@@ -146,12 +162,64 @@ private:
     static CONSTEVAL words_t block_pad() NOEXCEPT;
     static CONSTEVAL chunk_t chunk_pad() NOEXCEPT;
     static CONSTEVAL pad_t stream_pad() NOEXCEPT;
+
+/// Vectorization.
+/// -----------------------------------------------------------------------
+protected:
+    /// Extended integer capacity for uint32_t is 4/8/16 only.
+    template <size_t Lanes>
+    static constexpr auto is_valid_lanes =
+        (Lanes == 16u || Lanes == 8u || Lanes == 4u);
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xwords_t = std_array<xWord, RMD::block_words>;
+    template <typename xWord, if_extended<xWord> = true>
+    using xstate_t = std_array<xWord, RMD::state_words>;
+
+    template <typename xWord>
+    INLINE static auto pack(const state_t& state) NOEXCEPT;
+
+    template <typename xWord>
+    INLINE static void pad_half(xwords_t<xWord>& xwords) NOEXCEPT;
+
+    template <typename xWord, size_t... Lane>
+    INLINE static void input(xwords_t<xWord>& xwords, const halves_t& halves,
+        size_t offset, std::index_sequence<Lane...>) NOEXCEPT;
+
+    template <size_t Lane, typename xWord>
+    INLINE static digest_t unpack(const xstate_t<xWord>& xstate) NOEXCEPT;
+
+    template <typename xWord, size_t... Lane>
+    INLINE static void output(digests_t& digests, const xstate_t<xWord>& xstate,
+        size_t offset, std::index_sequence<Lane...>) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void hashes_v_(digests_t& digests, const halves_t& halves,
+        size_t& offset) NOEXCEPT;
+    INLINE static void hashes_v(digests_t& digests,
+        const halves_t& halves) NOEXCEPT;
+
+public:
+    static constexpr auto have_x128     = Vectorized && system::with_sse41;
+    static constexpr auto have_x256     = Vectorized && system::with_avx2;
+    static constexpr auto have_x512     = Vectorized && system::with_avx512;
+    static constexpr auto min_lanes     = (have_x128 ? 16 : (have_x256 ? 32 :
+                                          (have_x512 ? 64 : 0))) / RMD::word_bytes;
+    static constexpr auto vectorization = (have_x128 || have_x256 || have_x512);
 };
 
 } // namespace rmd
 } // namespace system
 } // namespace libbitcoin
 
+#define TEMPLATE template <typename RMD, bool Vectorized, \
+    if_same<typename RMD::T, rmdh_t> If>
+#define CLASS algorithm<RMD, Vectorized, If>
+
 #include <bitcoin/system/impl/hash/rmd/algorithm.ipp>
+#include <bitcoin/system/impl/hash/rmd/algorithm_vectorization.ipp>
+
+#undef CLASS
+#undef TEMPLATE
 
 #endif
@@ -19,11 +19,13 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_SCRYPT_HPP
 #define LIBBITCOIN_SYSTEM_HASH_SCRYPT_HPP
 
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
 #include <bitcoin/system/hash/algorithms.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 namespace libbitcoin {
@@ -42,8 +44,9 @@ constexpr auto is_scrypt_args =
     !is_multiply_overflow(R, 128_size);
 
 /// Concurrent increases memory consumption from minimum to maximum.
+/// Vectorized runs blocks in lanes, each lane consuming (W * R * 128) bytes.
 template<size_t W, size_t R, size_t P, bool Concurrent = false,
-    bool_if<is_scrypt_args<W, R, P>> If = true>
+    bool Vectorized = true, bool_if<is_scrypt_args<W, R, P>> If = true>
 class scrypt
 {
 public:
@@ -75,6 +78,22 @@ public:
     static data_array<Size> hash(const data_slice& password,
         const data_slice& salt) NOEXCEPT;
 
+    /// Multiple hashing, vectorized across the blocks of all passwords.
+    /// Each password is hashed with its corresponding salt.
+    /// Return by reference, false if out of memory.
+    template<size_t Size, if_not_greater<Size,
+        scrypt_derivation::maximum_size> = true>
+    static bool hashes(std_vector<data_array<Size>>& out,
+        const std_vector<data_slice>& passwords,
+        const std_vector<data_slice>& salts) NOEXCEPT;
+
+    /// Return by value, empty if out of memory.
+    template<size_t Size, if_not_greater<Size,
+        scrypt_derivation::maximum_size> = true>
+    static std_vector<data_array<Size>> hashes(
+        const std_vector<data_slice>& passwords,
+        const std_vector<data_slice>& salts) NOEXCEPT;
+
 protected:
     using word_t    = uint32_t;
     using words_t   = std_array<word_t,   block_size / sizeof(word_t)>;
@@ -95,8 +114,69 @@ protected:
     static inline bool block_mix(rblock_t& rblock) NOEXCEPT;
     static inline bool romix(rblock_t& rblock) NOEXCEPT;
 
+    /// Romix each referenced rblock, vectorized when enabled.
+    using rblocks_t = std_vector<rblock_t*>;
+    static inline bool romixes(const rblocks_t& rblocks,
+        bool vectorize) NOEXCEPT;
+
 private:
     static CONSTEVAL auto& concurrency() NOEXCEPT;
+
+/// Vectorization.
+/// -----------------------------------------------------------------------
+protected:
+    static constexpr auto block_words = array_count<words_t>;
+
+    template <typename xWord, if_extended<xWord> = true>
+    using xwords_t   = std_array<xWord, block_words>;
+    template <typename xWord, if_extended<xWord> = true>
+    using xrblock_t  = std_array<xwords_t<xWord>, R * 2_size>;
+    template <typename xWord, if_extended<xWord> = true>
+    using xwrblock_t = std_array<xrblock_t<xWord>, W>;
+
+    template <typename xWord>
+    INLINE static void add(xwords_t<xWord>& to,
+        const xwords_t<xWord>& from) NOEXCEPT;
+    template <typename xWord>
+    INLINE static xwords_t<xWord>& xor_(xwords_t<xWord>& to,
+        const xwords_t<xWord>& from) NOEXCEPT;
+
+    template <size_t A, size_t B, size_t C, size_t D, typename xWord>
+    INLINE static void salsa_qr(xwords_t<xWord>& words) NOEXCEPT;
+    template <typename xWord>
+    INLINE static xwords_t<xWord>& salsa_8(xwords_t<xWord>& block) NOEXCEPT;
+    template <typename xWord>
+    INLINE static void block_mix(xrblock_t<xWord>& xrblock) NOEXCEPT;
+
+    template <size_t Lane, typename xWord>
+    INLINE static size_t index(const xrblock_t<xWord>& xrblock) NOEXCEPT;
+    template <typename xWord, size_t... Lane>
+    INLINE static xrblock_t<xWord>& xor_(xrblock_t<xWord>& to,
+        const xwrblock_t<xWord>& from, std::index_sequence<Lane...>) NOEXCEPT;
+
+    template <typename xWord, size_t... Lane>
+    INLINE static void pack(xrblock_t<xWord>& xrblock,
+        const rblocks_t& rblocks, size_t offset,
+        std::index_sequence<Lane...>) NOEXCEPT;
+    template <typename xWord, size_t... Lane>
+    INLINE static void unpack(const rblocks_t& rblocks,
+        const xrblock_t<xWord>& xrblock, size_t offset,
+        std::index_sequence<Lane...>) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    static inline bool romix_v_(const rblocks_t& rblocks,
+        size_t offset) NOEXCEPT;
+    static inline bool romix_v(const rblocks_t& rblocks, size_t offset,
+        size_t lanes) NOEXCEPT;
+    static inline size_t lanes(size_t count) NOEXCEPT;
+
+public:
+    static constexpr auto have_x128     = Vectorized && system::with_sse41;
+    static constexpr auto have_x256     = Vectorized && system::with_avx2;
+    static constexpr auto have_x512     = Vectorized && system::with_avx512;
+    static constexpr auto min_lanes     = (have_x128 ? 16 : (have_x256 ? 32 :
+                                          (have_x512 ? 64 : 0))) / sizeof(word_t);
+    static constexpr auto vectorization = (have_x128 || have_x256 || have_x512);
 };
 
 /// Litecoin/BIP38 scrypt arguments.
@@ -19,9 +19,11 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_HPP
 #define LIBBITCOIN_SYSTEM_HASH_SHA_ALGORITHM_HPP
 
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/algorithm.hpp>
+#include <bitcoin/system/hash/sha/dispatch.hpp>
 #include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
@@ -36,7 +38,7 @@ namespace system {
 namespace sha {
 
 /// SHA hashing algorithm.
-/// Compression not yet implemented.
+/// Compression by runtime dispatch (sha256 only, see sha::dispatch).
 /// Vectorization of message schedules and merkle hashes.
 template <typename SHA, bool Compressed = true, bool Vectorized = true,
     bool Cached = true, if_same<typename SHA::T, sha::shah_t> = true>
@@ -69,6 +71,8 @@ public:
     using ablocks_t = std_array<block_t, Size>;
     using iblocks_t = iterable<block_t>;
     using digests_t = std_vector<digest_t>;
+    using messages_t = std_vector<data_slice>;
+    using states_t  = std_vector<state_t>;
 
     /// Constants (and count_t).
     /// -----------------------------------------------------------------------
@@ -108,6 +112,19 @@ public:
     static VCONSTEXPR digest_t merkle_root(digests_t&& digests) NOEXCEPT;
     static VCONSTEXPR digests_t& merkle_hash(digests_t& digests) NOEXCEPT;
 
+    /// Multiple message hashing (sha256/512), vectorized across messages.
+    /// -----------------------------------------------------------------------
+    static digests_t hashes(const messages_t& messages) NOEXCEPT;
+    static digests_t double_hashes(const messages_t& messages) NOEXCEPT;
+
+    /// Multiple hmac iteration (sha256/512), vectorized across keys.
+    /// -----------------------------------------------------------------------
+    /// Inner and outer are hmac key pad midstates (see hmac::midstates).
+    /// Each digest U_1 is replaced by U_1 ^ U_2 ^ ... ^ U_count, where
+    /// U_c = hmac(U_c-1), which is the pkcs5 pbkdf2 function F.
+    static void hmac_iterate(digests_t& digests, const states_t& inners,
+        const states_t& outers, size_t count) NOEXCEPT;
+
     /// Streamed hashing (unfinalized).
     /// -----------------------------------------------------------------------
     static void accumulate(state_t& state, iblocks_t&& blocks) NOEXCEPT;
@@ -198,6 +215,31 @@ protected:
     VCONSTEXPR static void merkle_hash_(digests_t& digests,
         size_t offset = zero) NOEXCEPT;
 
+    /// Message iteration.
+    /// -----------------------------------------------------------------------
+    static constexpr size_t message_blocks(size_t bytes) NOEXCEPT;
+    INLINE static void message_block(block_t& block, const data_slice& message,
+        size_t index) NOEXCEPT;
+
+    INLINE static void iterate(states_t& states,
+        const messages_t& messages) NOEXCEPT;
+    INLINE static void iterate_(states_t& states, const messages_t& messages,
+        size_t offset = zero) NOEXCEPT;
+
+    INLINE static void finalize_double(digests_t& digests,
+        const states_t& states) NOEXCEPT;
+    INLINE static void finalize_double_(digests_t& digests,
+        const states_t& states, size_t offset = zero) NOEXCEPT;
+
+    /// Hmac iteration.
+    /// -----------------------------------------------------------------------
+    INLINE static void pad_keyed(buffer_t& buffer) NOEXCEPT;
+    INLINE static void iterate_hmac(auto& sum, const auto& inner,
+        const auto& outer, auto& buffer, size_t count) NOEXCEPT;
+    INLINE static void hmac_iterate_(digests_t& digests,
+        const states_t& inners, const states_t& outers, size_t count,
+        size_t offset = zero) NOEXCEPT;
+
 private:
     using pad_t = std_array<word_t, subtract(SHA::block_words,
         count_bytes / SHA::word_bytes)>;
@@ -205,16 +247,34 @@ private:
     template <size_t Blocks>
     static CONSTEVAL buffer_t scheduled_pad() NOEXCEPT;
     static CONSTEVAL chunk_t chunk_pad() NOEXCEPT;
+    static CONSTEVAL chunk_t keyed_pad() NOEXCEPT;
     static CONSTEVAL pad_t stream_pad() NOEXCEPT;
 
 /// Compression.
 /// -----------------------------------------------------------------------
 protected:
+    /// Runtime dispatched kernels, false/zero if not dispatched or available.
+    template <size_t Size>
+    INLINE static bool compress_d(state_t& state,
+        const ablocks_t<Size>& blocks) NOEXCEPT;
+    INLINE static bool compress_d(state_t& state, iblocks_t& blocks) NOEXCEPT;
+    INLINE static bool compress_d(state_t& state, const block_t& block) NOEXCEPT;
+    INLINE static bool double_hash_d(digest_t& digest,
+        const block_t& block) NOEXCEPT;
+    INLINE static size_t merkle_hash_d(digests_t& digests) NOEXCEPT;
+
 public:
     static constexpr auto have_shani = Compressed && system::with_shani;
     static constexpr auto have_neon = Compressed && system::with_neon;
     static constexpr auto compression = have_shani || have_neon;
 
+    /// sha256 kernels are probed at runtime where not compiled in. Compiled
+    /// vectorization retains precedence over dispatched merkle hashing.
+    static constexpr auto dispatched = Compressed && !compression &&
+        is_same_type<K, sha::k256>;
+    static constexpr auto dispatched_merkle = dispatched &&
+        (SHA::digest == 256);
+
 /// Vectorization.
 /// -----------------------------------------------------------------------
 protected:
@@ -274,6 +334,44 @@ protected:
 
     INLINE static void merkle_hash_v(digests_t& digests) NOEXCEPT;
 
+    /// Multiple Hash.
+    /// -----------------------------------------------------------------------
+
+    template <typename xWord, size_t... Lane>
+    INLINE static auto pack_states(const std_array<state_t, sizeof...(Lane)>&
+        states, std::index_sequence<Lane...>) NOEXCEPT;
+
+    template <typename xWord, size_t... Lane>
+    INLINE static void unpack_states(std_array<state_t, sizeof...(Lane)>&
+        states, const xstate_t<xWord>& xstate,
+        std::index_sequence<Lane...>) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void iterate_v_(states_t& states,
+        const messages_t& messages, size_t& offset) NOEXCEPT;
+    INLINE static void iterate_v(states_t& states,
+        const messages_t& messages) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void finalize_double_v_(digests_t& digests,
+        const states_t& states, size_t& offset) NOEXCEPT;
+    INLINE static void finalize_double_v(digests_t& digests,
+        const states_t& states) NOEXCEPT;
+
+    /// Hmac Iteration.
+    /// -----------------------------------------------------------------------
+
+    template <typename xWord>
+    INLINE static void pad_keyed(xbuffer_t<xWord>& xbuffer) NOEXCEPT;
+
+    template <typename xWord, if_extended<xWord> = true>
+    INLINE static void hmac_iterate_v_(digests_t& digests,
+        const states_t& inners, const states_t& outers, size_t count,
+        size_t& offset) NOEXCEPT;
+    INLINE static void hmac_iterate_v(digests_t& digests,
+        const states_t& inners, const states_t& outers,
+        size_t count) NOEXCEPT;
+
     /// Message Schedule (block vectorization).
     /// -----------------------------------------------------------------------
 
@@ -311,7 +409,7 @@ public:
     static constexpr auto have_x256     = Vectorized && system::with_avx2;
     static constexpr auto have_x512     = Vectorized && system::with_avx512;
     static constexpr auto min_lanes     = (have_x128 ? 16 : (have_x256 ? 32 :
-                                          (have_x128 ? 64 : 0))) / SHA::word_bytes;
+                                          (have_x512 ? 64 : 0))) / SHA::word_bytes;
     static constexpr auto vectorization = (have_x128 || have_x256 || have_x512) && 
                                          !(build_x32 && is_same_size<word_t, uint64_t>);
 };
@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_SHA_DISPATCH_HPP
+#define LIBBITCOIN_SYSTEM_HASH_SHA_DISPATCH_HPP
+
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+
+/// sha256 kernels selected once, at runtime, by CPU probe.
+/// ---------------------------------------------------------------------------
+/// The kernels (src/hash/vectorization) are compiled for their own instruction
+/// sets, independent of WITH_ build symbols, so a portable build uses SHA-NI
+/// and AVX2 on hosts that support them. Build-configured vectorization takes
+/// precedence where compiled in (see algorithm::vectorization).
+
+namespace dispatch {
+
+/// True if a sha256 compression kernel (SHA-NI) is available.
+BC_API bool have_compress() NOEXCEPT;
+
+/// True if a sha256 merkle kernel (SHA-NI or AVX2) is available.
+BC_API bool have_merkle() NOEXCEPT;
+
+/// Compress count contiguous 64 byte blocks into the 8 word state.
+/// Returns false (state unchanged) if there is no available kernel.
+BC_API bool compress(uint32_t* state, const uint8_t* blocks,
+    size_t count) NOEXCEPT;
+
+/// Double hash count contiguous 64 byte blocks into contiguous 32 byte
+/// digests, where digests may be blocks (in place). Returns the number of
+/// leading blocks hashed, with any remainder to be hashed by the caller.
+BC_API size_t merkle(uint8_t* digests, const uint8_t* blocks,
+    size_t count) NOEXCEPT;
+
+/// Double hash count contiguous 80 byte (block header) messages into
+/// contiguous 32 byte digests. Returns the number of leading headers hashed,
+/// with any remainder to be hashed by the caller.
+BC_API size_t headers(uint8_t* digests, const uint8_t* headers,
+    size_t count) NOEXCEPT;
+
+} // namespace dispatch
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -37,6 +37,11 @@ BC_API uint64_t siphash(const siphash_key& key,
 BC_API uint64_t siphash(const half_hash& hash,
     const data_slice& message) NOEXCEPT;
 
+/// Siphash of each message with the same key, vectorized across messages
+/// and concurrent for large sets.
+BC_API std_vector<uint64_t> siphashes(const siphash_key& key,
+    const std_vector<data_slice>& messages) NOEXCEPT;
+
 BC_API siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT;
 
 } // namespace system
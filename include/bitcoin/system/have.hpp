@@ -110,6 +110,11 @@
     #define HAVE_XASSEMBLY
 #endif
 
+/// Native 128 bit integer (GCC/Clang on 64 bit targets).
+#if defined(__SIZEOF_INT128__)
+    #define HAVE_INT128
+#endif
+
 /// ARM Neon intrinsics.
 #if defined(HAVE_ARM)
     // -march=armv8-a+crc+crypto [all]
@@ -81,7 +81,8 @@ compact::from_compact(const parse& compact) NOEXCEPT
 
 // public
 
-constexpr compact::span_type
+template <typename Number>
+constexpr Number
 compact::expand(small_type exponential) NOEXCEPT
 {
     auto compact = to_compact(exponential);
@@ -100,7 +101,7 @@ compact::expand(small_type exponential) NOEXCEPT
 
     // Above exists only because negatives were inadvertently excluded.
     
-    return base256e::expand(from_compact(compact));
+    return base256e::expand<Number>(from_compact(compact));
 }
 
 constexpr compact::small_type
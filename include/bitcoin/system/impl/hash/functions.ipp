@@ -147,6 +147,12 @@ INLINE data_chunk bitcoin_short_chunk(const Type& data) NOEXCEPT
     return accumulator<rmd160>::hash_chunk(accumulator<sha256>::hash(data));
 }
 
+INLINE short_hashes bitcoin_short_hashes(
+    const std_vector<data_slice>& set) NOEXCEPT
+{
+    return rmd160::hashes(sha256::hashes(set));
+}
+
 // Bitcoin hash (sha256(sha256)) [script, chain, wallet].
 template <typename Type>
 INLINE hash_digest bitcoin_hash(const Type& data) NOEXCEPT
@@ -189,6 +195,19 @@ INLINE hash_digest merkle_root(hashes&& set) NOEXCEPT
     return sha256::merkle_root(std::move(set));
 }
 
+// Tagged hash [bip340, script].
+INLINE hash_digest tagged_hash(const std::string& tag,
+    const data_slice& data) NOEXCEPT
+{
+    // The twice written tag hash fills the first block.
+    const auto prefix = sha256_hash(tag);
+    accumulator<sha256> context{};
+    context.write(prefix);
+    context.write(prefix);
+    context.write(data.size(), data.data());
+    return context.flush();
+}
+
 // Litecoin scrypt hash [chain].
 INLINE hash_digest scrypt_hash(const data_slice& data) NOEXCEPT
 {
@@ -196,6 +215,11 @@ INLINE hash_digest scrypt_hash(const data_slice& data) NOEXCEPT
     return scrypt<1024, 1, 1, true>::hash<hash_size>(data, data);
 }
 
+INLINE hashes scrypt_hashes(const std_vector<data_slice>& set) NOEXCEPT
+{
+    return scrypt<1024, 1, 1, true>::hashes<hash_size>(set, set);
+}
+
 // Hash table keying.
 // ----------------------------------------------------------------------------
 
@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_HASH_HMAC_IPP
 #define LIBBITCOIN_SYSTEM_HASH_HMAC_IPP
 
+#include <algorithm>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/hash/accumulator.hpp>
@@ -167,6 +168,51 @@ code(const data_slice& data, const data_slice& key) NOEXCEPT
     return buffer.flush();
 }
 
+TEMPLATE
+inline typename CLASS::digests_t CLASS::
+codes(const std_vector<data_slice>& set, const data_slice& key) NOEXCEPT
+{
+    // The keyed (unwritten) accumulators are copied for each code.
+    const hmac<Algorithm> keyed{ key };
+    digests_t out(set.size());
+
+    std::transform(set.begin(), set.end(), out.begin(),
+        [&](const data_slice& data) NOEXCEPT
+        {
+            auto buffer = keyed;
+            buffer.write(data);
+            return buffer.flush();
+        });
+
+    return out;
+}
+
+TEMPLATE
+inline void CLASS::
+midstates(state_t& inner, state_t& outer, const data_slice& key) NOEXCEPT
+{
+    constexpr auto block_bytes = array_count<block_t>;
+    constexpr auto digest_bytes = array_count<digest_t>;
+    constexpr auto ipad = inner_pad();
+    constexpr auto opad = outer_pad();
+
+    // rfc2104
+    // K if K is not larger than block size, otherwise H(K).
+    const auto hashed = key.size() > block_bytes;
+    const auto digest = hashed ? accumulator<Algorithm>::hash(key.size(),
+        key.data()) : digest_t{};
+    const auto data = hashed ? digest.data() : key.data();
+    const auto size = hashed ? digest_bytes : key.size();
+
+    auto pad = ipad;
+    inner = Algorithm::H::get;
+    Algorithm::accumulate(inner, xor_n(pad, data, size));
+
+    pad = opad;
+    outer = Algorithm::H::get;
+    Algorithm::accumulate(outer, xor_n(pad, data, size));
+}
+
 #undef CLASS
 #undef TEMPLATE
 
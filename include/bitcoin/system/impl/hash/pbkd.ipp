@@ -148,6 +148,52 @@ key(const data_slice& password, const data_slice& salt,
     return dk;
 }
 
+TEMPLATE
+template <size_t Size, if_not_greater<Size, pbkd_maximum_size<Algorithm>>>
+inline std_vector<data_array<Size>> CLASS::
+keys(const std_vector<data_slice>& passwords,
+    const std_vector<data_slice>& salts, size_t count) NOEXCEPT
+{
+    BC_ASSERT(passwords.size() == salts.size());
+    constexpr auto hlen = array_count<typename Algorithm::digest_t>;
+    constexpr auto l = ceilinged_divide(Size, hlen);
+    constexpr auto r = Size - sub1(l) * hlen;
+    constexpr auto words = to_big_endians(sequence<uint32_t, add1(l)>);
+    const auto& index = array_cast<std_array<uint8_t, sizeof(uint32_t)>>(words);
+
+    // Keyed hmac midstates are shared across all iterations of a password.
+    const auto size = passwords.size();
+    typename Algorithm::states_t inners(size);
+    typename Algorithm::states_t outers(size);
+    for (size_t key = 0; key < size; ++key)
+        hmac<Algorithm>::midstates(inners[key], outers[key], passwords[key]);
+
+    std_vector<data_array<Size>> dks(size);
+    typename Algorithm::digests_t t(size);
+
+    for (size_t i = 1; i <= l; ++i)
+    {
+        // U_1 = PRF (P, S || INT (i))
+        for (size_t key = 0; key < size; ++key)
+        {
+            hmac<Algorithm> ps(passwords[key]);
+            ps.write(salts[key]);
+            ps.write(index.at(i));
+            t[key] = ps.flush();
+        }
+
+        // F (P, S, c, i) = U_1 \xor U_2 \xor ... \xor U_c
+        Algorithm::hmac_iterate(t, inners, outers, count);
+
+        // DK = T_1 || T_2 ||  ...  || T_l<0..r-1>
+        for (size_t key = 0; key < size; ++key)
+            std::copy_n(t[key].begin(), (i == l ? r : hlen),
+                std::next(dks[key].begin(), sub1(i) * hlen));
+    }
+
+    return dks;
+}
+
 #undef CLASS
 #undef TEMPLATE
 
@@ -33,9 +33,6 @@ namespace libbitcoin {
 namespace system {
 namespace rmd {
 
-#define TEMPLATE template <typename RMD, if_same<typename RMD::T, rmdh_t> If>
-#define CLASS algorithm<RMD, If>
-
 // Bogus warning suggests constexpr when declared consteval.
 BC_PUSH_WARNING(USE_CONSTEXPR_FOR_FUNCTION)
 BC_PUSH_WARNING(NO_UNGUARDED_POINTERS)
@@ -125,9 +122,10 @@ round(auto& a, auto b, auto c, auto d, auto x) NOEXCEPT
 {
     constexpr auto s = K::rot[Round];
     constexpr auto k = K::get[Round / K::columns];
+    constexpr auto w = RMD::word_bits;
     constexpr auto fn = functor<Round, decltype(a)>();
 
-    a = /*b =*/ f::rol<s>(f::addc<k>(f::add(f::add(a, fn(b, c, d)), x)));
+    a = /*b =*/ f::rol<s, w>(f::addc<k, w>(f::add<w>(f::add<w>(a, fn(b, c, d)), x)));
 }
 
 TEMPLATE
@@ -137,10 +135,11 @@ round(auto& a, auto b, auto& c, auto d, auto e, auto x) NOEXCEPT
 {
     constexpr auto s = K::rot[Round];
     constexpr auto k = K::get[Round / K::columns];
+    constexpr auto w = RMD::word_bits;
     constexpr auto fn = functor<Round, decltype(a)>();
 
-    a = /*b =*/ f::add(f::rol<s>(f::addc<k>(f::add(f::add(a, fn(b, c, d)), x))), e);
-    c = /*d =*/ f::rol<10>(c);
+    a = /*b =*/ f::add<w>(f::rol<s, w>(f::addc<k, w>(f::add<w>(f::add<w>(a, fn(b, c, d)), x))), e);
+    c = /*d =*/ f::rol<10, w>(c);
 }
 
 TEMPLATE
@@ -171,12 +170,12 @@ round(auto& state, const auto& words) NOEXCEPT
 
 TEMPLATE
 constexpr void CLASS::
-compress(state_t& state, const words_t& words) NOEXCEPT
+compress(auto& state, const auto& words) NOEXCEPT
 {
     constexpr auto offset = to_half(RMD::rounds);
 
-    state_t left{ state };
-    state_t right{ state };
+    auto left{ state };
+    auto right{ state };
 
     // RMD160:f0/f4, RMD128:f0/f3
     round< 0>(left, words); round< 0 + offset>(right, words);
@@ -276,25 +275,27 @@ compress(state_t& state, const words_t& words) NOEXCEPT
 
 TEMPLATE
 INLINE constexpr void CLASS::
-summarize(state_t& state, const state_t& batch1,
-    const state_t& batch2) NOEXCEPT
+summarize(auto& state, const auto& batch1,
+    const auto& batch2) NOEXCEPT
 {
+    constexpr auto w = RMD::word_bits;
+
     if constexpr (RMD::strength == 128)
     {
         const auto state_0_ = state[0];
-        state[0] = f::add(f::add(state[1], batch1[2]), batch2[3]);
-        state[1] = f::add(f::add(state[2], batch1[3]), batch2[0]);
-        state[2] = f::add(f::add(state[3], batch1[0]), batch2[1]);
-        state[3] = f::add(f::add(state_0_, batch1[1]), batch2[2]);
+        state[0] = f::add<w>(f::add<w>(state[1], batch1[2]), batch2[3]);
+        state[1] = f::add<w>(f::add<w>(state[2], batch1[3]), batch2[0]);
+        state[2] = f::add<w>(f::add<w>(state[3], batch1[0]), batch2[1]);
+        state[3] = f::add<w>(f::add<w>(state_0_, batch1[1]), batch2[2]);
     }
     else
     {
         const auto state_0_ = state[0];
-        state[0] = f::add(f::add(state[1], batch1[2]), batch2[3]);
-        state[1] = f::add(f::add(state[2], batch1[3]), batch2[4]);
-        state[2] = f::add(f::add(state[3], batch1[4]), batch2[0]);
-        state[3] = f::add(f::add(state[4], batch1[0]), batch2[1]);
-        state[4] = f::add(f::add(state_0_, batch1[1]), batch2[2]);
+        state[0] = f::add<w>(f::add<w>(state[1], batch1[2]), batch2[3]);
+        state[1] = f::add<w>(f::add<w>(state[2], batch1[3]), batch2[4]);
+        state[2] = f::add<w>(f::add<w>(state[3], batch1[4]), batch2[0]);
+        state[3] = f::add<w>(f::add<w>(state[4], batch1[0]), batch2[1]);
+        state[4] = f::add<w>(f::add<w>(state_0_, batch1[1]), batch2[2]);
     }
 }
 
@@ -606,6 +607,35 @@ hash(const half_t& half) NOEXCEPT
     return output(state);
 }
 
+// Multiple half block hashing.
+// ---------------------------------------------------------------------------
+
+TEMPLATE
+INLINE void CLASS::
+hashes_(digests_t& digests, const halves_t& halves, size_t offset) NOEXCEPT
+{
+    for (; offset < halves.size(); ++offset)
+        digests[offset] = hash(halves[offset]);
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hashes(const halves_t& halves) NOEXCEPT
+{
+    digests_t digests(halves.size());
+
+    if constexpr (vectorization)
+    {
+        hashes_v(digests, halves);
+    }
+    else
+    {
+        hashes_(digests, halves);
+    }
+
+    return digests;
+}
+
 // Streaming hash functions and finalizers.
 // ---------------------------------------------------------------------------
 
@@ -652,9 +682,6 @@ BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
 
-#undef CLASS
-#undef TEMPLATE
-
 } // namespace rmd
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_RMD_ALGORITHM_VECTORIZATION_IPP
+#define LIBBITCOIN_SYSTEM_HASH_RMD_ALGORITHM_VECTORIZATION_IPP
+
+#include <utility>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/endian/endian.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace rmd {
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Half block hashing (vectorized across halves).
+// ----------------------------------------------------------------------------
+// Each half is one lane, so all lanes share the same (single block) schedule.
+// This is the rmd160 stage of bitcoin_short_hash (rmd160(sha256)).
+
+TEMPLATE
+template <typename xWord>
+INLINE auto CLASS::
+pack(const state_t& state) NOEXCEPT
+{
+    xstate_t<xWord> xstate{};
+    for (size_t word = 0; word < RMD::state_words; ++word)
+        xstate[word] = broadcast<xWord>(state[word]);
+
+    return xstate;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+pad_half(xwords_t<xWord>& xwords) NOEXCEPT
+{
+    constexpr auto pad = chunk_pad();
+    constexpr auto chunk_words = array_count<chunk_t>;
+
+    for (size_t word = 0; word < chunk_words; ++word)
+        xwords[chunk_words + word] = broadcast<xWord>(pad[word]);
+}
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE void CLASS::
+input(xwords_t<xWord>& xwords, const halves_t& halves, size_t offset,
+    std::index_sequence<Lane...>) NOEXCEPT
+{
+    constexpr auto chunk_words = array_count<chunk_t>;
+
+    for (size_t word = 0; word < chunk_words; ++word)
+        xwords[word] = set<xWord>(native_from_little_end(
+            array_cast<word_t>(halves[offset + Lane])[word])...);
+}
+
+TEMPLATE
+template <size_t Lane, typename xWord>
+INLINE typename CLASS::digest_t CLASS::
+unpack(const xstate_t<xWord>& xstate) NOEXCEPT
+{
+    if constexpr (RMD::strength == 128)
+    {
+        return output(state_t
+        {
+            get<word_t, Lane>(xstate[0]),
+            get<word_t, Lane>(xstate[1]),
+            get<word_t, Lane>(xstate[2]),
+            get<word_t, Lane>(xstate[3])
+        });
+    }
+    else
+    {
+        return output(state_t
+        {
+            get<word_t, Lane>(xstate[0]),
+            get<word_t, Lane>(xstate[1]),
+            get<word_t, Lane>(xstate[2]),
+            get<word_t, Lane>(xstate[3]),
+            get<word_t, Lane>(xstate[4])
+        });
+    }
+}
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE void CLASS::
+output(digests_t& digests, const xstate_t<xWord>& xstate, size_t offset,
+    std::index_sequence<Lane...>) NOEXCEPT
+{
+    ((digests[offset + Lane] = unpack<Lane>(xstate)), ...);
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+hashes_v_(digests_t& digests, const halves_t& halves, size_t& offset) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    constexpr auto sequence = std::make_index_sequence<lanes>{};
+    static_assert(is_valid_lanes<lanes>);
+
+    if ((halves.size() - offset) >= lanes && have<xWord>())
+    {
+        static auto initial = pack<xWord>(H::get);
+        xwords_t<xWord> xwords;
+        pad_half(xwords);
+
+        do
+        {
+            input(xwords, halves, offset, sequence);
+            auto xstate = initial;
+            compress(xstate, xwords);
+            output(digests, xstate, offset, sequence);
+            offset += lanes;
+        }
+        while ((halves.size() - offset) >= lanes);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+hashes_v(digests_t& digests, const halves_t& halves) NOEXCEPT
+{
+    auto offset = zero;
+
+    if (halves.size() >= min_lanes)
+    {
+        // Half block hashing vector dispatch.
+        if constexpr (have_x512)
+            hashes_v_<xint512_t>(digests, halves, offset);
+        if constexpr (have_x256)
+            hashes_v_<xint256_t>(digests, halves, offset);
+        if constexpr (have_x128)
+            hashes_v_<xint128_t>(digests, halves, offset);
+    }
+
+    // Complete hashes using normal form.
+    // offset is increased by vectorization.
+    hashes_(digests, halves, offset);
+}
+
+BC_POP_WARNING()
+
+} // namespace rmd
+} // namespace system
+} // namespace libbitcoin
+
+#endif
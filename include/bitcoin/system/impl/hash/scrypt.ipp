@@ -23,10 +23,13 @@
 #include <algorithm>
 #include <bit>
 #include <memory>
+#include <numeric>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 #include <bitcoin/system/hash/pbkd.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 
 // Based on:
@@ -38,9 +41,9 @@ namespace libbitcoin {
 namespace system {
 
 #define TEMPLATE \
-template<size_t W, size_t R, size_t P, bool Concurrent, \
+template<size_t W, size_t R, size_t P, bool Concurrent, bool Vectorized, \
     bool_if<is_scrypt_args<W, R, P>> If>
-#define CLASS scrypt<W, R, P, Concurrent, If>
+#define CLASS scrypt<W, R, P, Concurrent, Vectorized, If>
 
 BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
 BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
@@ -471,6 +474,247 @@ romix(rblock_t& rblock) NOEXCEPT
     return true;
 }
 
+TEMPLATE
+inline bool CLASS::
+romixes(const rblocks_t& rblocks, bool vectorize) NOEXCEPT
+{
+    // Groups of lanes are vectorized, with remaining rblocks in normal form.
+    const auto count = rblocks.size();
+    const auto width = vectorize ? lanes(count) : one;
+    const auto groups = is_one(width) ? zero : count / width;
+    const auto vectored = groups * width;
+
+    // Work items are vector groups followed by normal form rblocks.
+    std_vector<size_t> items(groups + (count - vectored));
+    std::iota(items.begin(), items.end(), zero);
+
+    std::atomic_bool success{ true };
+    std_for_each(concurrency(), items.begin(), items.end(),
+        [&](size_t item) NOEXCEPT
+        {
+            success = success && ((item < groups) ?
+                romix_v(rblocks, item * width, width) :
+                romix(*rblocks[vectored + (item - groups)]));
+        });
+
+    return success;
+}
+
+// Vectorization.
+// ----------------------------------------------------------------------------
+// Each lane is an independent rblock (a P block of one or more hashes), so
+// all lanes share the same salsa/block_mix schedule. Only the romix lookup
+// index varies by lane, so only that xor is gathered (from lane storage).
+// Words are native (not little-endian) from pack until unpack.
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+add(xwords_t<xWord>& to, const xwords_t<xWord>& from) NOEXCEPT
+{
+    for (size_t word = 0; word < block_words; ++word)
+        to[word] = f::add<bits<word_t>>(to[word], from[word]);
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::template xwords_t<xWord>& CLASS::
+xor_(xwords_t<xWord>& to, const xwords_t<xWord>& from) NOEXCEPT
+{
+    for (size_t word = 0; word < block_words; ++word)
+        to[word] = f::xor_(to[word], from[word]);
+
+    return to;
+}
+
+TEMPLATE
+template <size_t A, size_t B, size_t C, size_t D, typename xWord>
+INLINE void CLASS::
+salsa_qr(xwords_t<xWord>& words) NOEXCEPT
+{
+    constexpr auto s = bits<word_t>;
+
+    // Salsa20/8 Quarter Round
+    words[B] = f::xor_(words[B], f::rol< 7, s>(f::add<s>(words[A], words[D])));
+    words[C] = f::xor_(words[C], f::rol< 9, s>(f::add<s>(words[B], words[A])));
+    words[D] = f::xor_(words[D], f::rol<13, s>(f::add<s>(words[C], words[B])));
+    words[A] = f::xor_(words[A], f::rol<18, s>(f::add<s>(words[D], words[C])));
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE typename CLASS::template xwords_t<xWord>& CLASS::
+salsa_8(xwords_t<xWord>& block) NOEXCEPT
+{
+    auto words = block;
+
+    // salsa20/8 is salsa20 with 8 vs. 20 rounds.
+    for (size_t i = 0; i < 4u; ++i)
+    {
+        // columns
+        salsa_qr< 0,  4,  8, 12>(words);
+        salsa_qr< 5,  9, 13,  1>(words);
+        salsa_qr<10, 14,  2,  6>(words);
+        salsa_qr<15,  3,  7, 11>(words);
+
+        // rows
+        salsa_qr< 0,  1,  2,  3>(words);
+        salsa_qr< 5,  6,  7,  4>(words);
+        salsa_qr<10, 11,  8,  9>(words);
+        salsa_qr<15, 12, 13, 14>(words);
+    }
+
+    add(block, words);
+    return block;
+}
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+block_mix(xrblock_t<xWord>& xrblock) NOEXCEPT
+{
+    // BLOCK_MIX_OPTIMAL_FORM, with stack allocated working blocks.
+    auto xblock = xrblock.back();
+    std_array<xwords_t<xWord>, sub1(R)> yblock;
+
+    for (size_t i = 0, j = 0; i < sub1(R); ++i)
+    {
+        xrblock[i] = salsa_8(xor_(xblock, xrblock[j++]));
+        yblock[i] = salsa_8(xor_(xblock, xrblock[j++]));
+    }
+
+    xrblock[sub1(R << 0)] = salsa_8(xor_(xblock, xrblock[sub1(sub1(R << 1))]));
+    salsa_8(xor_(xrblock[sub1(R << 1)], xblock));
+
+    for (size_t i = 0, j = R; i < sub1(R); ++i)
+        xrblock[j++] = yblock[i];
+}
+
+TEMPLATE
+template <size_t Lane, typename xWord>
+INLINE size_t CLASS::
+index(const xrblock_t<xWord>& xrblock) NOEXCEPT
+{
+    // Integerify (X) mod N, of the lane (native words).
+    const auto& last = xrblock.back();
+    const auto low = get<word_t, Lane>(last[0]);
+    const auto high = get<word_t, Lane>(last[1]);
+    return possible_narrow_cast<size_t>(
+        bit_or<uint64_t>(shift_left<uint64_t>(high, bits<word_t>), low) % W);
+}
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE typename CLASS::template xrblock_t<xWord>& CLASS::
+xor_(xrblock_t<xWord>& to, const xwrblock_t<xWord>& from,
+    std::index_sequence<Lane...>) NOEXCEPT
+{
+    const std_array<size_t, sizeof...(Lane)> indexes{ index<Lane>(to)... };
+
+    for (size_t block = 0; block < (R << 1); ++block)
+        for (size_t word = 0; word < block_words; ++word)
+            to[block][word] = f::xor_(to[block][word], set<xWord>(
+                get<word_t, Lane>(from[indexes[Lane]][block][word])...));
+
+    return to;
+}
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE void CLASS::
+pack(xrblock_t<xWord>& xrblock, const rblocks_t& rblocks, size_t offset,
+    std::index_sequence<Lane...>) NOEXCEPT
+{
+    for (size_t block = 0; block < (R << 1); ++block)
+        for (size_t word = 0; word < block_words; ++word)
+            xrblock[block][word] = set<xWord>(native_from_little_end(
+                array_cast<word_t>((*rblocks[offset + Lane])[block])[word])...);
+}
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE void CLASS::
+unpack(const rblocks_t& rblocks, const xrblock_t<xWord>& xrblock,
+    size_t offset, std::index_sequence<Lane...>) NOEXCEPT
+{
+    for (size_t block = 0; block < (R << 1); ++block)
+        for (size_t word = 0; word < block_words; ++word)
+            ((array_cast<word_t>((*rblocks[offset + Lane])[block])[word] =
+                native_to_little_end(get<word_t, Lane>(
+                    xrblock[block][word]))), ...);
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+inline bool CLASS::
+romix_v_(const rblocks_t& rblocks, size_t offset) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    constexpr auto sequence = std::make_index_sequence<lanes>{};
+
+    // Make a working set of W xrblocks.
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [lanes * (W * (R * 128))] bytes heap allocated.
+    const auto ptr = to_shared<xwrblock_t<xWord>>();
+    if (!ptr) return false;
+    auto& xwrblocks = *ptr;
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    xrblock_t<xWord> xrblock;
+    pack(xrblock, rblocks, offset, sequence);
+
+    for (size_t i = 0; i < W; ++i)
+    {
+        xwrblocks[i] = xrblock;
+        block_mix(xrblock);
+    }
+
+    for (size_t i = 0; i < W; ++i)
+        block_mix(xor_(xrblock, xwrblocks, sequence));
+
+    unpack(rblocks, xrblock, offset, sequence);
+    return true;
+}
+
+TEMPLATE
+inline bool CLASS::
+romix_v(const rblocks_t& rblocks, size_t offset, size_t lanes) NOEXCEPT
+{
+    if constexpr (have_x512)
+        if (lanes == capacity<xint512_t, word_t>)
+            return romix_v_<xint512_t>(rblocks, offset);
+
+    if constexpr (have_x256)
+        if (lanes == capacity<xint256_t, word_t>)
+            return romix_v_<xint256_t>(rblocks, offset);
+
+    if constexpr (have_x128)
+        if (lanes == capacity<xint128_t, word_t>)
+            return romix_v_<xint128_t>(rblocks, offset);
+
+    return false;
+}
+
+TEMPLATE
+inline size_t CLASS::
+lanes(size_t count) NOEXCEPT
+{
+    // Widest available lanes that can be filled.
+    if constexpr (have_x512)
+        if (count >= capacity<xint512_t, word_t> && have<xint512_t>())
+            return capacity<xint512_t, word_t>;
+
+    if constexpr (have_x256)
+        if (count >= capacity<xint256_t, word_t> && have<xint256_t>())
+            return capacity<xint256_t, word_t>;
+
+    if constexpr (have_x128)
+        if (count >= capacity<xint128_t, word_t> && have<xint128_t>())
+            return capacity<xint128_t, word_t>;
+
+    return one;
+}
+
 // public
 // ----------------------------------------------------------------------------
 
@@ -502,12 +746,13 @@ CLASS::hash(data_array<Size>& out, const data_slice& password,
     // 2. for i = 0 to p - 1 do
     //    B[i] = scryptROMix (r, B[i], N)
     // end for
-    std::atomic_bool success{ true };
-    std_for_each(concurrency(), prblocks.begin(), prblocks.end(),
-        [&](rblock_t& rblock) NOEXCEPT
-        {
-            success = success && romix(rblock);
-        });
+    rblocks_t rblocks(P);
+    std::transform(prblocks.begin(), prblocks.end(), rblocks.begin(),
+        [](rblock_t& rblock) NOEXCEPT { return &rblock; });
+
+    // Vectorizing P lanes is limited to concurrent (maximum memory) hashing.
+    if (!romixes(rblocks, Concurrent))
+        return false;
 
     // rfc7914
     // 3. DK = PBKDF2-HMAC-SHA256 (P, B[0] || B[1] || ... || B[p - 1], 1, dkLen)
@@ -525,6 +770,56 @@ CLASS::hash(const data_slice& password, const data_slice& salt) NOEXCEPT
     return out;
 }
 
+TEMPLATE
+template<size_t Size, if_not_greater<Size, scrypt_derivation::maximum_size>>
+bool
+CLASS::hashes(std_vector<data_array<Size>>& out,
+    const std_vector<data_slice>& passwords,
+    const std_vector<data_slice>& salts) NOEXCEPT
+{
+    BC_ASSERT(passwords.size() == salts.size());
+    const auto size = passwords.size();
+
+    // Make a working set of P rblocks for each password.
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    // [size * P * (R * 128)] bytes heap allocated.
+    std_vector<prblock_t> prblocks(size);
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // All blocks of all passwords are romixed as one set (lanes).
+    rblocks_t rblocks{};
+    rblocks.reserve(size * P);
+
+    for (size_t key = 0; key < size; ++key)
+    {
+        auto& bytes = array_cast<uint8_t>(prblocks[key]);
+        scrypt_derivation::key(bytes, passwords[key], salts[key], one);
+        for (auto& rblock: prblocks[key])
+            rblocks.push_back(&rblock);
+    }
+
+    if (!romixes(rblocks, true))
+        return false;
+
+    out.resize(size);
+    for (size_t key = 0; key < size; ++key)
+        scrypt_derivation::key(out[key], passwords[key],
+            array_cast<uint8_t>(prblocks[key]), one);
+
+    return true;
+}
+
+TEMPLATE
+template<size_t Size, if_not_greater<Size, scrypt_derivation::maximum_size>>
+std_vector<data_array<Size>>
+CLASS::hashes(const std_vector<data_slice>& passwords,
+    const std_vector<data_slice>& salts) NOEXCEPT
+{
+    std_vector<data_array<Size>> out{};
+    if (!hashes(out, passwords, salts)) out.clear();
+    return out;
+}
+
 BC_POP_WARNING()
 BC_POP_WARNING()
 BC_POP_WARNING()
@@ -848,6 +848,20 @@ chunk_pad() NOEXCEPT
     return out;
 }
 
+TEMPLATE
+CONSTEVAL typename CLASS::chunk_t CLASS::
+keyed_pad() NOEXCEPT
+{
+    // Half block following one block (an hmac key pad), as in pbkdf2.
+    constexpr auto bytes = possible_narrow_cast<word_t>(array_count<block_t> +
+        array_count<half_t>);
+
+    chunk_t out{};
+    out.front() = bit_hi<word_t>;
+    out.back() = to_bits(bytes);
+    return out;
+}
+
 TEMPLATE
 CONSTEVAL typename CLASS::pad_t CLASS::
 stream_pad() NOEXCEPT
@@ -938,6 +952,15 @@ pad_half(buffer_t& buffer) NOEXCEPT
     }
 }
 
+TEMPLATE
+INLINE void CLASS::
+pad_keyed(buffer_t& buffer) NOEXCEPT
+{
+    // Pad for a half block following one block, unscheduled buffer.
+    constexpr auto pad = keyed_pad();
+    array_cast<word_t, SHA::chunk_words, SHA::chunk_words>(buffer) = pad;
+}
+
 TEMPLATE
 constexpr void CLASS::
 pad_n(buffer_t& buffer, count_t blocks) NOEXCEPT
@@ -1121,6 +1144,13 @@ double_hash(const block_t& block) NOEXCEPT
 {
     static_assert(is_same_type<state_t, chunk_t>);
 
+    if (!std::is_constant_evaluated())
+    {
+        digest_t digest{};
+        if (double_hash_d(digest, block))
+            return digest;
+    }
+
     buffer_t buffer{};
 
     auto state = H::get;
@@ -1197,6 +1227,10 @@ iterate(state_t& state, const ablocks_t<Size>& blocks) NOEXCEPT
     {
         iterate_(state, blocks);
     }
+    else if (compress_d(state, blocks))
+    {
+        return;
+    }
     else if constexpr (vectorization)
     {
         iterate_v(state, blocks);
@@ -1211,7 +1245,11 @@ TEMPLATE
 INLINE void CLASS::
 iterate(state_t& state, iblocks_t& blocks) NOEXCEPT
 {
-    if constexpr (vectorization)
+    if (compress_d(state, blocks))
+    {
+        return;
+    }
+    else if constexpr (vectorization)
     {
         iterate_v(state, blocks);
     }
@@ -1287,6 +1325,10 @@ merkle_hash(digests_t& digests) NOEXCEPT
     {
         merkle_hash_v(digests);
     }
+    else if constexpr (dispatched_merkle)
+    {
+        merkle_hash_(digests, merkle_hash_d(digests));
+    }
     else
     {
         merkle_hash_(digests);
@@ -1306,6 +1348,220 @@ merkle_hash_(digests_t& digests, size_t offset) NOEXCEPT
     digests.resize(blocks);
 }
 
+// Multiple Hashing (sha256/512).
+// ------------------------------------------------------------------------
+// No multiple hashing optimizations for sha160 (double_hash requires half_t).
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+hashes(const messages_t& messages) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+
+    states_t states(messages.size());
+    iterate(states, messages);
+
+    digests_t digests(states.size());
+    std::transform(states.begin(), states.end(), digests.begin(),
+        [](const state_t& state) NOEXCEPT
+        {
+            return output(state);
+        });
+
+    return digests;
+}
+
+TEMPLATE
+typename CLASS::digests_t CLASS::
+double_hashes(const messages_t& messages) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+
+    states_t states(messages.size());
+    iterate(states, messages);
+
+    digests_t digests(states.size());
+    finalize_double(digests, states);
+    return digests;
+}
+
+// Message iteration.
+// ------------------------------------------------------------------------
+// Messages are padded block by block, so are not copied or concatenated.
+
+TEMPLATE
+constexpr size_t CLASS::
+message_blocks(size_t bytes) NOEXCEPT
+{
+    // Message, one pad byte and the counter, in whole blocks.
+    return ceilinged_divide(bytes + add1(count_bytes), array_count<block_t>);
+}
+
+TEMPLATE
+INLINE void CLASS::
+message_block(block_t& block, const data_slice& message, size_t index) NOEXCEPT
+{
+    constexpr auto size = array_count<block_t>;
+    const auto bytes = message.size();
+    const auto start = index * size;
+
+    if (start + size <= bytes)
+    {
+        std::copy_n(std::next(message.data(), start), size, block.data());
+        return;
+    }
+
+    // Partial (or empty) message block, with pad byte if not yet written.
+    const auto remaining = start < bytes ? bytes - start : zero;
+    block.fill(0);
+
+    if (!is_zero(remaining))
+        std::copy_n(std::next(message.data(), start), remaining, block.data());
+
+    if (start <= bytes)
+        block[remaining] = bit_hi<byte_t>;
+
+    // The counter is limited to 64 bits (upper sha512 counter bytes zero).
+    if (add1(index) == message_blocks(bytes))
+        unsafe_to_big_endian(std::next(block.data(), size - sizeof(uint64_t)),
+            to_bits(possible_wide_cast<uint64_t>(bytes)));
+}
+
+TEMPLATE
+INLINE void CLASS::
+iterate(states_t& states, const messages_t& messages) NOEXCEPT
+{
+    BC_ASSERT(states.size() == messages.size());
+
+    if constexpr (vectorization)
+    {
+        iterate_v(states, messages);
+    }
+    else
+    {
+        iterate_(states, messages);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+iterate_(states_t& states, const messages_t& messages, size_t offset) NOEXCEPT
+{
+    buffer_t buffer{};
+    block_t block{};
+
+    for (auto message = offset; message < messages.size(); ++message)
+    {
+        auto& state = states[message];
+        const auto& data = messages[message];
+        const auto blocks = message_blocks(data.size());
+        state = H::get;
+
+        for (size_t index = 0; index < blocks; ++index)
+        {
+            message_block(block, data, index);
+            if (compress_d(state, block))
+                continue;
+
+            input(buffer, block);
+            schedule(buffer);
+            compress(state, buffer);
+        }
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+finalize_double(digests_t& digests, const states_t& states) NOEXCEPT
+{
+    BC_ASSERT(digests.size() == states.size());
+
+    if constexpr (vectorization)
+    {
+        finalize_double_v(digests, states);
+    }
+    else
+    {
+        finalize_double_(digests, states);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+finalize_double_(digests_t& digests, const states_t& states,
+    size_t offset) NOEXCEPT
+{
+    for (auto index = offset; index < states.size(); ++index)
+        digests[index] = hash(states[index]);
+}
+
+// Hmac iteration (sha256/512).
+// ---------------------------------------------------------------------------
+// The hmac of a digest from key pad midstates is two compressions, and the
+// digest and the state share a word representation, so iteration is held
+// entirely in state (or extended state) form.
+
+TEMPLATE
+void CLASS::
+hmac_iterate(digests_t& digests, const states_t& inners,
+    const states_t& outers, size_t count) NOEXCEPT
+{
+    static_assert(is_same_type<state_t, chunk_t>);
+    BC_ASSERT(inners.size() == digests.size());
+    BC_ASSERT(outers.size() == digests.size());
+
+    if constexpr (vectorization)
+    {
+        hmac_iterate_v(digests, inners, outers, count);
+    }
+    else
+    {
+        hmac_iterate_(digests, inners, outers, count);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+iterate_hmac(auto& sum, const auto& inner, const auto& outer, auto& buffer,
+    size_t count) NOEXCEPT
+{
+    auto digest = sum;
+
+    for (size_t c = 2; c <= count; ++c)
+    {
+        // U_c = hmac(outer, hmac(inner, U_c-1))
+        input(buffer, digest);
+        pad_keyed(buffer);
+        schedule(buffer);
+        auto state = inner;
+        compress(state, buffer);
+
+        input(buffer, state);
+        pad_keyed(buffer);
+        schedule(buffer);
+        digest = outer;
+        compress(digest, buffer);
+
+        for (size_t word = 0; word < SHA::state_words; ++word)
+            sum[word] = f::xor_(sum[word], digest[word]);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+hmac_iterate_(digests_t& digests, const states_t& inners,
+    const states_t& outers, size_t count, size_t offset) NOEXCEPT
+{
+    buffer_t buffer{};
+
+    for (auto index = offset; index < digests.size(); ++index)
+    {
+        auto sum = from_big_endians(array_cast<word_t>(digests[index]));
+        iterate_hmac(sum, inners[index], outers[index], buffer, count);
+        digests[index] = output(sum);
+    }
+}
+
 // Streaming (unfinalized).
 // ---------------------------------------------------------------------------
 
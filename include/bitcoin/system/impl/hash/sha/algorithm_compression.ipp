@@ -26,6 +26,71 @@ namespace libbitcoin {
 namespace system {
 namespace sha {
 
+// Runtime dispatch (sha256).
+// ---------------------------------------------------------------------------
+// Kernels are probed once (see sha::dispatch), each call tests the result.
+
+TEMPLATE
+template <size_t Size>
+INLINE bool CLASS::
+compress_d(state_t& state, const ablocks_t<Size>& blocks) NOEXCEPT
+{
+    if constexpr (dispatched && !is_zero(Size))
+        return dispatch::compress(state.data(), blocks.front().data(), Size);
+    else
+        return false;
+}
+
+TEMPLATE
+INLINE bool CLASS::
+compress_d(state_t& state, iblocks_t& blocks) NOEXCEPT
+{
+    if constexpr (dispatched)
+        return dispatch::compress(state.data(), blocks.data(), blocks.size());
+    else
+        return false;
+}
+
+TEMPLATE
+INLINE bool CLASS::
+compress_d(state_t& state, const block_t& block) NOEXCEPT
+{
+    if constexpr (dispatched)
+        return dispatch::compress(state.data(), block.data(), one);
+    else
+        return false;
+}
+
+TEMPLATE
+INLINE bool CLASS::
+double_hash_d(digest_t& digest, const block_t& block) NOEXCEPT
+{
+    if constexpr (dispatched_merkle)
+        return is_one(dispatch::merkle(digest.data(), block.data(), one));
+    else
+        return false;
+}
+
+TEMPLATE
+INLINE size_t CLASS::
+merkle_hash_d(digests_t& digests) NOEXCEPT
+{
+    // Digest pairs are contiguous blocks, hashed in place.
+    if constexpr (dispatched_merkle)
+    {
+        const auto blocks = to_half(digests.size());
+        if (is_zero(blocks))
+            return zero;
+
+        const auto data = digests.front().data();
+        return dispatch::merkle(data, data, blocks);
+    }
+    else
+    {
+        return zero;
+    }
+}
+
 } // namespace sha
 } // namespace system
 } // namespace libbitcoin
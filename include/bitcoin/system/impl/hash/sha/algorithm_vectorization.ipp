@@ -475,6 +475,315 @@ merkle_hash_v(digests_t& digests) NOEXCEPT
     merkle_hash_(digests, offset);
 }
 
+// Multiple Hash.
+// ----------------------------------------------------------------------------
+// Variable length messages are hashed in parallel lanes. A lane is refilled
+// with the next message as its message completes, and lane states are only
+// transposed (unpacked/packed) when at least one lane completes.
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE auto CLASS::
+pack_states(const std_array<state_t, sizeof...(Lane)>& states,
+    std::index_sequence<Lane...>) NOEXCEPT
+{
+    return xstate_t<xWord>
+    {
+        set<xWord>(states[Lane][0]...),
+        set<xWord>(states[Lane][1]...),
+        set<xWord>(states[Lane][2]...),
+        set<xWord>(states[Lane][3]...),
+        set<xWord>(states[Lane][4]...),
+        set<xWord>(states[Lane][5]...),
+        set<xWord>(states[Lane][6]...),
+        set<xWord>(states[Lane][7]...)
+    };
+}
+
+TEMPLATE
+template <typename xWord, size_t... Lane>
+INLINE void CLASS::
+unpack_states(std_array<state_t, sizeof...(Lane)>& states,
+    const xstate_t<xWord>& xstate, std::index_sequence<Lane...>) NOEXCEPT
+{
+    ((states[Lane] = state_t
+    {
+        get<word_t, Lane>(xstate[0]),
+        get<word_t, Lane>(xstate[1]),
+        get<word_t, Lane>(xstate[2]),
+        get<word_t, Lane>(xstate[3]),
+        get<word_t, Lane>(xstate[4]),
+        get<word_t, Lane>(xstate[5]),
+        get<word_t, Lane>(xstate[6]),
+        get<word_t, Lane>(xstate[7])
+    }), ...);
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+iterate_v_(states_t& states, const messages_t& messages,
+    size_t& offset) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    constexpr auto sequence = std::make_index_sequence<lanes>{};
+    static_assert(is_valid_lanes<lanes>);
+
+    if ((messages.size() - offset) < lanes || !have<xWord>())
+        return;
+
+    static auto initial = pack<xWord>(H::get);
+    std_array<size_t, lanes> message{};
+    std_array<size_t, lanes> index{};
+    std_array<size_t, lanes> count{};
+    std_array<state_t, lanes> lane{};
+    ablocks_t<lanes> blocks{};
+    xbuffer_t<xWord> xbuffer;
+    auto xstate = initial;
+    auto full = true;
+
+    for (size_t at = 0; at < lanes; ++at)
+    {
+        message[at] = offset++;
+        count[at] = message_blocks(messages[message[at]].size());
+        lane[at] = H::get;
+    }
+
+    while (full)
+    {
+        for (size_t at = 0; at < lanes; ++at)
+            message_block(blocks[at], messages[message[at]], index[at]++);
+
+        // input() advances block iterator by lanes.
+        auto iblocks = iblocks_t{ array_cast<byte_t>(blocks) };
+        input(xbuffer, iblocks);
+        schedule(xbuffer);
+        compress(xstate, xbuffer);
+
+        auto completed = false;
+        for (size_t at = 0; at < lanes; ++at)
+            completed |= (index[at] == count[at]);
+
+        if (!completed)
+            continue;
+
+        // Save completed lanes and refill them while messages remain.
+        unpack_states(lane, xstate, sequence);
+        for (size_t at = 0; at < lanes; ++at)
+        {
+            if (index[at] != count[at])
+                continue;
+
+            states[message[at]] = lane[at];
+
+            if (offset == messages.size())
+            {
+                full = false;
+                continue;
+            }
+
+            message[at] = offset++;
+            count[at] = message_blocks(messages[message[at]].size());
+            index[at] = zero;
+            lane[at] = H::get;
+        }
+
+        if (full)
+            xstate = pack_states<xWord>(lane, sequence);
+    }
+
+    // Complete rounds of incomplete lanes using normal form.
+    buffer_t buffer{};
+    for (size_t at = 0; at < lanes; ++at)
+    {
+        auto& state = lane[at];
+        const auto& data = messages[message[at]];
+
+        if (index[at] == count[at])
+            continue;
+
+        while (index[at] < count[at])
+        {
+            message_block(blocks[at], data, index[at]++);
+            input(buffer, blocks[at]);
+            schedule(buffer);
+            compress(state, buffer);
+        }
+
+        states[message[at]] = state;
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+iterate_v(states_t& states, const messages_t& messages) NOEXCEPT
+{
+    auto offset = zero;
+
+    if (messages.size() >= min_lanes)
+    {
+        // Message iteration vector dispatch.
+        if constexpr (have_x512)
+            iterate_v_<xint512_t>(states, messages, offset);
+        if constexpr (have_x256)
+            iterate_v_<xint256_t>(states, messages, offset);
+        if constexpr (have_x128)
+            iterate_v_<xint128_t>(states, messages, offset);
+    }
+
+    // Complete rounds using normal form.
+    // offset is increased by vectorization.
+    iterate_(states, messages, offset);
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+finalize_double_v_(digests_t& digests, const states_t& states,
+    size_t& offset) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    constexpr auto sequence = std::make_index_sequence<lanes>{};
+    static_assert(is_valid_lanes<lanes>);
+
+    if ((states.size() - offset) >= lanes && have<xWord>())
+    {
+        static auto initial = pack<xWord>(H::get);
+        const auto size = (digests.size() - offset) * array_count<digest_t>;
+        auto idigests = idigests_t{ size, digests[offset].data() };
+        std_array<state_t, lanes> lane{};
+        xbuffer_t<xWord> xbuffer;
+
+        do
+        {
+            std::copy_n(std::next(states.begin(), offset), lanes, lane.begin());
+
+            // Second hash
+            input(xbuffer, pack_states<xWord>(lane, sequence));
+            pad_half(xbuffer);
+            schedule(xbuffer);
+            auto xstate = initial;
+            compress(xstate, xbuffer);
+
+            // output() advances digest iterator by lanes.
+            output(idigests, xstate);
+            offset += lanes;
+        }
+        while ((states.size() - offset) >= lanes);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+finalize_double_v(digests_t& digests, const states_t& states) NOEXCEPT
+{
+    auto offset = zero;
+
+    if (states.size() >= min_lanes)
+    {
+        // Double hash finalization vector dispatch.
+        if constexpr (have_x512)
+            finalize_double_v_<xint512_t>(digests, states, offset);
+        if constexpr (have_x256)
+            finalize_double_v_<xint256_t>(digests, states, offset);
+        if constexpr (have_x128)
+            finalize_double_v_<xint128_t>(digests, states, offset);
+    }
+
+    // Complete rounds using normal form.
+    // offset is increased by vectorization.
+    finalize_double_(digests, states, offset);
+}
+
+// Hmac Iteration.
+// ----------------------------------------------------------------------------
+// Each lane is a key (inner and outer midstates) and its digest, held in
+// extended form for all iterations, so lanes are only transposed once.
+
+TEMPLATE
+template <typename xWord>
+INLINE void CLASS::
+pad_keyed(xbuffer_t<xWord>& xbuffer) NOEXCEPT
+{
+    constexpr auto pad = keyed_pad();
+    static const xchunk_t<xWord> xkeyed_pad
+    {
+        broadcast<xWord>(pad[0]),
+        broadcast<xWord>(pad[1]),
+        broadcast<xWord>(pad[2]),
+        broadcast<xWord>(pad[3]),
+        broadcast<xWord>(pad[4]),
+        broadcast<xWord>(pad[5]),
+        broadcast<xWord>(pad[6]),
+        broadcast<xWord>(pad[7])
+    };
+
+    array_cast<xWord, SHA::chunk_words, SHA::chunk_words>(xbuffer) =
+        xkeyed_pad;
+}
+
+TEMPLATE
+template <typename xWord, if_extended<xWord>>
+INLINE void CLASS::
+hmac_iterate_v_(digests_t& digests, const states_t& inners,
+    const states_t& outers, size_t count, size_t& offset) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, word_t>;
+    constexpr auto sequence = std::make_index_sequence<lanes>{};
+    static_assert(is_valid_lanes<lanes>);
+
+    if ((digests.size() - offset) >= lanes && have<xWord>())
+    {
+        std_array<state_t, lanes> lane{};
+        xbuffer_t<xWord> xbuffer;
+
+        do
+        {
+            std::copy_n(std::next(inners.begin(), offset), lanes, lane.begin());
+            const auto xinner = pack_states<xWord>(lane, sequence);
+            std::copy_n(std::next(outers.begin(), offset), lanes, lane.begin());
+            const auto xouter = pack_states<xWord>(lane, sequence);
+
+            for (size_t at = 0; at < lanes; ++at)
+                lane[at] = from_big_endians(array_cast<word_t>(
+                    digests[offset + at]));
+
+            auto xsum = pack_states<xWord>(lane, sequence);
+            iterate_hmac(xsum, xinner, xouter, xbuffer, count);
+            unpack_states(lane, xsum, sequence);
+
+            for (size_t at = 0; at < lanes; ++at)
+                digests[offset + at] = output(lane[at]);
+
+            offset += lanes;
+        }
+        while ((digests.size() - offset) >= lanes);
+    }
+}
+
+TEMPLATE
+INLINE void CLASS::
+hmac_iterate_v(digests_t& digests, const states_t& inners,
+    const states_t& outers, size_t count) NOEXCEPT
+{
+    auto offset = zero;
+
+    if (digests.size() >= min_lanes)
+    {
+        // Hmac iteration vector dispatch.
+        if constexpr (have_x512)
+            hmac_iterate_v_<xint512_t>(digests, inners, outers, count, offset);
+        if constexpr (have_x256)
+            hmac_iterate_v_<xint256_t>(digests, inners, outers, count, offset);
+        if constexpr (have_x128)
+            hmac_iterate_v_<xint128_t>(digests, inners, outers, count, offset);
+    }
+
+    // Complete iterations using normal form.
+    // offset is increased by vectorization.
+    hmac_iterate_(digests, inners, outers, count, offset);
+}
+
 // Message Schedule (block vectorization).
 // ----------------------------------------------------------------------------
 // eprint.iacr.org/2012/067.pdf
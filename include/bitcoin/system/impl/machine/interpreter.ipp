@@ -55,8 +55,8 @@ using namespace system::error;
 // Operation handlers.
 // ----------------------------------------------------------------------------
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_unevaluated(opcode code) const NOEXCEPT
 {
     return operation::is_invalid(code) ? error::op_invalid :
@@ -66,8 +66,8 @@ op_unevaluated(opcode code) const NOEXCEPT
 // TODO: nops_rule *must* be enabled in test cases and default config.
 // TODO: cats_rule should be enabled in test cases and default config.
 // Codes op_nop1..op_nop10 promoted from reserved by [0.3.6] hard fork.
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_nop(opcode) const NOEXCEPT
 {
     if (state::is_enabled(forks::nops_rule))
@@ -77,16 +77,16 @@ op_nop(opcode) const NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_push_number(int8_t value) NOEXCEPT
 {
     state::push_signed64(value);
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_push_size(const operation& op) NOEXCEPT
 {
     if (op.is_underclaimed())
@@ -96,8 +96,8 @@ op_push_size(const operation& op) NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_push_one_size(const operation& op) NOEXCEPT
 {
     if (op.is_underclaimed())
@@ -107,8 +107,8 @@ op_push_one_size(const operation& op) NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_push_two_size(const operation& op) NOEXCEPT
 {
     if (op.is_underclaimed())
@@ -118,8 +118,8 @@ op_push_two_size(const operation& op) NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_push_four_size(const operation& op) NOEXCEPT
 {
     if (op.is_underclaimed())
@@ -129,16 +129,16 @@ op_push_four_size(const operation& op) NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_nop() const NOEXCEPT
 {
     return error::op_success;
 }
 
 // This opcode pushed the version to the stack, a hard fork per release.
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_ver() const NOEXCEPT
 {
     if (state::is_enabled(forks::nops_rule))
@@ -147,8 +147,8 @@ op_ver() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_if() NOEXCEPT
 {
     auto value = false;
@@ -158,15 +158,24 @@ op_if() NOEXCEPT
         if (state::is_stack_empty())
             return error::op_if;
 
-        value = state::pop_bool_();
+        // bip342: the argument must be empty or [0x01] in tapscript.
+        if (state::is_tapscript())
+        {
+            if (!state::pop_minimal_bool_(value))
+                return error::op_if;
+        }
+        else
+        {
+            value = state::pop_bool_();
+        }
     }
 
     state::begin_if(value);
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_notif() NOEXCEPT
 {
     auto value = false;
@@ -176,15 +185,26 @@ op_notif() NOEXCEPT
         if (state::is_stack_empty())
             return error::op_notif;
 
-        value = !state::pop_bool_();
+        // bip342: the argument must be empty or [0x01] in tapscript.
+        if (state::is_tapscript())
+        {
+            if (!state::pop_minimal_bool_(value))
+                return error::op_notif;
+
+            value = !value;
+        }
+        else
+        {
+            value = !state::pop_bool_();
+        }
     }
 
     state::begin_if(value);
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_verif() const NOEXCEPT
 {
     if (state::is_enabled(forks::nops_rule))
@@ -193,8 +213,8 @@ op_verif() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_vernotif() const NOEXCEPT
 {
     if (state::is_enabled(forks::nops_rule))
@@ -203,8 +223,8 @@ op_vernotif() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_else() NOEXCEPT
 {
     if (state::is_balanced())
@@ -214,8 +234,8 @@ op_else() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_endif() NOEXCEPT
 {
     if (state::is_balanced())
@@ -225,8 +245,8 @@ op_endif() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_verify() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -239,8 +259,8 @@ op_verify() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_return() const NOEXCEPT
 {
     if (state::is_enabled(forks::nops_rule))
@@ -249,8 +269,8 @@ op_return() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_to_alt_stack() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -260,8 +280,8 @@ op_to_alt_stack() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_from_alt_stack() NOEXCEPT
 {
     if (state::is_alternate_empty())
@@ -271,8 +291,8 @@ op_from_alt_stack() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_drop2() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -284,8 +304,8 @@ op_drop2() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_dup2() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -297,8 +317,8 @@ op_dup2() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_dup3() NOEXCEPT
 {
     if (state::stack_size() < 3)
@@ -311,8 +331,8 @@ op_dup3() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_over2() NOEXCEPT
 {
     if (state::stack_size() < 4)
@@ -324,8 +344,8 @@ op_over2() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_rot2() NOEXCEPT
 {
     if (state::stack_size() < 6)
@@ -340,8 +360,8 @@ op_rot2() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_swap2() NOEXCEPT
 {
     if (state::stack_size() < 4)
@@ -353,8 +373,8 @@ op_swap2() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_if_dup() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -367,8 +387,8 @@ op_if_dup() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_depth() NOEXCEPT
 {
     // [0,1,2] => 3,[0,1,2]
@@ -376,8 +396,8 @@ op_depth() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_drop() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -388,8 +408,8 @@ op_drop() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_dup() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -400,8 +420,8 @@ op_dup() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_nip() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -413,8 +433,8 @@ op_nip() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_over() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -425,8 +445,8 @@ op_over() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_pick() NOEXCEPT
 {
     size_t index;
@@ -451,8 +471,8 @@ op_pick() NOEXCEPT
 // Shifting larger chunks does not change time, as vector stores references.
 // This remains the current satoshi implementation (std::vector).
 // ****************************************************************************
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_roll() NOEXCEPT
 {
     size_t index;
@@ -473,8 +493,8 @@ op_roll() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_rot() NOEXCEPT
 {
     if (state::stack_size() < 3)
@@ -486,8 +506,8 @@ op_rot() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_swap() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -498,8 +518,8 @@ op_swap() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_tuck() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -511,8 +531,8 @@ op_tuck() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_cat() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -521,8 +541,8 @@ op_cat() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_substr() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -531,8 +551,8 @@ op_substr() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_left() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -541,8 +561,8 @@ op_left() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_right() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -551,8 +571,8 @@ op_right() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_size() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -562,8 +582,8 @@ op_size() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_invert() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -572,8 +592,8 @@ op_invert() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_and() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -582,8 +602,8 @@ op_and() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_or() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -592,8 +612,8 @@ op_or() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_xor() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -602,8 +622,8 @@ op_xor() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_equal() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -613,8 +633,8 @@ op_equal() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_equal_verify() NOEXCEPT
 {
     if (state::stack_size() < 2)
@@ -624,8 +644,8 @@ op_equal_verify() NOEXCEPT
         error::op_success : error::op_equal_verify2;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_add1() NOEXCEPT
 {
     int32_t number;
@@ -636,8 +656,8 @@ op_add1() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_sub1() NOEXCEPT
 {
     int32_t number;
@@ -648,8 +668,8 @@ op_sub1() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_mul2() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -658,8 +678,8 @@ op_mul2() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_div2() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -668,8 +688,8 @@ op_div2() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_negate() NOEXCEPT
 {
     int32_t number;
@@ -681,8 +701,8 @@ op_negate() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_abs() NOEXCEPT
 {
     int32_t number;
@@ -694,8 +714,8 @@ op_abs() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_not() NOEXCEPT
 {
     int32_t number;
@@ -707,8 +727,8 @@ op_not() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_nonzero() NOEXCEPT
 {
     int32_t number;
@@ -719,8 +739,8 @@ op_nonzero() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_add() NOEXCEPT
 {
     int32_t right, left;
@@ -732,8 +752,8 @@ op_add() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_sub() NOEXCEPT
 {
     int32_t right, left;
@@ -745,8 +765,8 @@ op_sub() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_mul() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -755,8 +775,8 @@ op_mul() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_div() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -765,8 +785,8 @@ op_div() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_mod() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -775,8 +795,8 @@ op_mod() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_lshift() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -785,8 +805,8 @@ op_lshift() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_rshift() const NOEXCEPT
 {
     if (state::is_enabled(forks::cats_rule))
@@ -795,8 +815,8 @@ op_rshift() const NOEXCEPT
     return error::op_not_implemented;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_bool_and() NOEXCEPT
 {
     int32_t right, left;
@@ -807,8 +827,8 @@ op_bool_and() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_bool_or() NOEXCEPT
 {
     int32_t right, left;
@@ -819,8 +839,8 @@ op_bool_or() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_num_equal() NOEXCEPT
 {
     int32_t right, left;
@@ -831,8 +851,8 @@ op_num_equal() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_num_equal_verify() NOEXCEPT
 {
     int32_t right, left;
@@ -843,8 +863,8 @@ op_num_equal_verify() NOEXCEPT
         error::op_num_equal_verify2;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_num_not_equal() NOEXCEPT
 {
     int32_t right, left;
@@ -855,8 +875,8 @@ op_num_not_equal() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_less_than() NOEXCEPT
 {
     int32_t right, left;
@@ -867,8 +887,8 @@ op_less_than() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_greater_than() NOEXCEPT
 {
     int32_t right, left;
@@ -879,8 +899,8 @@ op_greater_than() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_less_than_or_equal() NOEXCEPT
 {
     int32_t right, left;
@@ -891,8 +911,8 @@ op_less_than_or_equal() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_greater_than_or_equal() NOEXCEPT
 {
     int32_t right, left;
@@ -903,8 +923,8 @@ op_greater_than_or_equal() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_min() NOEXCEPT
 {
     int32_t right, left;
@@ -915,8 +935,8 @@ op_min() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_max() NOEXCEPT
 {
     int32_t right, left;
@@ -927,8 +947,8 @@ op_max() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_within() NOEXCEPT
 {
     int32_t upper, lower, value;
@@ -939,8 +959,8 @@ op_within() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_ripemd160() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -950,8 +970,8 @@ op_ripemd160() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_sha1() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -961,8 +981,8 @@ op_sha1() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_sha256() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -972,8 +992,8 @@ op_sha256() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_hash160() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -983,8 +1003,8 @@ op_hash160() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_hash256() NOEXCEPT
 {
     if (state::is_stack_empty())
@@ -994,8 +1014,8 @@ op_hash256() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_codeseparator(const op_iterator& op) NOEXCEPT
 {
     // Not thread safe for the script (changes script object metadata).
@@ -1003,10 +1023,62 @@ op_codeseparator(const op_iterator& op) NOEXCEPT
         error::op_code_separator;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+// bip342: an empty key fails, an empty signature is false (without cost), a
+// non-empty signature consumes budget and must be valid for an x-only key, and
+// is presumed valid for any other key size (reserved for future upgrade).
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
+op_check_schnorr_sig(bool& valid, const chunk_xptr& key,
+    const chunk_xptr& endorsement) NOEXCEPT
+{
+    if (key->empty())
+        return error::op_check_schnorr_sig2;
+
+    valid = !endorsement->empty();
+    if (!valid)
+        return error::op_success;
+
+    if (!state::budget_decrement())
+        return error::op_check_schnorr_sig3;
+
+    if (key->size() != ec_xonly_size)
+        return error::op_success;
+
+    hash_digest hash;
+    ec_signature sig;
+
+    // Parse endorsement into schnorr signature and sighash flags.
+    // Also generates taproot signature hash from sighash flags.
+    if (!state::prepare(sig, hash, *endorsement))
+        return error::op_check_schnorr_sig4;
+
+    Profiler::sighashed();
+
+    Profiler::verified();
+    return state::verify_schnorr(*key, hash, sig) ? error::op_success :
+        error::op_check_schnorr_sig5;
+}
+
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_check_sig() NOEXCEPT
 {
+    // bip342: a failed non-empty signature fails the tapscript.
+    if (state::is_tapscript())
+    {
+        if (state::stack_size() < 2)
+            return error::op_check_schnorr_sig1;
+
+        op_error_t ec;
+        auto valid = false;
+        const auto key = state::pop_chunk_();
+        if ((ec = op_check_schnorr_sig(valid, key, state::pop_chunk_())))
+            return ec;
+
+        state::push_bool(valid);
+        return error::op_success;
+    }
+
     const auto verify = op_check_sig_verify();
     const auto bip66 = state::is_enabled(forks::bip66_rule);
 
@@ -1021,10 +1093,25 @@ op_check_sig() NOEXCEPT
 // In signing mode, prepare_signature converts key from a private key to
 // a public key and generates the signature from key and hash. The signature is
 // then verified against the key and hash as if obtained from the script.
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_check_sig_verify() NOEXCEPT
 {
+    if (state::is_tapscript())
+    {
+        if (state::stack_size() < 2)
+            return error::op_check_schnorr_sig1;
+
+        op_error_t ec;
+        auto valid = false;
+        const auto key = state::pop_chunk_();
+        if ((ec = op_check_schnorr_sig(valid, key, state::pop_chunk_())))
+            return ec;
+
+        return valid ? error::op_success :
+            error::op_check_schnorr_sig_verify;
+    }
+
     if (state::stack_size() < 2)
         return error::op_check_sig_verify1;
 
@@ -1048,15 +1135,48 @@ op_check_sig_verify() NOEXCEPT
     if (!state::prepare(sig, *key, hash, endorsement))
         return error::op_check_sig_verify_parse;
 
+    Profiler::sighashed();
+
     // TODO: for signing mode - make key mutable and return above.
-    return system::verify_signature(*key, hash, sig) ?
+    Profiler::verified();
+    return state::verify_signature(*key, hash, sig) ?
         error::op_success : error::op_check_sig_verify4;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+// bip342: stack order is <signature> <number> <key>, key on top.
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
+op_check_sig_add() NOEXCEPT
+{
+    // bip342: reserved_186 subsumed by op_checksigadd in tapscript only.
+    if (!state::is_tapscript())
+        return op_unevaluated(opcode::reserved_186);
+
+    if (state::stack_size() < 3)
+        return error::op_check_sig_add1;
+
+    int32_t number;
+    const auto key = state::pop_chunk_();
+    if (!state::pop_signed32(number))
+        return error::op_check_sig_add2;
+
+    op_error_t ec;
+    auto valid = false;
+    if ((ec = op_check_schnorr_sig(valid, key, state::pop_chunk_())))
+        return ec;
+
+    state::push_signed64(valid ? add1<int64_t>(number) : number);
+    return error::op_success;
+}
+
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_check_multisig() NOEXCEPT
 {
+    // bip342: op_checkmultisig is disabled in tapscript.
+    if (state::is_tapscript())
+        return error::op_check_multisig_tapscript;
+
     const auto verify = op_check_multisig_verify();
     const auto bip66 = state::is_enabled(forks::bip66_rule);
 
@@ -1068,10 +1188,14 @@ op_check_multisig() NOEXCEPT
     return error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_check_multisig_verify() NOEXCEPT
 {
+    // bip342: op_checkmultisigverify is disabled in tapscript.
+    if (state::is_tapscript())
+        return error::op_check_multisig_tapscript;
+
     const auto bip147 = state::is_enabled(forks::bip147_rule);
 
     size_t count;
@@ -1131,15 +1255,24 @@ op_check_multisig_verify() NOEXCEPT
         {
             // Parse endorsement into DER signature into an EC signature.
             // Also generates signature hash from endorsement sighash flags.
+            const auto hashes = cache.size();
             if (!state::prepare(sig, *key, cache, flags, **endorsement, *sub))
                 return error::op_check_multisig_verify_parse;
 
+            // Signature hashes are cached by flags, so count only new hashes.
+            if (cache.size() != hashes)
+                Profiler::sighashed();
+
             BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
             const auto& hash = cache.at(flags);
             BC_POP_WARNING()
 
+            // Matching of endorsements to keys depends on each result, so a
+            // deferred (assumed valid) result would pair endorsements with
+            // the wrong keys. Multisig signatures are always verified here.
             // TODO: for signing mode - make key mutable and return above.
-            if (system::verify_signature(*key, hash, sig))
+            Profiler::verified();
+            if (state::verify_signature(*key, hash, sig, nullptr))
                 ++endorsement;
         }
     }
@@ -1148,8 +1281,8 @@ op_check_multisig_verify() NOEXCEPT
         error::op_check_multisig_verify10 : error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_check_locktime_verify() const NOEXCEPT
 {
     // BIP65: nop2 subsumed by checklocktimeverify when bip65 fork is active.
@@ -1180,8 +1313,8 @@ op_check_locktime_verify() const NOEXCEPT
         error::op_check_locktime_verify4 : error::op_success;
 }
 
-template <typename Stack>
-inline op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+inline op_error_t interpreter<Stack, Profiler>::
 op_check_sequence_verify() const NOEXCEPT
 {
     // BIP112: nop3 subsumed by checksequenceverify when bip112 fork is active.
@@ -1228,8 +1361,8 @@ op_check_sequence_verify() const NOEXCEPT
 // It is expected that the compiler will produce a very efficient jump table.
 
 // private:
-template <typename Stack>
-op_error_t interpreter<Stack>::
+template <typename Stack, typename Profiler>
+op_error_t interpreter<Stack, Profiler>::
 run_op(const op_iterator& op) NOEXCEPT
 {
     const auto code = op->code();
@@ -1528,6 +1661,8 @@ run_op(const op_iterator& op) NOEXCEPT
         case opcode::nop9:
         case opcode::nop10:
             return op_nop(code);
+        case opcode::reserved_186:
+            return op_check_sig_add();
         default:
             return op_unevaluated(code);
     }
@@ -1536,12 +1671,13 @@ run_op(const op_iterator& op) NOEXCEPT
 // Run the program.
 // ----------------------------------------------------------------------------
 
-template <typename Stack>
-code interpreter<Stack>::
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::
 run() NOEXCEPT
 {
     error::op_error_t operation_ec;
     error::script_error_t script_ec;
+    const typename Profiler::scope profiled{};
 
     // Enforce script size limit (10,000) [0.3.7+].
     // Enforce initial primary stack size limit (520) [bip141].
@@ -1549,6 +1685,32 @@ run() NOEXCEPT
     if ((script_ec = state::validate()))
         return script_ec;
 
+    // Push-only scripts (precomputed) are common to most input scripts. These
+    // have no conditionals, invalid or counted ops, so those checks are moot.
+    if (state::is_push_only())
+    {
+        for (auto it = state::begin(); it != state::end(); ++it)
+        {
+            // Rule imposed by [0.3.6] soft fork.
+            if (it->is_oversized())
+                return error::invalid_push_data_size;
+
+            // Evaluate opcode (switch).
+            const auto start = Profiler::start();
+            operation_ec = run_op(it);
+            Profiler::executed(it->code(), start);
+            if (operation_ec)
+                return operation_ec;
+
+            // Enforce combined stacks size limit (1,000).
+            Profiler::stacked(state::stack_size());
+            if (state::is_stack_overflow())
+                return error::invalid_stack_size;
+        }
+
+        return error::script_success;
+    }
+
     for (auto it = state::begin(); it != state::end(); ++it)
     {
         // An iterator is required only for run_op:op_codeseparator.
@@ -1570,10 +1732,14 @@ run() NOEXCEPT
         if (state::if_(op))
         {
             // Evaluate opcode (switch).
-            if ((operation_ec = run_op(it)))
+            const auto start = Profiler::start();
+            operation_ec = run_op(it);
+            Profiler::executed(it->code(), start);
+            if (operation_ec)
                 return operation_ec;
 
             // Enforce combined stacks size limit (1,000).
+            Profiler::stacked(state::stack_size());
             if (state::is_stack_overflow())
                 return error::invalid_stack_size;
         }
@@ -1584,8 +1750,8 @@ run() NOEXCEPT
         error::invalid_stack_scope;
 }
 
-template <typename Stack>
-code interpreter<Stack>::
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::
 connect(const context& state, const transaction& tx, uint32_t index) NOEXCEPT
 {
     if (index >= tx.inputs_ptr()->size())
@@ -1594,12 +1760,32 @@ connect(const context& state, const transaction& tx, uint32_t index) NOEXCEPT
     return connect(state, tx, std::next(tx.inputs_ptr()->begin(), index));
 }
 
-// TODO: Implement original op_codeseparator concatenation [< 0.3.6].
-// TODO: Implement combined script size limit soft fork (20,000) [0.3.6+].
-template <typename Stack>
-code interpreter<Stack>::
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::
 connect(const context& state, const transaction& tx,
     const input_iterator& it) NOEXCEPT
+{
+    // Standard templates are proven without program evaluation.
+    return connect_standard(state, tx, it, nullptr) ? error::script_success :
+        connect_scripts(state, tx, it, nullptr);
+}
+
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::
+connect(const context& state, const transaction& tx,
+    const input_iterator& it, ec_signature_checks& checks) NOEXCEPT
+{
+    // Standard templates are proven without program evaluation.
+    return connect_standard(state, tx, it, &checks) ? error::script_success :
+        connect_scripts(state, tx, it, &checks);
+}
+
+// TODO: Implement original op_codeseparator concatenation [< 0.3.6].
+// TODO: Implement combined script size limit soft fork (20,000) [0.3.6+].
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::
+connect_scripts(const context& state, const transaction& tx,
+    const input_iterator& it, ec_signature_checks* checks) NOEXCEPT
 {
     code ec;
     const auto& input = **it;
@@ -1607,7 +1793,7 @@ connect(const context& state, const transaction& tx,
         return error::missing_previous_output;
 
     // Evaluate input script.
-    interpreter in_program(tx, it, state.forks);
+    interpreter in_program(tx, it, state.forks, checks);
     if ((ec = in_program.run()))
         return ec;
 
@@ -1625,7 +1811,7 @@ connect(const context& state, const transaction& tx,
     else if (prevout->is_pay_to_script_hash(state.forks))
     {
         // Because output script pushed script hash program (bip16).
-        if ((ec = connect_embedded(state, tx, it, in_program)))
+        if ((ec = connect_embedded(state, tx, it, in_program, checks)))
             return ec;
     }
     else if (prevout->is_pay_to_witness(state.forks))
@@ -1635,7 +1821,7 @@ connect(const context& state, const transaction& tx,
             return error::dirty_witness;
 
         // Because output script pushed version and witness program (bip141).
-        if ((ec = connect_witness(state, tx, it, *prevout)))
+        if ((ec = connect_witness(state, tx, it, *prevout, checks)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -1650,13 +1836,14 @@ connect(const context& state, const transaction& tx,
 BC_PUSH_WARNING(NO_NEW_OR_DELETE)
 BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
-template <typename Stack>
-code interpreter<Stack>::connect_embedded(const context& state,
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::connect_embedded(const context& state,
     const transaction& tx, const input_iterator& it,
-    interpreter& in_program) NOEXCEPT
+    interpreter& in_program, ec_signature_checks* checks) NOEXCEPT
 {
     code ec;
     const auto& input = **it;
+    const typename Profiler::embedded profiled{};
 
     // Input script is limited to relaxed push data operations (bip16).
     if (!script::is_relaxed_push(input.script().ops()))
@@ -1680,8 +1867,12 @@ code interpreter<Stack>::connect_embedded(const context& state,
         if (input.script().ops().size() != one)
             return error::dirty_witness;
 
+        // Taproot rules do not apply to p2sh-wrapped version one (bip341).
+        if (prevout->version() == script_version::taproot)
+            return error::script_success;
+
         // Because output script pushed version/witness program (bip141).
-        if ((ec = connect_witness(state, tx, it, *prevout)))
+        if ((ec = connect_witness(state, tx, it, *prevout, checks)))
             return ec;
     }
     else if (!input.witness().stack().empty())
@@ -1696,13 +1887,14 @@ code interpreter<Stack>::connect_embedded(const context& state,
 BC_POP_WARNING()
 BC_POP_WARNING()
 
-template <typename Stack>
-code interpreter<Stack>::connect_witness(const context &state,
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::connect_witness(const context &state,
     const transaction& tx, const input_iterator& it,
-    const script& prevout) NOEXCEPT
+    const script& prevout, ec_signature_checks* checks) NOEXCEPT
 {
     const auto& input = **it;
     const auto version = prevout.version();
+    const typename Profiler::embedded profiled{};
 
     switch (version)
     {
@@ -1716,7 +1908,8 @@ code interpreter<Stack>::connect_witness(const context &state,
                 return error::invalid_witness;
 
             // A defined version indicates bip141 is active.
-            interpreter program(tx, it, script, state.forks, version, stack);
+            interpreter program(tx, it, script, state.forks, version, stack,
+                checks);
             if ((ec = program.run()))
                 return ec;
 
@@ -1725,6 +1918,10 @@ code interpreter<Stack>::connect_witness(const context &state,
                 error::stack_false;
         }
 
+        // Version one with a 32 byte program is taproot (bip341).
+        case script_version::taproot:
+            return connect_taproot_witness(state, tx, it, prevout, checks);
+
         // These versions are reserved for future extensions (bip141).
         case script_version::reserved:
             return error::script_success;
@@ -1735,6 +1932,321 @@ code interpreter<Stack>::connect_witness(const context &state,
     }
 }
 
+template <typename Stack, typename Profiler>
+code interpreter<Stack, Profiler>::connect_taproot_witness(const context& state,
+    const transaction& tx, const input_iterator& it, const script& prevout,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    // Without bip341 version one is reserved for future extensions (bip141).
+    if (!script::is_enabled(state.forks, forks::bip341_rule))
+        return error::script_success;
+
+    const auto& input = **it;
+    const auto& stack = input.witness().stack();
+    const auto& program = prevout.ops().back().data();
+
+    // The witness stack must consist of at least one element (bip341).
+    if (stack.empty())
+        return error::invalid_witness;
+
+    // The annex, if present, is removed from the stack (bip341).
+    const auto annexed = witness::is_annex_pattern(stack);
+    const auto annex = annexed ? stack.back() : chunk_cptr{};
+    const auto size = annexed ? sub1(stack.size()) : stack.size();
+
+    // Key path spend, the one element is a signature for the program (bip341).
+    if (size == one)
+        return check_key_path(tx, it, program, *stack.front(), annex, checks) ?
+            error::script_success : error::invalid_schnorr_signature;
+
+    // Script path spend, the control block is last and the script next.
+    const auto& control = *stack.at(sub1(size));
+    const auto& leaf_script = *stack.at(size - two);
+    const auto path = floored_subtract(control.size(),
+        taproot_control_base_size);
+
+    // The control block is the internal key and up to 128 path nodes.
+    if (control.size() < taproot_control_base_size ||
+        !is_zero(path % taproot_control_node_size) ||
+        (path / taproot_control_node_size) > taproot_max_path)
+        return error::invalid_control_block;
+
+    // The leaf must be committed to by the program (bip341).
+    const auto version = bit_and(control.front(), taproot_leaf_mask);
+    const auto leaf = tapleaf_hash(version, leaf_script);
+    if (!check_commitment(program, control, leaf))
+        return error::invalid_taproot_commitment;
+
+    // Other leaf versions are reserved for future extensions (bip341).
+    if (version != tapscript_leaf_version ||
+        !script::is_enabled(state.forks, forks::bip342_rule))
+        return error::script_success;
+
+    // Any success code causes success, unless preceded by an underflow.
+    const auto script = to_shared<chain::script>(leaf_script, false);
+    for (const auto& op: script->ops())
+    {
+        if (op.is_underflow())
+            return error::invalid_script;
+
+        if (op.is_success())
+            return error::script_success;
+    }
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto initial = std::make_shared<chunk_cptrs>(stack.begin(),
+        std::next(stack.begin(), size - two));
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    code ec;
+    interpreter tapscript(tx, it, script, state.forks, initial, leaf, annex,
+        checks);
+    if ((ec = tapscript.run()))
+        return ec;
+
+    // A tapscript must succeed with a clean true stack (bip342).
+    return tapscript.is_true(true) ? error::script_success :
+        error::stack_false;
+}
+
+// static
+// The leaf hash commits to leaf version and prefixed script (bip341).
+template <typename Stack, typename Profiler>
+hash_digest interpreter<Stack, Profiler>::tapleaf_hash(uint8_t version,
+    const data_chunk& script) NOEXCEPT
+{
+    data_chunk preimage(add1(variable_size(script.size())) + script.size());
+    write::bytes::copy sink(preimage);
+    sink.write_byte(version);
+    sink.write_variable(script.size());
+    sink.write_bytes(script);
+    return tagged_hash("TapLeaf", preimage);
+}
+
+// static
+// The program is the internal key tweaked by the merkle root of the leaf
+// and path, where each branch hashes the lesser node first (bip341).
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::check_commitment(const data_chunk& program,
+    const data_chunk& control, const hash_digest& tapleaf) NOEXCEPT
+{
+    const auto start = std::next(control.begin());
+    const auto path = std::next(control.begin(), taproot_control_base_size);
+    const auto internal = to_array<ec_xonly_size>({ start, path });
+
+    auto root = tapleaf;
+    for (auto node = path; node != control.end();
+        std::advance(node, taproot_control_node_size))
+    {
+        const auto sibling = to_array<hash_size>(
+            { node, std::next(node, taproot_control_node_size) });
+
+        root = root < sibling ?
+            tagged_hash("TapBranch", splice(root, sibling)) :
+            tagged_hash("TapBranch", splice(sibling, root));
+    }
+
+    const auto tweak = tagged_hash("TapTweak", splice(internal, root));
+    const auto odd = to_bool(bit_and<uint8_t>(control.front(), 0x01));
+    return schnorr::verify_tweak(program, odd, internal, tweak);
+}
+
+// static
+// The key path signature hash has no leaf or code separator (bip341).
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::check_key_path(const transaction& tx,
+    const input_iterator& it, const data_chunk& program,
+    const data_chunk& endorsement, const chunk_cptr& annex,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    uint8_t flags;
+    hash_digest sighash;
+    ec_signature signature;
+    const auto slice = annex ? data_slice{ *annex } : data_slice{};
+
+    if (!state::parse_schnorr(signature, flags, endorsement))
+        return false;
+
+    if (!tx.signature_hash(sighash, it, flags, slice, nullptr,
+        tapscript_no_separator))
+        return false;
+
+    Profiler::sighashed();
+
+    Profiler::verified();
+    return state::verify_schnorr(program, sighash, signature, checks);
+}
+
+// Standard templates.
+// ----------------------------------------------------------------------------
+// The common templates are proven successful without program construction or
+// stack evaluation. A false result does not imply failure, only that success
+// was not proven, in which case generic evaluation determines the result. So
+// all results (including error codes) are identical to generic evaluation.
+// The cost is repeated signature parse/verify for failed template spends.
+
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::connect_standard(const context& state,
+    const transaction& tx, const input_iterator& it,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    const auto& input = **it;
+    if (!input.prevout)
+        return false;
+
+    switch (input.prevout->script().common_pattern())
+    {
+        case script_pattern::pay_key_hash:
+            return connect_key_hash(state, tx, it, checks);
+        case script_pattern::pay_witness_key_hash:
+            return connect_witness_key_hash(state, tx, it, checks);
+        case script_pattern::pay_taproot:
+            return connect_taproot(state, tx, it, checks);
+        default:
+            return false;
+    }
+}
+
+// input script  : <signature> <public-key>
+// output script : dup hash160 <20-byte-hash-of-public-key> equalverify checksig
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::connect_key_hash(const context& state,
+    const transaction& tx, const input_iterator& it,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    const auto& input = **it;
+    const auto& prevout = input.prevout->script();
+    const auto& ops = input.script().ops();
+
+    // A non-witness program must have empty witness field (bip141).
+    if (!input.witness().stack().empty() || input.script().is_prefail() ||
+        ops.size() != two)
+        return false;
+
+    const auto& endorsement = ops.front();
+    const auto& key = ops.back();
+
+    // Payload pushes only, each validated as in op_push_size (and variants).
+    if (!endorsement.is_payload() || endorsement.is_underclaimed() ||
+        endorsement.is_oversized() || !key.is_payload() ||
+        key.is_underclaimed() || key.is_oversized())
+        return false;
+
+    // Endorsement stripping from the subscript is possible only when the
+    // endorsement matches the hash push, otherwise the subscript is prevout.
+    if (endorsement.data().size() == short_hash_size)
+        return false;
+
+    // Unversioned signature hashing does not use the value (max_uint64).
+    return check_key_hash(tx, it, prevout, max_uint64,
+        script_version::unversioned, state.forks, prevout.ops()[2].data(),
+        endorsement.data(), key.data(), checks);
+}
+
+// witness stack : <signature> <public-key>
+// input script  : (empty)
+// output script : <0> <20-byte-hash-of-public-key>
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::connect_witness_key_hash(const context& state,
+    const transaction& tx, const input_iterator& it,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    const auto& input = **it;
+    const auto& prevout = input.prevout->script();
+    const auto& stack = input.witness().stack();
+    const auto& program = prevout.ops().back().data();
+
+    // Without bip143 the subscript is subject to endorsement stripping.
+    if (!prevout.is_pay_to_witness(state.forks) ||
+        !script::is_enabled(state.forks, forks::bip143_rule) ||
+        !input.script().ops().empty() || stack.size() != two ||
+        !witness::is_push_size(stack) ||
+        !number::boolean::from_chunk(program))
+        return false;
+
+    // The subscript is the pay-to-key-hash script of the program (bip143).
+    const script sub
+    {
+        script::to_pay_key_hash_pattern(to_array<short_hash_size>(program))
+    };
+
+    return check_key_hash(tx, it, sub, input.prevout->value(),
+        script_version::zero, state.forks, program, *stack.front(),
+        *stack.back(), checks);
+}
+
+// witness stack : <signature> [annex]
+// input script  : (empty)
+// output script : <1> <32-byte-public-key>
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::connect_taproot(const context& state,
+    const transaction& tx, const input_iterator& it,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    const auto& input = **it;
+    const auto& prevout = input.prevout->script();
+    const auto& program = prevout.ops().back().data();
+
+    if (!prevout.is_pay_to_witness(state.forks) ||
+        !input.script().ops().empty())
+        return false;
+
+    // Without bip341 version one is reserved for future extensions (bip141),
+    // so a true program with an empty input script is unencumbered.
+    if (!script::is_enabled(state.forks, forks::bip341_rule))
+        return number::boolean::from_chunk(program);
+
+    // Only the key path is proven here, script path is evaluated (bip341).
+    const auto& stack = input.witness().stack();
+    const auto annexed = witness::is_annex_pattern(stack);
+    if (stack.size() != (annexed ? two : one))
+        return false;
+
+    const auto annex = annexed ? stack.back() : chunk_cptr{};
+    return check_key_path(tx, it, program, *stack.front(), annex, checks);
+}
+
+// Evaluates dup hash160 <short_hash> equalverify checksig over a stack of
+// <endorsement> <key>, true only if the result is a single true element.
+template <typename Stack, typename Profiler>
+bool interpreter<Stack, Profiler>::check_key_hash(const transaction& tx,
+    const input_iterator& it, const script& sub, uint64_t value,
+    script_version version, uint32_t forks, const data_chunk& short_hash,
+    const data_chunk& endorsement, const data_chunk& key,
+    ec_signature_checks* checks) NOEXCEPT
+{
+    // op_check_sig fails on empty key or endorsement.
+    if (key.empty() || endorsement.empty())
+        return false;
+
+    // op_equal_verify (hash160 of the public key must match).
+    const auto hash = bitcoin_short_hash(key);
+    if (!std::equal(hash.begin(), hash.end(), short_hash.begin(),
+        short_hash.end()))
+        return false;
+
+    uint8_t flags;
+    ec_signature signature;
+    data_slice distinguished;
+
+    // Parse DER signature into an EC signature (bip66 sets strict).
+    const auto bip66 = script::is_enabled(forks, forks::bip66_rule);
+    if (!parse_endorsement(flags, distinguished, endorsement) ||
+        !parse_signature(signature, distinguished, bip66))
+        return false;
+
+    // bip143: the method of signature hashing is changed for v0 scripts.
+    const auto bip143 = script::is_enabled(forks, forks::bip143_rule);
+    const auto sighash = tx.signature_hash(it, sub, value, flags, version,
+        bip143);
+    Profiler::sighashed();
+
+    Profiler::verified();
+    return state::verify_signature(key, sighash, signature, checks);
+}
+
 } // namespace machine
 } // namespace system
 } // namespace libbitcoin
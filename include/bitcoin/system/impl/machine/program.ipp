@@ -45,7 +45,7 @@ using namespace system::error;
 template <typename Stack>
 inline program<Stack>::
 program(const chain::transaction& tx, const input_iterator& input,
-     uint32_t forks) NOEXCEPT
+     uint32_t forks, ec_signature_checks* checks) NOEXCEPT
   : transaction_(tx),
     input_(input),
     script_((*input)->script_ptr()),
@@ -53,6 +53,7 @@ program(const chain::transaction& tx, const input_iterator& input,
     value_(max_uint64),
     version_(script_version::unversioned),
     witness_(),
+    checks_(checks),
     primary_()
 {
 }
@@ -71,6 +72,7 @@ program(const program& other, const script::cptr& script) NOEXCEPT
     value_(other.value_),
     version_(other.version_),
     witness_(),
+    checks_(other.checks_),
     primary_(other.primary_)
 {
 }
@@ -86,6 +88,7 @@ program(program&& other, const script::cptr& script) NOEXCEPT
     value_(other.value_),
     version_(other.version_),
     witness_(),
+    checks_(other.checks_),
     primary_(std::move(other.primary_))
 {
 }
@@ -98,7 +101,7 @@ template <typename Stack>
 inline program<Stack>::
 program(const chain::transaction& tx, const input_iterator& input,
     const script::cptr& script, uint32_t forks, script_version version,
-    const chunk_cptrs_ptr& witness) NOEXCEPT
+    const chunk_cptrs_ptr& witness, ec_signature_checks* checks) NOEXCEPT
   : transaction_(tx),
     input_(input),
     script_(script),
@@ -106,10 +109,37 @@ program(const chain::transaction& tx, const input_iterator& input,
     value_((*input)->prevout->value()),
     version_(version),
     witness_(witness),
+    checks_(checks),
     primary_(projection<Stack>(*witness))
 {
 }
 
+// Tapscript run (witness-initialized stack, bip342).
+// As with witness script run, but also retains the leaf hash and annex for
+// signature hashing. The signature operation budget is 50 plus the serialized
+// size of the witness (including the script, control block and annex).
+template <typename Stack>
+inline program<Stack>::
+program(const chain::transaction& tx, const input_iterator& input,
+    const script::cptr& script, uint32_t forks,
+    const chunk_cptrs_ptr& witness, const hash_digest& tapleaf,
+    const chunk_cptr& annex, ec_signature_checks* checks) NOEXCEPT
+  : transaction_(tx),
+    input_(input),
+    script_(script),
+    forks_(forks),
+    value_((*input)->prevout->value()),
+    version_(script_version::taproot),
+    witness_(witness),
+    checks_(checks),
+    tapleaf_(tapleaf),
+    annex_(annex),
+    primary_(projection<Stack>(*witness)),
+    budget_(tapscript_budget_offset + possible_narrow_sign_cast<int64_t>(
+        (*input)->witness().serialized_size(true)))
+{
+}
+
 // Public.
 // ----------------------------------------------------------------------------
 
@@ -140,6 +170,13 @@ is_prefail() const NOEXCEPT
     return script_->is_prefail();
 }
 
+template <typename Stack>
+INLINE bool program<Stack>::
+is_push_only() const NOEXCEPT
+{
+    return script_->is_push_only();
+}
+
 template <typename Stack>
 INLINE typename program<Stack>::op_iterator program<Stack>::
 begin() const NOEXCEPT
@@ -175,6 +212,13 @@ is_enabled(chain::forks rule) const NOEXCEPT
     return to_bool(forks_ & rule);
 }
 
+template <typename Stack>
+INLINE bool program<Stack>::
+is_tapscript() const NOEXCEPT
+{
+    return version_ == script_version::taproot;
+}
+
 // TODO: only perform is_push_size check on witness initialized stack.
 // TODO: others are either empty or presumed push_size from prevout script run.
 template <typename Stack>
@@ -192,6 +236,11 @@ validate() const NOEXCEPT
     if (bip141 && witness_ && !witness::is_push_size(*witness_))
         return error::invalid_witness_stack;
 
+    // bip342: script size is unlimited, but initial stack size is limited.
+    if (is_tapscript())
+        return is_stack_overflow() ? error::invalid_stack_size :
+            error::script_success;
+
     // The nops_rule establishes script size limit.
     return script_->is_oversized() ? error::invalid_script_size :
         error::script_success;
@@ -324,6 +373,19 @@ pop_strict_bool_() NOEXCEPT
     return value;
 }
 
+// ****************************************************************************
+// CONSENSUS: tapscript op_if/op_notif require an empty or [0x01] argument.
+// This tethers a chunk if the stack value is not chunk (tapscript only).
+// ****************************************************************************
+template <typename Stack>
+INLINE bool program<Stack>::
+pop_minimal_bool_(bool& value) NOEXCEPT
+{
+    const auto chunk = pop_chunk_();
+    value = !chunk->empty();
+    return !value || (chunk->size() == one && chunk->front() == 0x01);
+}
+
 // private
 template <typename Stack>
 INLINE bool program<Stack>::
@@ -666,6 +728,10 @@ template <typename Stack>
 INLINE bool program<Stack>::
 ops_increment(const operation& op) NOEXCEPT
 {
+    // bip342: the operation count limit does not apply to tapscript.
+    if (is_tapscript())
+        return true;
+
     // Addition is safe due to script size constraint.
     BC_ASSERT(!is_add_overflow(operation_count_, one));
 
@@ -686,6 +752,16 @@ ops_increment(size_t public_keys) NOEXCEPT
     return !operation_count_exceeded(operation_count_);
 }
 
+// bip342: each non-empty signature checked consumes 50 units of budget.
+template <typename Stack>
+INLINE bool program<Stack>::
+budget_decrement() NOEXCEPT
+{
+    // Subtraction is safe as budget is bounded by witness size.
+    budget_ -= tapscript_sigops_cost;
+    return !is_negative(budget_);
+}
+
 // Signature validation helpers.
 // ----------------------------------------------------------------------------
 
@@ -794,6 +870,131 @@ prepare(ec_signature& signature, const data_chunk&, hash_cache& cache,
     return parse_signature(signature, distinguished, bip66);
 }
 
+// Tapscript signature hash (bip342), the key is not required to prepare the
+// schnorr signature, as x-only keys are parsed upon verification.
+template <typename Stack>
+inline bool program<Stack>::
+prepare(ec_signature& signature, hash_digest& hash,
+    const data_chunk& endorsement) const NOEXCEPT
+{
+    uint8_t flags;
+    if (!parse_schnorr(signature, flags, endorsement))
+        return false;
+
+    // The position of the last executed code separator, or max_uint32.
+    const auto begin = script_->ops().begin();
+    const op_iterator offset{ script_->offset };
+    const auto separator = (offset == begin) ? tapscript_no_separator :
+        possible_narrow_and_sign_cast<uint32_t>(
+            sub1(std::distance(begin, offset)));
+
+    // Undefined flags and hash_single without corresponding output fail.
+    const auto annex = annex_ ? data_slice{ *annex_ } : data_slice{};
+    return transaction_.signature_hash(hash, input_, flags, annex, &tapleaf_,
+        separator);
+}
+
+// static
+// A 64 byte signature implies hash_default, a 65 byte signature has explicit
+// flags, which may not be hash_default (bip341).
+template <typename Stack>
+inline bool program<Stack>::
+parse_schnorr(ec_signature& signature, uint8_t& flags,
+    const data_chunk& endorsement) NOEXCEPT
+{
+    const auto size = endorsement.size();
+    if (size != taproot_signature_size &&
+        size != add1(taproot_signature_size))
+        return false;
+
+    if (size == taproot_signature_size)
+    {
+        flags = coverage::hash_default;
+    }
+    else
+    {
+        flags = endorsement.back();
+        if (flags == coverage::hash_default)
+            return false;
+    }
+
+    std::copy_n(endorsement.begin(), taproot_signature_size,
+        signature.begin());
+    return true;
+}
+
+// Deferred signatures are assumed valid, so the collector must verify all
+// and fall back to undeferred evaluation upon any failure (script paths may
+// depend on signature validity, e.g. op_check_sig followed by op_not).
+// Signatures previously verified (such as by tx pool) are found in the cache.
+template <typename Stack>
+inline bool program<Stack>::
+verify_signature(const data_chunk& key, const hash_digest& hash,
+    const ec_signature& signature) const NOEXCEPT
+{
+    return verify_signature(key, hash, signature, checks_);
+}
+
+// static
+template <typename Stack>
+inline bool program<Stack>::
+verify_signature(const data_chunk& key, const hash_digest& hash,
+    const ec_signature& signature, ec_signature_checks* checks) NOEXCEPT
+{
+    auto& cache = signature_cache::instance();
+    if (cache.contains(key, hash, signature))
+        return true;
+
+    if (is_null(checks))
+    {
+        if (!system::verify_signature(key, hash, signature))
+            return false;
+
+        cache.insert(key, hash, signature);
+        return true;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    checks->push_back({ key, hash, signature });
+    BC_POP_WARNING()
+    return true;
+}
+
+template <typename Stack>
+inline bool program<Stack>::
+verify_schnorr(const data_chunk& key, const hash_digest& hash,
+    const ec_signature& signature) const NOEXCEPT
+{
+    return verify_schnorr(key, hash, signature, checks_);
+}
+
+// static
+// Schnorr checks join the same deferred batch as ECDSA checks. The x-only key
+// size (32) distinguishes these from ECDSA keys in the signature cache.
+template <typename Stack>
+inline bool program<Stack>::
+verify_schnorr(const data_chunk& key, const hash_digest& hash,
+    const ec_signature& signature, ec_signature_checks* checks) NOEXCEPT
+{
+    auto& cache = signature_cache::instance();
+    if (cache.contains(key, hash, signature))
+        return true;
+
+    if (is_null(checks))
+    {
+        if (!schnorr::verify_signature(key, hash, signature))
+            return false;
+
+        cache.insert(key, hash, signature);
+        return true;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    checks->push_back({ key, hash, signature, true });
+    BC_POP_WARNING()
+    return true;
+}
+
 // Signature hashing.
 // ----------------------------------------------------------------------------
 
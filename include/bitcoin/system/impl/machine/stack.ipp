@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_IPP
 #define LIBBITCOIN_SYSTEM_MACHINE_STACK_IPP
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 #include <type_traits>
@@ -34,12 +35,50 @@ namespace libbitcoin {
 namespace system {
 namespace machine {
 
+// chunk_tether
+// ----------------------------------------------------------------------------
+
+INLINE chunk_xptr chunk_tether::push(data_chunk&& value) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if (!head_ || head_->size == block_size)
+    {
+        auto next = std::make_shared<block>();
+        next->next = std::move(head_);
+        head_ = std::move(next);
+    }
+    BC_POP_WARNING()
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    auto& chunk = head_->chunks[head_->size++];
+    BC_POP_WARNING()
+
+    chunk = std::move(value);
+    return { &chunk };
+}
+
+// stack
+// ----------------------------------------------------------------------------
+
 template <typename Container>
 INLINE stack<Container>::stack() NOEXCEPT
   : container_{}, tether_{}
 {
 }
 
+template <typename Container>
+INLINE stack<Container>::stack(const stack& other) NOEXCEPT
+  : container_{}, tether_(other.tether_)
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    if constexpr (vector_)
+        container_.reserve(std::max(other.size(), initial_capacity));
+
+    container_.insert(container_.end(), other.container_.begin(),
+        other.container_.end());
+    BC_POP_WARNING()
+}
+
 template <typename Container>
 INLINE stack<Container>::stack(Container&& container) NOEXCEPT
   : container_(std::move(container)), tether_{}
@@ -87,14 +126,16 @@ INLINE size_t stack<Container>::size() const NOEXCEPT
 template <typename Container>
 INLINE void stack<Container>::push(data_chunk&& value) NOEXCEPT
 {
+    reserve();
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    container_.push_back(make_external(std::move(value), tether_));
+    container_.push_back(tether_.push(std::move(value)));
     BC_POP_WARNING()
 }
 
 template <typename Container>
 INLINE void stack<Container>::push(stack_variant&& value) NOEXCEPT
 {
+    reserve();
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     container_.push_back(std::move(value));
     BC_POP_WARNING()
@@ -103,6 +144,7 @@ INLINE void stack<Container>::push(stack_variant&& value) NOEXCEPT
 template <typename Container>
 INLINE void stack<Container>::push(const stack_variant& value) NOEXCEPT
 {
+    reserve();
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     container_.push_back(value);
     BC_POP_WARNING()
@@ -111,6 +153,7 @@ INLINE void stack<Container>::push(const stack_variant& value) NOEXCEPT
 template <typename Container>
 INLINE void stack<Container>::emplace_boolean(bool value) NOEXCEPT
 {
+    reserve();
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     container_.emplace_back(value);
     BC_POP_WARNING()
@@ -119,6 +162,7 @@ INLINE void stack<Container>::emplace_boolean(bool value) NOEXCEPT
 template <typename Container>
 INLINE void stack<Container>::emplace_integer(int64_t value) NOEXCEPT
 {
+    reserve();
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     container_.emplace_back(value);
     BC_POP_WARNING()
@@ -127,11 +171,27 @@ INLINE void stack<Container>::emplace_integer(int64_t value) NOEXCEPT
 template <typename Container>
 INLINE void stack<Container>::emplace_chunk(const chunk_xptr& value) NOEXCEPT
 {
+    reserve();
     BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
     container_.emplace_back(value.get());
     BC_POP_WARNING()
 }
 
+// The first push into an empty contiguous stack reserves initial capacity.
+template <typename Container>
+INLINE void stack<Container>::reserve() NOEXCEPT
+{
+    if constexpr (vector_)
+    {
+        if (is_zero(container_.capacity()))
+        {
+            BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+            container_.reserve(initial_capacity);
+            BC_POP_WARNING()
+        }
+    }
+}
+
 // Positional (stack cheats).
 // ----------------------------------------------------------------------------
 // These optimizations prevent used of std::stack.
@@ -298,12 +358,12 @@ inline chunk_xptr stack<Container>::peek_chunk() const NOEXCEPT
         [&, this](bool vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = make_external(chunk::from_bool(vary), tether_);
+            value = tether_.push(chunk::from_bool(vary));
         },
         [&](int64_t vary) NOEXCEPT
         {
             // This is never executed in standard scripts.
-            value = make_external(chunk::from_integer(vary), tether_);
+            value = tether_.push(chunk::from_integer(vary));
         },
         [&](const chunk_xptr& vary) NOEXCEPT
         {
@@ -397,7 +457,7 @@ inline bool stack<Container>::equal_chunks(const stack_variant& left,
 
 // Tethering Considerations
 //
-// Hash results and int/bool->chunks are saved using a shared_ptr vector.
+// Hash results and int/bool->chunks are saved in a block store (chunk_tether).
 // The tether is not garbage-collected (until destruct) as this is a space-
 // time performance tradeoff. The maximum number of constructable chunks is
 // bound by the script size limit. A standard in/out script pair tethers
@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_LIMBS_IPP
+#define LIBBITCOIN_SYSTEM_MATH_LIMBS_IPP
+
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/wide.hpp>
+#include <bitcoin/system/math/bits.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+#define TEMPLATE template <size_t Bits, \
+    bool_if<!is_zero(Bits) && is_zero(Bits % bits<uint64_t>)> If>
+#define CLASS limbs<Bits, If>
+
+// Limb indexes are bounded by count, limb shifts by limb width.
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_DYNAMIC_ARRAY_INDEXING)
+
+// Constructors.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+constexpr CLASS::
+limbs() NOEXCEPT
+  : words_{}
+{
+}
+
+TEMPLATE
+constexpr CLASS::
+limbs(uint64_t value) NOEXCEPT
+  : words_{ value }
+{
+}
+
+TEMPLATE
+constexpr CLASS::
+limbs(const words_t& words) NOEXCEPT
+  : words_{ words }
+{
+}
+
+TEMPLATE
+constexpr CLASS::
+limbs(const bytes_t& little) NOEXCEPT
+  : words_{}
+{
+    for (size_t word = 0; word < count; ++word)
+        for (size_t byte = 0; byte < sizeof(uint64_t); ++byte)
+            words_[word] |= static_cast<uint64_t>(
+                little[word * sizeof(uint64_t) + byte]) << to_bits(byte);
+}
+
+TEMPLATE
+CLASS::
+limbs(const uintx_t<Bits>& value) NOEXCEPT
+  : words_{}
+{
+    const uintx_t<Bits> mask{ max_uint64 };
+    for (size_t word = 0; word < count; ++word)
+        words_[word] = static_cast<uint64_t>(
+            (value >> (word * bits<uint64_t>)) & mask);
+}
+
+TEMPLATE
+CLASS::
+operator uintx_t<Bits>() const NOEXCEPT
+{
+    uintx_t<Bits> value{};
+    for (auto word = count; word > 0; --word)
+    {
+        value <<= bits<uint64_t>;
+        value |= words_[sub1(word)];
+    }
+
+    return value;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+constexpr const typename CLASS::words_t& CLASS::
+words() const NOEXCEPT
+{
+    return words_;
+}
+
+TEMPLATE
+constexpr typename CLASS::bytes_t CLASS::
+to_bytes() const NOEXCEPT
+{
+    bytes_t little{};
+    for (size_t word = 0; word < count; ++word)
+        for (size_t byte = 0; byte < sizeof(uint64_t); ++byte)
+            little[word * sizeof(uint64_t) + byte] = narrow_cast<uint8_t>(
+                words_[word] >> to_bits(byte));
+
+    return little;
+}
+
+TEMPLATE
+constexpr size_t CLASS::
+bit_width() const NOEXCEPT
+{
+    for (auto word = count; word > 0; --word)
+        if (!is_zero(words_[sub1(word)]))
+            return sub1(word) * bits<uint64_t> +
+                system::bit_width(words_[sub1(word)]);
+
+    return zero;
+}
+
+TEMPLATE
+constexpr CLASS::
+operator bool() const NOEXCEPT
+{
+    for (const auto word: words_)
+        if (!is_zero(word))
+            return true;
+
+    return false;
+}
+
+TEMPLATE
+constexpr CLASS::
+operator uint64_t() const NOEXCEPT
+{
+    return words_.front();
+}
+
+// Shift-subtract division, iterating only over the quotient's bit width.
+TEMPLATE
+constexpr void CLASS::
+divide(limbs& quotient, limbs& remainder, const limbs& dividend,
+    const limbs& divisor) NOEXCEPT
+{
+    quotient = {};
+    remainder = dividend;
+    if (!divisor || dividend < divisor)
+    {
+        if (!divisor)
+            remainder = {};
+
+        return;
+    }
+
+    auto shift = dividend.bit_width() - divisor.bit_width();
+    auto subtrahend = divisor << shift;
+
+    for (++shift; shift > 0; --shift)
+    {
+        quotient <<= one;
+        if (remainder >= subtrahend)
+        {
+            remainder -= subtrahend;
+            quotient.words_.front() |= one;
+        }
+
+        subtrahend >>= one;
+    }
+}
+
+// Operators.
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator+=(const limbs& other) NOEXCEPT
+{
+    bool carry{};
+    for (size_t word = 0; word < count; ++word)
+        words_[word] = add_carry(words_[word], other.words_[word], carry);
+
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator-=(const limbs& other) NOEXCEPT
+{
+    bool borrow{};
+    for (size_t word = 0; word < count; ++word)
+        words_[word] = subtract_borrow(words_[word], other.words_[word],
+            borrow);
+
+    return *this;
+}
+
+// Schoolbook multiplication, truncated to count limbs.
+TEMPLATE
+constexpr CLASS& CLASS::
+operator*=(const limbs& other) NOEXCEPT
+{
+    words_t product{};
+    for (size_t left = 0; left < count; ++left)
+    {
+        uint64_t carry{};
+        for (size_t right = 0; left + right < count; ++right)
+            product[left + right] = multiply_add(words_[left],
+                other.words_[right], product[left + right], carry);
+    }
+
+    words_ = product;
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator/=(const limbs& other) NOEXCEPT
+{
+    limbs remainder{};
+    divide(*this, remainder, limbs{ *this }, other);
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator%=(const limbs& other) NOEXCEPT
+{
+    limbs quotient{};
+    divide(quotient, *this, limbs{ *this }, other);
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator&=(const limbs& other) NOEXCEPT
+{
+    for (size_t word = 0; word < count; ++word)
+        words_[word] &= other.words_[word];
+
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator|=(const limbs& other) NOEXCEPT
+{
+    for (size_t word = 0; word < count; ++word)
+        words_[word] |= other.words_[word];
+
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator^=(const limbs& other) NOEXCEPT
+{
+    for (size_t word = 0; word < count; ++word)
+        words_[word] ^= other.words_[word];
+
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator<<=(size_t shift) NOEXCEPT
+{
+    const auto offset = shift / bits<uint64_t>;
+    const auto bit = shift % bits<uint64_t>;
+
+    for (auto word = count; word > 0; --word)
+    {
+        const auto to = sub1(word);
+        if (to < offset)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        const auto from = to - offset;
+        words_[to] = words_[from] << bit;
+        if (!is_zero(bit) && !is_zero(from))
+            words_[to] |= words_[sub1(from)] >> (bits<uint64_t> - bit);
+    }
+
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator>>=(size_t shift) NOEXCEPT
+{
+    const auto offset = shift / bits<uint64_t>;
+    const auto bit = shift % bits<uint64_t>;
+
+    for (size_t to = 0; to < count; ++to)
+    {
+        const auto from = to + offset;
+        if (from >= count)
+        {
+            words_[to] = 0;
+            continue;
+        }
+
+        words_[to] = words_[from] >> bit;
+        if (!is_zero(bit) && add1(from) < count)
+            words_[to] |= words_[add1(from)] << (bits<uint64_t> - bit);
+    }
+
+    return *this;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator++() NOEXCEPT
+{
+    return *this += one;
+}
+
+TEMPLATE
+constexpr CLASS& CLASS::
+operator--() NOEXCEPT
+{
+    return *this -= one;
+}
+
+TEMPLATE
+constexpr CLASS CLASS::
+operator++(int) NOEXCEPT
+{
+    const auto copy = *this;
+    ++(*this);
+    return copy;
+}
+
+TEMPLATE
+constexpr CLASS CLASS::
+operator--(int) NOEXCEPT
+{
+    const auto copy = *this;
+    --(*this);
+    return copy;
+}
+
+TEMPLATE
+constexpr CLASS CLASS::
+operator~() const NOEXCEPT
+{
+    limbs out{};
+    for (size_t word = 0; word < count; ++word)
+        out.words_[word] = ~words_[word];
+
+    return out;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
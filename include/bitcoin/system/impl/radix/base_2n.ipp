@@ -33,7 +33,8 @@ namespace system {
 // This expansion limits the exponent to e_bits, ensuring that there is only
 // one compressed representation for any given span of bits.
 template <size_t Base, size_t Precision, size_t Span>
-constexpr typename base2n<Base, Precision, Span>::span_type
+template <typename Number>
+constexpr Number
 base2n<Base, Precision, Span>::expand(small_type exponential) NOEXCEPT
 {
     const auto shift = raise(shift_right(exponential, precision));
@@ -43,7 +44,7 @@ base2n<Base, Precision, Span>::expand(small_type exponential) NOEXCEPT
     if (is_limited(shift, span))
         return 0;
 
-    span_type number{ mantissa };
+    Number number{ mantissa };
 
     shift > precision ?
         number <<= (shift - precision) :
@@ -22,6 +22,7 @@
 #include <ios>
 #include <istream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -40,7 +41,7 @@ namespace system {
 
 template <typename IStream>
 byte_reader<IStream>::byte_reader(IStream& source) NOEXCEPT
-  : stream_(source), remaining_(system::maximum<size_t>)
+  : stream_(source), remaining_(system::maximum<size_t>), arena_(nullptr)
 {
     ////BC_ASSERT_MSG(stream_.exceptions() == IStream::goodbit,
     ////    "Input stream must not be configured to throw exceptions.");
@@ -435,6 +436,18 @@ void byte_reader<IStream>::invalidate() NOEXCEPT
     invalid();
 }
 
+template <typename IStream>
+std::pmr::memory_resource* byte_reader<IStream>::get_arena() const NOEXCEPT
+{
+    return arena_;
+}
+
+template <typename IStream>
+void byte_reader<IStream>::set_arena(std::pmr::memory_resource* arena) NOEXCEPT
+{
+    arena_ = arena;
+}
+
 template <typename IStream>
 byte_reader<IStream>::operator bool() const NOEXCEPT
 {
@@ -86,7 +86,7 @@ namespace cpu7_0
     constexpr auto leaf = 7;
     constexpr auto subleaf = 0;
     constexpr auto avx2_ebx_bit = 5;
-    ////constexpr auto avx512f_ebx_bit = 16;
+    constexpr auto avx512f_ebx_bit = 16;
     constexpr auto avx512bw_ebx_bit = 30;
     constexpr auto shani_ebx_bit = 29;
 }
@@ -96,6 +96,9 @@ namespace xcr0
     constexpr auto feature = 0;
     constexpr auto sse_bit = 1;
     constexpr auto avx_bit = 2;
+    constexpr auto opmask_bit = 5;
+    constexpr auto zmm_hi256_bit = 6;
+    constexpr auto hi16_zmm_bit = 7;
 }
 
 
@@ -107,17 +110,45 @@ constexpr bool get_bit(Value value) NOEXCEPT
     return !is_zero(value & mask);
 }
 
+/// Probes independent of compiled intrinsics, for kernels that are compiled
+/// with their own target (see sha::dispatch).
+inline bool cpu_shani() NOEXCEPT
+{
+#if defined(HAVE_XCPU)
+    uint32_t eax, ebx, ecx, edx;
+    return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+        && get_bit<cpu1_0::sse41_ecx_bit>(ecx)      // SSE4.1
+        && (eax >= cpu7_0::leaf)
+        && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
+        && get_bit<cpu7_0::shani_ebx_bit>(ebx);     // SHA-NI
+#else
+    return false;
+#endif
+}
+
+inline bool cpu_avx2() NOEXCEPT
+{
+#if defined(HAVE_XCPU)
+    uint64_t extended;
+    uint32_t eax, ebx, ecx, edx;
+    return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
+        && get_bit<cpu1_0::sse41_ecx_bit>(ecx)      // SSE4.1
+        && get_bit<cpu1_0::xsave_ecx_bit>(ecx)      // XSAVE
+        && get_bit<cpu1_0::avx_ecx_bit>(ecx)        // AVX
+        && get_xcr(extended, xcr0::feature)
+        && get_bit<xcr0::sse_bit>(extended)
+        && get_bit<xcr0::avx_bit>(extended)
+        && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
+        && get_bit<cpu7_0::avx2_ebx_bit>(ebx);      // AVX2
+#else
+    return false;
+#endif
+}
+
 inline bool try_shani() NOEXCEPT
 {
     if constexpr (with_shani)
-    {
-        uint32_t eax, ebx, ecx, edx;
-        return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
-            && get_bit<cpu1_0::sse41_ecx_bit>(ecx)      // SSE4.1
-            && (eax >= cpu7_0::leaf)
-            && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
-            && get_bit<cpu7_0::shani_ebx_bit>(ebx);     // SHA-NI
-    }
+        return cpu_shani();
     else
         return false;
 }
@@ -135,7 +166,11 @@ inline bool try_avx512() NOEXCEPT
             && get_xcr(extended, xcr0::feature)
             && get_bit<xcr0::sse_bit>(extended)
             && get_bit<xcr0::avx_bit>(extended)
+            && get_bit<xcr0::opmask_bit>(extended)      // k0-k7 saved
+            && get_bit<xcr0::zmm_hi256_bit>(extended)   // zmm0-15 upper
+            && get_bit<xcr0::hi16_zmm_bit>(extended)    // zmm16-31
             && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
+            && get_bit<cpu7_0::avx512f_ebx_bit>(ebx)    // AVX512F
             && get_bit<cpu7_0::avx512bw_ebx_bit>(ebx);  // AVX512BW
     }
     else
@@ -145,19 +180,7 @@ inline bool try_avx512() NOEXCEPT
 inline bool try_avx2() NOEXCEPT
 {
     if constexpr (with_avx2)
-    {
-        uint64_t extended;
-        uint32_t eax, ebx, ecx, edx;
-        return get_cpu(eax, ebx, ecx, edx, cpu1_0::leaf, cpu1_0::subleaf)
-            && get_bit<cpu1_0::sse41_ecx_bit>(ecx)      // SSE4.1
-            && get_bit<cpu1_0::xsave_ecx_bit>(ecx)      // XSAVE
-            && get_bit<cpu1_0::avx_ecx_bit>(ecx)        // AVX
-            && get_xcr(extended, xcr0::feature)
-            && get_bit<xcr0::sse_bit>(extended)
-            && get_bit<xcr0::avx_bit>(extended)
-            && get_cpu(eax, ebx, ecx, edx, cpu7_0::leaf, cpu7_0::subleaf)
-            && get_bit<cpu7_0::avx2_ebx_bit>(ebx);      // AVX2
-    }
+        return cpu_avx2();
     else
         return false;
 }
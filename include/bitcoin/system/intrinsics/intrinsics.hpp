@@ -23,6 +23,7 @@
 #include <bitcoin/system/intrinsics/byteswap.hpp>
 #include <bitcoin/system/intrinsics/haves.hpp>
 #include <bitcoin/system/intrinsics/rotate.hpp>
+#include <bitcoin/system/intrinsics/wide.hpp>
 #include <bitcoin/system/intrinsics/xcpu/xcpu.hpp>
 
 #endif
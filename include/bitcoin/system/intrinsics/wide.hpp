@@ -0,0 +1,176 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_INTRINSICS_WIDE_HPP
+#define LIBBITCOIN_SYSTEM_INTRINSICS_WIDE_HPP
+
+#include <type_traits>
+#include <bitcoin/system/define.hpp>
+
+// Use intrinsics if available (portable).
+#if defined(HAVE_MSC) && defined(HAVE_X64)
+    // docs.microsoft.com/en-us/cpp/intrinsics/umul128
+    // docs.microsoft.com/en-us/cpp/intrinsics/x64-amd64-intrinsics-list
+    #include <intrin.h>
+#endif
+
+namespace libbitcoin {
+namespace system {
+
+/// Word primitives for multiple precision (limb) arithmetic.
+/// GCC/Clang: unsigned __int128 (compiles to adc/sbb/mul/mulx as targeted).
+/// MSVC x64: _addcarry_u64/_subborrow_u64/_umul128 (runtime evaluation only).
+/// Otherwise: native 32 bit half word implementation (always constexpr).
+
+#if defined(HAVE_INT128)
+    __extension__ typedef unsigned __int128 uint128_native;
+#endif
+
+INLINE constexpr uint64_t add_carry_native(uint64_t left, uint64_t right,
+    bool& carry) NOEXCEPT
+{
+    const auto sum = left + right;
+    const auto result = sum + static_cast<uint64_t>(carry);
+    carry = (sum < left) || (result < sum);
+    return result;
+}
+
+INLINE constexpr uint64_t subtract_borrow_native(uint64_t left,
+    uint64_t right, bool& borrow) NOEXCEPT
+{
+    const auto difference = left - right;
+    const auto result = difference - static_cast<uint64_t>(borrow);
+    borrow = (left < right) || (difference < result);
+    return result;
+}
+
+/// Low word of the 128 bit product, with high word returned in high.
+/// Portable (32 bit split), used where no 128 bit multiply is available.
+INLINE constexpr uint64_t multiply_wide_native(uint64_t left, uint64_t right,
+    uint64_t& high) NOEXCEPT
+{
+    constexpr auto half = to_half(bits<uint64_t>);
+    constexpr uint64_t mask = max_uint32;
+    const auto left_lo = left & mask;
+    const auto left_hi = left >> half;
+    const auto right_lo = right & mask;
+    const auto right_hi = right >> half;
+
+    const auto lo_lo = left_lo * right_lo;
+    const auto hi_lo = left_hi * right_lo;
+    const auto lo_hi = left_lo * right_hi;
+    const auto hi_hi = left_hi * right_hi;
+
+    const auto cross = (lo_lo >> half) + (hi_lo & mask) + lo_hi;
+    high = hi_hi + (hi_lo >> half) + (cross >> half);
+    return (cross << half) | (lo_lo & mask);
+}
+
+INLINE constexpr uint64_t add_carry(uint64_t left, uint64_t right,
+    bool& carry) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto sum = static_cast<uint128_native>(left) + right + carry;
+    carry = to_bool(sum >> bits<uint64_t>);
+    return static_cast<uint64_t>(sum);
+#elif defined(HAVE_MSC) && defined(HAVE_X64)
+    if (!std::is_constant_evaluated())
+    {
+        uint64_t sum{};
+        carry = to_bool(_addcarry_u64(carry, left, right, &sum));
+        return sum;
+    }
+
+    return add_carry_native(left, right, carry);
+#else
+    return add_carry_native(left, right, carry);
+#endif
+}
+
+INLINE constexpr uint64_t subtract_borrow(uint64_t left, uint64_t right,
+    bool& borrow) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto difference = static_cast<uint128_native>(left) - right - borrow;
+    borrow = to_bool(difference >> bits<uint64_t>);
+    return static_cast<uint64_t>(difference);
+#elif defined(HAVE_MSC) && defined(HAVE_X64)
+    if (!std::is_constant_evaluated())
+    {
+        uint64_t difference{};
+        borrow = to_bool(_subborrow_u64(borrow, left, right, &difference));
+        return difference;
+    }
+
+    return subtract_borrow_native(left, right, borrow);
+#else
+    return subtract_borrow_native(left, right, borrow);
+#endif
+}
+
+INLINE constexpr uint64_t multiply_wide(uint64_t left, uint64_t right,
+    uint64_t& high) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto product = static_cast<uint128_native>(left) * right;
+    high = static_cast<uint64_t>(product >> bits<uint64_t>);
+    return static_cast<uint64_t>(product);
+#elif defined(HAVE_MSC) && defined(HAVE_X64)
+    if (!std::is_constant_evaluated())
+        return _umul128(left, right, &high);
+
+    return multiply_wide_native(left, right, high);
+#else
+    return multiply_wide_native(left, right, high);
+#endif
+}
+
+/// High word of the 128 bit product.
+INLINE constexpr uint64_t multiply_high(uint64_t left, uint64_t right) NOEXCEPT
+{
+    uint64_t high{};
+    multiply_wide(left, right, high);
+    return high;
+}
+
+/// Low word of (left * right + addend + carry), with high word to carry.
+/// This cannot overflow: (2^64-1)^2 + 2 * (2^64-1) = 2^128-1.
+INLINE constexpr uint64_t multiply_add(uint64_t left, uint64_t right,
+    uint64_t addend, uint64_t& carry) NOEXCEPT
+{
+#if defined(HAVE_INT128)
+    const auto product = static_cast<uint128_native>(left) * right +
+        addend + carry;
+    carry = static_cast<uint64_t>(product >> bits<uint64_t>);
+    return static_cast<uint64_t>(product);
+#else
+    uint64_t high{};
+    auto low = multiply_wide(left, right, high);
+    low += addend;
+    high += static_cast<uint64_t>(low < addend);
+    low += carry;
+    high += static_cast<uint64_t>(low < carry);
+    carry = high;
+    return low;
+#endif
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
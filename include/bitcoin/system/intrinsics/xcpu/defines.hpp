@@ -257,6 +257,10 @@ BC_POP_WARNING()
     #define mm512_slli_epi16(a, B)  (a)
     #define mm512_slli_epi32(a, B)  (a)
     #define mm512_slli_epi64(a, B)  (a)
+    #define mm512_ror_epi32(a, B)   (a)
+    #define mm512_ror_epi64(a, B)   (a)
+    #define mm512_rol_epi32(a, B)   (a)
+    #define mm512_rol_epi64(a, B)   (a)
     #define mm512_add_epi8(a, b)    (a)
     #define mm512_add_epi16(a, b)   (a)
     #define mm512_add_epi32(a, b)   (a)
@@ -287,6 +291,10 @@ BC_POP_WARNING()
     #define mm512_slli_epi16(a, B)          _mm512_slli_epi16(a, B) // AVX512BW
     #define mm512_slli_epi32(a, B)          _mm512_slli_epi32(a, B)
     #define mm512_slli_epi64(a, B)          _mm512_slli_epi64(a, B)
+    #define mm512_ror_epi32(a, B)           _mm512_ror_epi32(a, B)
+    #define mm512_ror_epi64(a, B)           _mm512_ror_epi64(a, B)
+    #define mm512_rol_epi32(a, B)           _mm512_rol_epi32(a, B)
+    #define mm512_rol_epi64(a, B)           _mm512_rol_epi64(a, B)
     #define mm512_add_epi8(a, b)            _mm512_add_epi8(a, b)   // AVX512BW
     #define mm512_add_epi16(a, b)           _mm512_add_epi16(a, b)  // AVX512BW
     #define mm512_add_epi32(a, b)           _mm512_add_epi32(a, b)
@@ -108,16 +108,30 @@ INLINE xint512_t shl(xint512_t a) NOEXCEPT
         return mm512_slli_epi64(a, B);
 }
 
+// AVX512F has native 32/64 bit rotates (vprord/vprorq), avoiding the
+// shr/shl/or sequence that dominates the sha sigma functions.
 template <auto B, auto S>
 INLINE xint512_t ror(xint512_t a) NOEXCEPT
 {
-    return or_(shr<B, S>(a), shl<S - B, S>(a));
+    // AVX512F
+    if constexpr (S == bits<uint32_t>)
+        return mm512_ror_epi32(a, B);
+    else if constexpr (S == bits<uint64_t>)
+        return mm512_ror_epi64(a, B);
+    else
+        return or_(shr<B, S>(a), shl<S - B, S>(a));
 }
 
 template <auto B, auto S>
 INLINE xint512_t rol(xint512_t a) NOEXCEPT
 {
-    return or_(shl<B, S>(a), shr<S - B, S>(a));
+    // AVX512F
+    if constexpr (S == bits<uint32_t>)
+        return mm512_rol_epi32(a, B);
+    else if constexpr (S == bits<uint64_t>)
+        return mm512_rol_epi64(a, B);
+    else
+        return or_(shl<B, S>(a), shr<S - B, S>(a));
 }
 
 template <auto S>
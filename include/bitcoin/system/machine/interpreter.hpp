@@ -23,6 +23,7 @@
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/chain/chain.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
 #include <bitcoin/system/machine/program.hpp>
 
 namespace libbitcoin {
@@ -30,7 +31,8 @@ namespace system {
 namespace machine {
 
 /// Class to isolate operation iteration, dispatch, and handlers from state.
-template <typename Stack>
+/// Profiler is the instrumentation policy (unprofiled or profiler).
+template <typename Stack, typename Profiler = unprofiled>
 class interpreter
   : public program<Stack>
 {
@@ -55,14 +57,56 @@ public:
     static code connect(const context& state, const transaction& tx,
         const input_iterator& it) NOEXCEPT;
 
+    /// Connect with signature verification deferred to checks (assumed valid).
+    /// Success is conditional upon verification of all collected checks.
+    static code connect(const context& state, const transaction& tx,
+        const input_iterator& it, ec_signature_checks& checks) NOEXCEPT;
+
 protected:
+    /// Script handler (null checks implies undeferred verification).
+    static code connect_scripts(const context& state, const transaction& tx,
+        const input_iterator& it, ec_signature_checks* checks) NOEXCEPT;
+
     /// Embedded script handler.
     static code connect_embedded(const context& state, const transaction& tx,
-        const input_iterator& it, interpreter& in_program) NOEXCEPT;
+        const input_iterator& it, interpreter& in_program,
+        ec_signature_checks* checks) NOEXCEPT;
 
     /// Witnessed script handler.
     static code connect_witness(const context& state, const transaction& tx,
-        const input_iterator& it, const script& prevout) NOEXCEPT;
+        const input_iterator& it, const script& prevout,
+        ec_signature_checks* checks) NOEXCEPT;
+
+    /// Taproot key path or script path handler (bip341/bip342).
+    static code connect_taproot_witness(const context& state,
+        const transaction& tx, const input_iterator& it,
+        const script& prevout, ec_signature_checks* checks) NOEXCEPT;
+
+    /// Taproot helpers (bip341).
+    static hash_digest tapleaf_hash(uint8_t version,
+        const data_chunk& script) NOEXCEPT;
+    static bool check_commitment(const data_chunk& program,
+        const data_chunk& control, const hash_digest& tapleaf) NOEXCEPT;
+    static bool check_key_path(const transaction& tx,
+        const input_iterator& it, const data_chunk& program,
+        const data_chunk& endorsement, const chunk_cptr& annex,
+        ec_signature_checks* checks) NOEXCEPT;
+
+    /// Standard template handlers (true only if proven successful).
+    static bool connect_standard(const context& state, const transaction& tx,
+        const input_iterator& it, ec_signature_checks* checks) NOEXCEPT;
+    static bool connect_key_hash(const context& state, const transaction& tx,
+        const input_iterator& it, ec_signature_checks* checks) NOEXCEPT;
+    static bool connect_witness_key_hash(const context& state,
+        const transaction& tx, const input_iterator& it,
+        ec_signature_checks* checks) NOEXCEPT;
+    static bool connect_taproot(const context& state, const transaction& tx,
+        const input_iterator& it, ec_signature_checks* checks) NOEXCEPT;
+    static bool check_key_hash(const transaction& tx,
+        const input_iterator& it, const script& sub, uint64_t value,
+        script_version version, uint32_t forks, const data_chunk& short_hash,
+        const data_chunk& endorsement, const data_chunk& key,
+        ec_signature_checks* checks) NOEXCEPT;
 
     /// Operation disatch.
     error::op_error_t run_op(const op_iterator& op) NOEXCEPT;
@@ -148,8 +192,11 @@ protected:
     inline error::op_error_t op_hash160() NOEXCEPT;
     inline error::op_error_t op_hash256() NOEXCEPT;
     inline error::op_error_t op_codeseparator(const op_iterator& op) NOEXCEPT;
+    inline error::op_error_t op_check_schnorr_sig(bool& valid,
+        const chunk_xptr& key, const chunk_xptr& endorsement) NOEXCEPT;
     inline error::op_error_t op_check_sig_verify() NOEXCEPT;
     inline error::op_error_t op_check_sig() NOEXCEPT;
+    inline error::op_error_t op_check_sig_add() NOEXCEPT;
     inline error::op_error_t op_check_multisig_verify() NOEXCEPT;
     inline error::op_error_t op_check_multisig() NOEXCEPT;
     inline error::op_error_t op_check_locktime_verify() const NOEXCEPT;
@@ -21,6 +21,7 @@
 
 #include <bitcoin/system/machine/interpreter.hpp>
 #include <bitcoin/system/machine/number.hpp>
+#include <bitcoin/system/machine/profiler.hpp>
 #include <bitcoin/system/machine/program.hpp>
 #include <bitcoin/system/machine/stack.hpp>
 
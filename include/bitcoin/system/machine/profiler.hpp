@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MACHINE_PROFILER_HPP
+#define LIBBITCOIN_SYSTEM_MACHINE_PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+/// Snapshot of instrumented script evaluation counters.
+struct BC_API profile
+{
+    struct operation
+    {
+        uint64_t count{};
+        uint64_t nanoseconds{};
+    };
+
+    static constexpr size_t opcodes = add1<size_t>(max_uint8);
+
+    /// Executed operations, indexed by opcode (skipped ops are not counted).
+    std::array<operation, opcodes> operations{};
+
+    /// Input and prevout script runs, and heap allocations within them.
+    uint64_t runs{};
+    uint64_t allocations{};
+
+    /// Embedded (p2sh and witness) script runs, and heap allocations within
+    /// their connection (including embedded script parsing).
+    uint64_t embedded_runs{};
+    uint64_t embedded_allocations{};
+
+    /// Signature hashes computed (multisig hashes once per distinct flags),
+    /// signatures verified (or deferred) and primary stack high-water mark.
+    uint64_t sighashes{};
+    uint64_t verifications{};
+    uint64_t stack_high_water{};
+};
+
+DECLARE_JSON_VALUE_CONVERTORS(profile);
+
+/// Interpreter instrumentation policy that records nothing (the default).
+/// All hooks are empty and inline, so evaluation is unaffected.
+class unprofiled
+{
+public:
+    struct timer {};
+
+    /// User-provided constructors preclude unused variable warnings.
+    struct scope { INLINE scope() NOEXCEPT {} };
+    struct embedded { INLINE embedded() NOEXCEPT {} };
+
+    static INLINE timer start() NOEXCEPT { return {}; }
+    static INLINE void executed(chain::opcode, const timer&) NOEXCEPT {}
+    static INLINE void stacked(size_t) NOEXCEPT {}
+    static INLINE void sighashed() NOEXCEPT {}
+    static INLINE void verified() NOEXCEPT {}
+};
+
+/// Interpreter instrumentation policy that records process-wide counters.
+/// Counters are relaxed atomics shared by all instrumented interpreters, so
+/// a snapshot taken during concurrent evaluation is not self-consistent.
+class BC_API profiler
+{
+public:
+    typedef std::chrono::steady_clock::time_point timer;
+    typedef size_t(*allocation_counter)();
+
+    /// Counts a run and the heap allocations (if counted) made within it.
+    /// Runs within an embedded connection are counted as embedded runs, with
+    /// allocations attributed to the connection (not also to the run).
+    class BC_API scope
+    {
+    public:
+        DELETE_COPY_MOVE(scope);
+        scope() NOEXCEPT;
+        ~scope() NOEXCEPT;
+
+    private:
+        const bool embedded_;
+        const size_t allocations_;
+    };
+
+    /// Marks an embedded (p2sh or witness) connection on the current thread,
+    /// counting heap allocations (if counted) made within the outermost.
+    class BC_API embedded
+    {
+    public:
+        DELETE_COPY_MOVE(embedded);
+        embedded() NOEXCEPT;
+        ~embedded() NOEXCEPT;
+
+    private:
+        const bool outermost_;
+        const size_t allocations_;
+    };
+
+    /// Evaluation hooks.
+    static timer start() NOEXCEPT;
+    static void executed(chain::opcode code, const timer& start) NOEXCEPT;
+    static void stacked(size_t size) NOEXCEPT;
+    static void sighashed() NOEXCEPT;
+    static void verified() NOEXCEPT;
+
+    /// Heap allocations are not observable by the library. An application
+    /// that counts them (e.g. by replacing operator new) may set a counter,
+    /// which is sampled at the start and end of each run and outermost
+    /// embedded connection (nullptr to unset).
+    static void set_allocation_counter(allocation_counter counter) NOEXCEPT;
+
+    /// Read or reset all counters.
+    static profile snapshot() NOEXCEPT;
+    static void clear() NOEXCEPT;
+};
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
+
+#endif
@@ -45,8 +45,11 @@ public:
     typedef std::unordered_map<uint8_t, hash_digest> hash_cache;
 
     /// Input script run (default/empty stack).
+    /// Signature verification is deferred to non-null checks (assumed valid),
+    /// excluding multisig, which is always verified during evaluation.
     inline program(const chain::transaction& transaction,
-        const input_iterator& input, uint32_t forks) NOEXCEPT;
+        const input_iterator& input, uint32_t forks,
+        ec_signature_checks* checks) NOEXCEPT;
 
     /// Legacy p2sh or prevout script run (copied input stack).
     inline program(const program& other,
@@ -60,7 +63,14 @@ public:
     inline program(const chain::transaction& transaction,
         const input_iterator& input, const chain::script::cptr& script,
         uint32_t forks, chain::script_version version,
-        const chunk_cptrs_ptr& stack) NOEXCEPT;
+        const chunk_cptrs_ptr& stack, ec_signature_checks* checks) NOEXCEPT;
+
+    /// Tapscript run (witness-initialized stack, bip342).
+    inline program(const chain::transaction& transaction,
+        const input_iterator& input, const chain::script::cptr& script,
+        uint32_t forks, const chunk_cptrs_ptr& stack,
+        const hash_digest& tapleaf, const chunk_cptr& annex,
+        ec_signature_checks* checks) NOEXCEPT;
 
     /// Program result.
     inline bool is_true(bool clean) const NOEXCEPT;
@@ -76,11 +86,13 @@ protected:
     /// -----------------------------------------------------------------------
 
     INLINE bool is_prefail() const NOEXCEPT;
+    INLINE bool is_push_only() const NOEXCEPT;
     INLINE op_iterator begin() const NOEXCEPT;
     INLINE op_iterator end() const NOEXCEPT;
     INLINE const chain::input& input() const NOEXCEPT;
     INLINE const chain::transaction& transaction() const NOEXCEPT;
     INLINE bool is_enabled(chain::forks rule) const NOEXCEPT;
+    INLINE bool is_tapscript() const NOEXCEPT;
     INLINE error::script_error_t validate() const NOEXCEPT;
 
     /// Primary stack.
@@ -97,6 +109,7 @@ protected:
     INLINE chunk_xptr pop_chunk_() NOEXCEPT;
     INLINE bool pop_bool_() NOEXCEPT;
     INLINE bool pop_strict_bool_() NOEXCEPT;
+    INLINE bool pop_minimal_bool_(bool& value) NOEXCEPT;
     INLINE bool pop_chunks(chunk_xptrs& data, size_t count) NOEXCEPT;
     INLINE bool pop_signed32(int32_t& value) NOEXCEPT;
     INLINE bool pop_binary32(int32_t& left, int32_t& right) NOEXCEPT;
@@ -147,6 +160,7 @@ protected:
 
     INLINE bool ops_increment(const chain::operation& op) NOEXCEPT;
     INLINE bool ops_increment(size_t public_keys) NOEXCEPT;
+    INLINE bool budget_decrement() NOEXCEPT;
 
     /// Signature validation helpers.
     /// -----------------------------------------------------------------------
@@ -167,6 +181,32 @@ protected:
         hash_cache& cache, uint8_t& flags, const data_chunk& endorsement,
         const chain::script& sub) const NOEXCEPT;
 
+    /// Prepare schnorr signature and taproot signature hash (bip342).
+    inline bool prepare(ec_signature& signature, hash_digest& hash,
+        const data_chunk& endorsement) const NOEXCEPT;
+
+    /// Parse schnorr endorsement into signature and sighash flags (bip341).
+    static inline bool parse_schnorr(ec_signature& signature, uint8_t& flags,
+        const data_chunk& endorsement) NOEXCEPT;
+
+    /// Verify signature, or defer verification (and assume valid).
+    inline bool verify_signature(const data_chunk& key,
+        const hash_digest& hash, const ec_signature& signature) const NOEXCEPT;
+
+    /// Verify signature, or defer to checks if not null (assume valid).
+    static inline bool verify_signature(const data_chunk& key,
+        const hash_digest& hash, const ec_signature& signature,
+        ec_signature_checks* checks) NOEXCEPT;
+
+    /// Verify schnorr signature, or defer verification (and assume valid).
+    inline bool verify_schnorr(const data_chunk& key,
+        const hash_digest& hash, const ec_signature& signature) const NOEXCEPT;
+
+    /// Verify schnorr signature, or defer to checks if not null.
+    static inline bool verify_schnorr(const data_chunk& key,
+        const hash_digest& hash, const ec_signature& signature,
+        ec_signature_checks* checks) NOEXCEPT;
+
 private:
     using primary_stack = stack<Stack>;
 
@@ -197,14 +237,20 @@ private:
     const uint64_t value_;
     const chain::script_version version_;
     const chunk_cptrs_ptr witness_;
+    ec_signature_checks* const checks_;
+
+    // Tapscript constants (bip342).
+    const hash_digest tapleaf_{};
+    const chunk_cptr annex_{};
 
     // Three stacks.
     primary_stack primary_;
     alternate_stack alternate_{};
     condition_stack condition_{};
 
-    // Accumulator.
+    // Accumulators.
     size_t operation_count_{};
+    int64_t budget_{};
 
     // Condition stack optimization.
     size_t negative_condition_count_{};
@@ -19,7 +19,9 @@
 #ifndef LIBBITCOIN_SYSTEM_MACHINE_STACK_HPP
 #define LIBBITCOIN_SYSTEM_MACHINE_STACK_HPP
 
+#include <array>
 #include <list>
+#include <memory>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -43,12 +45,38 @@ typedef std::vector<stack_variant> alternate_stack;
 // Possibly space-efficient bit vector, optimized by std lib.
 typedef std::vector<bool> condition_stack;
 
+/// Stable store for chunks computed during evaluation (hashes, conversions).
+/// Chunk objects are held in fixed-size blocks, one allocation per block (vs.
+/// a shared_ptr per chunk plus tether growth). The store is shared by stack
+/// copies, so copying a stack does not copy its tether.
+class chunk_tether
+{
+public:
+    /// Move value into the store and return a pointer to it.
+    INLINE chunk_xptr push(data_chunk&& value) NOEXCEPT;
+
+private:
+    static constexpr size_t block_size = 8;
+
+    struct block
+    {
+        std::array<data_chunk, block_size> chunks{};
+        size_t size{};
+        std::shared_ptr<block> next{};
+    };
+
+    std::shared_ptr<block> head_{};
+};
+
 template <typename Container>
 class stack
 {
 public:
-    /// Stack is copied in program construct.
-    DEFAULT_COPY_MOVE_DESTRUCT(stack);
+    /// Copy reserves capacity, as the copy is subsequently evaluated.
+    DEFAULT_MOVE(stack);
+    INLINE stack(const stack& other) NOEXCEPT;
+    stack& operator=(const stack&) = default;
+    virtual ~stack() = default;
 
     /// Construct.
     INLINE stack() NOEXCEPT;
@@ -85,6 +113,12 @@ public:
         const stack_variant& right) NOEXCEPT;
 
 private:
+    /// Elements preallocated by a contiguous stack upon first push or copy.
+    /// This covers standard scripts, avoiding reallocation on each growth.
+    static constexpr size_t initial_capacity = 16;
+
+    INLINE void reserve() NOEXCEPT;
+
     template<size_t Bytes, typename Integer,
         if_not_lesser<sizeof(Integer), Bytes> = true,
         if_signed_integral_integer<Integer> = true>
@@ -97,7 +131,7 @@ private:
     Container container_;
 
     // Mutable as this is updated by peek_chunk.
-    mutable tether<data_chunk> tether_;
+    mutable chunk_tether tether_;
 };
 
 // For use with std::visit.
@@ -0,0 +1,167 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_MATH_LIMBS_HPP
+#define LIBBITCOIN_SYSTEM_MATH_LIMBS_HPP
+
+#include <compare>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/wide.hpp>
+#include <bitcoin/system/math/bits.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Fixed width unsigned integer of 64 bit limbs (least significant first).
+/// A native alternative to uintx_t<Bits> for hot paths (proof of work, work).
+/// Arithmetic is modulo 2^Bits as with native unsigned integers, and all
+/// operations are constexpr. Division by zero produces zero (not guarded).
+template <size_t Bits,
+    bool_if<!is_zero(Bits) && is_zero(Bits % bits<uint64_t>)> = true>
+class limbs
+{
+public:
+    static constexpr size_t count = Bits / bits<uint64_t>;
+    using words_t = std_array<uint64_t, count>;
+    using bytes_t = std_array<uint8_t, Bits / byte_bits>;
+
+    /// Constructors.
+    /// -----------------------------------------------------------------------
+
+    constexpr limbs() NOEXCEPT;
+    constexpr limbs(uint64_t value) NOEXCEPT;
+    constexpr explicit limbs(const words_t& words) NOEXCEPT;
+
+    /// Little-endian bytes (e.g. a hash_digest as a number, see to_uintx).
+    constexpr explicit limbs(const bytes_t& little) NOEXCEPT;
+
+    /// Boost interop (not constexpr).
+    explicit limbs(const uintx_t<Bits>& value) NOEXCEPT;
+    explicit operator uintx_t<Bits>() const NOEXCEPT;
+
+    /// Properties.
+    /// -----------------------------------------------------------------------
+
+    constexpr const words_t& words() const NOEXCEPT;
+    constexpr bytes_t to_bytes() const NOEXCEPT;
+    constexpr size_t bit_width() const NOEXCEPT;
+    constexpr explicit operator bool() const NOEXCEPT;
+    constexpr explicit operator uint64_t() const NOEXCEPT;
+
+    /// Quotient and remainder in one pass.
+    static constexpr void divide(limbs& quotient, limbs& remainder,
+        const limbs& dividend, const limbs& divisor) NOEXCEPT;
+
+    /// Operators.
+    /// -----------------------------------------------------------------------
+
+    constexpr limbs& operator+=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator-=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator*=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator/=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator%=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator&=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator|=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator^=(const limbs& other) NOEXCEPT;
+    constexpr limbs& operator<<=(size_t shift) NOEXCEPT;
+    constexpr limbs& operator>>=(size_t shift) NOEXCEPT;
+    constexpr limbs& operator++() NOEXCEPT;
+    constexpr limbs& operator--() NOEXCEPT;
+    constexpr limbs operator++(int) NOEXCEPT;
+    constexpr limbs operator--(int) NOEXCEPT;
+    constexpr limbs operator~() const NOEXCEPT;
+
+    friend constexpr bool operator==(const limbs& left,
+        const limbs& right) NOEXCEPT = default;
+
+    /// Compares from the most significant limb.
+    friend constexpr std::strong_ordering operator<=>(const limbs& left,
+        const limbs& right) NOEXCEPT
+    {
+        for (auto word = count; word > 0; --word)
+            if (const auto order = left.words_[sub1(word)] <=>
+                right.words_[sub1(word)]; order != 0)
+                return order;
+
+        return std::strong_ordering::equal;
+    }
+
+    friend constexpr limbs operator+(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left += right;
+    }
+
+    friend constexpr limbs operator-(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left -= right;
+    }
+
+    friend constexpr limbs operator*(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left *= right;
+    }
+
+    friend constexpr limbs operator/(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left /= right;
+    }
+
+    friend constexpr limbs operator%(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left %= right;
+    }
+
+    friend constexpr limbs operator&(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left &= right;
+    }
+
+    friend constexpr limbs operator|(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left |= right;
+    }
+
+    friend constexpr limbs operator^(limbs left, const limbs& right) NOEXCEPT
+    {
+        return left ^= right;
+    }
+
+    friend constexpr limbs operator<<(limbs left, size_t shift) NOEXCEPT
+    {
+        return left <<= shift;
+    }
+
+    friend constexpr limbs operator>>(limbs left, size_t shift) NOEXCEPT
+    {
+        return left >>= shift;
+    }
+
+private:
+    words_t words_;
+};
+
+/// 128 and 256 bit limb integers.
+using limbs128 = limbs<128>;
+using limbs256 = limbs<256>;
+
+} // namespace system
+} // namespace libbitcoin
+
+#include <bitcoin/system/impl/math/limbs.ipp>
+
+#endif
@@ -74,7 +74,9 @@ public:
 
     /// A zero value implies an invalid (including zero) parameter.
     /// Invalid if a padding bit is set. Allows non-minimal exponent encoding.
-    static constexpr span_type expand(small_type exponential) NOEXCEPT;
+    /// Number may be any unsigned type of span bits (e.g. limbs<span>).
+    template <typename Number = span_type>
+    static constexpr Number expand(small_type exponential) NOEXCEPT;
 
     /// (m * base^e) bit-encoded as [00eeeee][mmmmmmmm][mmmmmmmm][mmmmmmmm].
     /// Highest two bits are padded with zeros, uses minimal exponent encoding.
@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <limits>
+#include <memory_resource>
 #include <string>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -140,6 +141,14 @@ public:
     /// Invalidate the stream.
     void invalidate() NOEXCEPT override;
 
+    /// Memory resource for deserialized shared chain objects and their control
+    /// blocks (nullptr implies heap). Contained data_chunk and operation
+    /// buffers are always heap allocated.
+    std::pmr::memory_resource* get_arena() const NOEXCEPT override;
+
+    /// Set memory resource, which must outlive all deserialized objects.
+    void set_arena(std::pmr::memory_resource* arena) NOEXCEPT override;
+
     /// The stream is valid.
     operator bool() const NOEXCEPT override;
 
@@ -173,6 +182,7 @@ private:
 
     IStream& stream_;
     size_t remaining_;
+    std::pmr::memory_resource* arena_;
 };
 
 } // namespace system
@@ -20,6 +20,7 @@
 #define LIBBITCOIN_SYSTEM_STREAM_STREAMERS_INTERFACES_BYTEREADER_HPP
 
 #include <iostream>
+#include <memory_resource>
 #include <string>
 
 #include <bitcoin/system/data/data.hpp>
@@ -116,6 +117,14 @@ public:
     /// Invalidate the stream.
     virtual void invalidate() NOEXCEPT = 0;
 
+    /// Memory resource for deserialized shared chain objects and their control
+    /// blocks (nullptr implies heap). Contained data_chunk and operation
+    /// buffers are always heap allocated.
+    virtual std::pmr::memory_resource* get_arena() const NOEXCEPT = 0;
+
+    /// Set memory resource, which must outlive all deserialized objects.
+    virtual void set_arena(std::pmr::memory_resource* arena) NOEXCEPT = 0;
+
     /// The stream is valid.
     virtual operator bool() const NOEXCEPT = 0;
 
@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -93,6 +94,12 @@ public:
     hd_private derive_private(uint32_t index) const NOEXCEPT;
     hd_public derive_public(uint32_t index) const NOEXCEPT;
 
+    /// Derive count children from first, for gap scanning.
+    /// The hmac key and fingerprint are processed only once.
+    /// Empty if the range is not derivable, a failed child is invalid.
+    std::vector<hd_private> derive_private_range(uint32_t first,
+        size_t count) const NOEXCEPT;
+
 private:
     /// Factories.
     static hd_private from_entropy(const data_slice& seed,
@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
@@ -101,6 +102,12 @@ public:
     hd_key to_hd_key() const NOEXCEPT;
     hd_public derive_public(uint32_t index) const NOEXCEPT;
 
+    /// Derive count children from first (non-hardened), for gap scanning.
+    /// The parent point, hmac key and fingerprint are processed only once.
+    /// Empty if the range is not derivable, a failed child is invalid.
+    std::vector<hd_public> derive_public_range(uint32_t first,
+        size_t count) const NOEXCEPT;
+
 protected:
     /// Factories.
     static hd_public from_secret(const ec_secret& secret,
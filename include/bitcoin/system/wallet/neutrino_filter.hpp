@@ -42,6 +42,21 @@ struct BC_API block_filter
 bool BC_API compute_filter(const chain::block& block,
     data_chunk& out_filter) NOEXCEPT;
 
+/// Prevout scripts of all non-coinbase inputs (in any order) are required.
+bool BC_API compute_filter(const chain::block_view& block,
+    const std_vector<data_slice>& prevout_scripts,
+    data_chunk& out_filter) NOEXCEPT;
+
+/// Compute the filter and its header, chained to the previous header.
+bool BC_API compute_filter(const chain::block& block,
+    const hash_digest& previous_header, data_chunk& out_filter,
+    hash_digest& out_header) NOEXCEPT;
+
+bool BC_API compute_filter(const chain::block_view& block,
+    const std_vector<data_slice>& prevout_scripts,
+    const hash_digest& previous_header, data_chunk& out_filter,
+    hash_digest& out_header) NOEXCEPT;
+
 hash_digest BC_API compute_filter_header(const hash_digest& previous_block,
     const data_chunk& filter) NOEXCEPT;
 
@@ -19,6 +19,7 @@
 #include <bitcoin/system/chain/block.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cfenv>
 #include <iterator>
 #include <memory>
@@ -27,18 +28,21 @@
 #include <unordered_set>
 #include <utility>
 #include <unordered_map>
+#include <vector>
 #include <bitcoin/system/chain/context.hpp>
 #include <bitcoin/system/chain/enums/forks.hpp>
 #include <bitcoin/system/chain/enums/magic_numbers.hpp>
 #include <bitcoin/system/chain/enums/opcode.hpp>
 #include <bitcoin/system/chain/point.hpp>
 #include <bitcoin/system/chain/script.hpp>
+#include <bitcoin/system/crypto/crypto.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
 #include <bitcoin/system/error/error.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/settings.hpp>
 #include <bitcoin/system/stream/stream.hpp>
+#include "../parallel.hpp"
 
 namespace libbitcoin {
 namespace system {
@@ -125,17 +129,18 @@ bool block::operator!=(const block& other) const NOEXCEPT
 // static/private
 block block::from_data(reader& source, bool witness) NOEXCEPT
 {
-    const auto read_transactions = [witness](reader& source) NOEXCEPT
+    // Shared objects are allocated from the reader's arena (or heap if not
+    // set), though the buffers that they own are allocated from the heap.
+    const auto arena = source.get_arena();
+    const auto read_transactions = [=](reader& source) NOEXCEPT
     {
         auto txs = to_shared<transaction_ptrs>();
         txs->reserve(source.read_size(max_block_size));
 
         for (size_t tx = 0; tx < txs->capacity(); ++tx)
         {
-            BC_PUSH_WARNING(NO_NEW_OR_DELETE)
             BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-            txs->emplace_back(new transaction{ source, witness });
-            BC_POP_WARNING()
+            txs->push_back(to_allocated<transaction>(arena, source, witness));
             BC_POP_WARNING()
         }
 
@@ -144,7 +149,7 @@ block block::from_data(reader& source, bool witness) NOEXCEPT
 
     return
     {
-        to_shared<chain::header>(source),
+        to_allocated<chain::header>(arena, source),
         read_transactions(source),
         source
     };
@@ -226,18 +231,76 @@ hashes block::transaction_hashes(bool witness) const NOEXCEPT
 {
     const auto count = txs_->size();
     const auto size = is_odd(count) && count > one ? add1(count) : count;
-    hashes out(size);
+
+    // Cached tx hashes are used if all are computed (e.g. by block.check).
+    const auto hashed = [](const transaction::cptr& tx) NOEXCEPT
+    {
+        return tx->is_hashed();
+    };
+
+    if (std::all_of(txs_->begin(), txs_->end(), hashed))
+    {
+        const auto hash = [witness](const transaction::cptr& tx) NOEXCEPT
+        {
+            return tx->hash(witness);
+        };
+
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        hashes out(size);
+        BC_POP_WARNING()
+
+        // Extra allocation for odd count optimizes for merkle root.
+        // Vector capacity is never reduced when resizing to smaller size.
+        out.resize(count);
+        std::transform(txs_->begin(), txs_->end(), out.begin(), hash);
+        return out;
+    }
+
+    const auto sum = [witness](size_t total, const transaction::cptr& tx)
+        NOEXCEPT
+    {
+        return total + tx->serialized_size(witness);
+    };
+
+    // Transactions are serialized to one buffer, and then double hashed in
+    // parallel lanes (vectorized), as opposed to one streamed tx at a time.
+    const auto bytes = std::accumulate(txs_->begin(), txs_->end(), zero, sum);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_chunk buffer(bytes);
+    sha256::messages_t messages{};
+    messages.reserve(count);
+    write::bytes::copy sink(buffer);
+    BC_POP_WARNING()
+
+    auto position = buffer.data();
+    for (const auto& tx: *txs_)
+    {
+        const auto next = std::next(position, tx->serialized_size(witness));
+        tx->to_data(sink, witness);
+        messages.emplace_back(position, next);
+        position = next;
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    hashes out(sha256::double_hashes(messages));
 
     // Extra allocation for odd count optimizes for merkle root.
     // Vector capacity is never reduced when resizing to smaller size.
-    out.resize(count);
+    out.reserve(size);
+    BC_POP_WARNING()
 
-    const auto hash = [witness](const transaction::cptr& tx) NOEXCEPT
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    if (witness)
     {
-        return tx->hash(witness);
-    };
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto& tx = (*txs_)[index];
+            if (tx->is_segregated() && tx->is_coinbase())
+                out[index] = null_hash;
+        }
+    }
 
-    std::transform(txs_->begin(), txs_->end(), out.begin(), hash);
     return out;
 }
 
@@ -582,6 +645,53 @@ code block::accept_transactions(const context& state) const NOEXCEPT
     return error::block_success;
 }
 
+bool block::connect_deferred(const context& state,
+    boost::asio::thread_pool& pool) const NOEXCEPT
+{
+    // Scripts are evaluated concurrently by tx, collecting signature checks.
+    const auto count = txs_->size();
+    std::atomic_bool valid{ true };
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<ec_signature_checks> checks(count);
+    BC_POP_WARNING()
+
+    parallel_for(pool, count, [&](size_t index) NOEXCEPT
+    {
+        if (valid.load(std::memory_order_relaxed) &&
+            (*txs_)[index]->connect(state, checks[index]))
+            valid.store(false, std::memory_order_relaxed);
+    });
+
+    if (!valid.load())
+        return false;
+
+    // Signatures are then verified as one batch, balanced across the pool.
+    const auto size = std::accumulate(checks.begin(), checks.end(), zero,
+        [](size_t total, const ec_signature_checks& tx) NOEXCEPT
+        {
+            return total + tx.size();
+        });
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    ec_signature_checks batch{};
+    batch.reserve(size);
+    for (auto& tx: checks)
+        batch.insert(batch.end(), std::make_move_iterator(tx.begin()),
+            std::make_move_iterator(tx.end()));
+    BC_POP_WARNING()
+
+    if (!verify_signatures(batch, pool))
+        return false;
+
+    // Verified signatures are cached (e.g. for reorganization or tx pool).
+    auto& cache = signature_cache::instance();
+    for (const auto& check: batch)
+        cache.insert(check.point, check.hash, check.signature);
+
+    return true;
+}
+
 code block::connect_transactions(const context& state) const NOEXCEPT
 {
     code ec;
@@ -593,6 +703,41 @@ code block::connect_transactions(const context& state) const NOEXCEPT
     return error::block_success;
 }
 
+code block::connect_transactions(const context& state,
+    boost::asio::thread_pool& pool) const NOEXCEPT
+{
+    // Deferred signature verification is optimistic, so any failure is
+    // resolved by undeferred evaluation, which determines the exact code.
+    if (connect_deferred(state, pool))
+        return error::block_success;
+
+    // Transactions are claimed in order and those above the lowest known
+    // failure are skipped, so the result matches sequential connect. Inputs
+    // are connected sequentially, as the pool is occupied by tx.
+    const auto count = txs_->size();
+    std::atomic<size_t> lowest{ count };
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<code> codes(count);
+    BC_POP_WARNING()
+
+    parallel_for(pool, count, [&](size_t index) NOEXCEPT
+    {
+        if (index > lowest.load(std::memory_order_relaxed))
+            return;
+
+        if ((codes[index] = (*txs_)[index]->connect(state)))
+        {
+            auto current = lowest.load(std::memory_order_relaxed);
+            while (index < current &&
+                !lowest.compare_exchange_weak(current, index));
+        }
+    });
+
+    const auto index = lowest.load();
+    return index < count ? codes[index] : error::block_success;
+}
+
 // Validation.
 // ----------------------------------------------------------------------------
 
@@ -694,6 +839,12 @@ code block::connect(const context& state) const NOEXCEPT
     return connect_transactions(state);
 }
 
+code block::connect(const context& state,
+    boost::asio::thread_pool& pool) const NOEXCEPT
+{
+    return connect_transactions(state, pool);
+}
+
 // JSON value convertors.
 // ----------------------------------------------------------------------------
 
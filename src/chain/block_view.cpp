@@ -0,0 +1,462 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/chain/block_view.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/system/chain/block.hpp>
+#include <bitcoin/system/chain/enums/magic_numbers.hpp>
+#include <bitcoin/system/chain/header.hpp>
+#include <bitcoin/system/chain/point.hpp>
+#include <bitcoin/system/chain/transaction.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+#include <bitcoin/system/stream/stream.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace chain {
+
+// Minimal transaction serialization, bounds record counts by remaining bytes.
+// version(4) + inputs(1) + input(41) + outputs(1) + output(9) + locktime(4).
+constexpr size_t minimum_transaction_size = 60;
+
+// Views are created only by block_view, with indexes guarded by its records.
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// input_view
+// ----------------------------------------------------------------------------
+
+input_view::input_view(const block_view& block, size_t index) NOEXCEPT
+  : block_(&block), index_(index)
+{
+}
+
+hash_digest input_view::previous_hash() const NOEXCEPT
+{
+    hash_digest out{};
+    std::copy_n(block_->inputs_[index_].previous_hash, hash_size, out.begin());
+    return out;
+}
+
+uint32_t input_view::previous_index() const NOEXCEPT
+{
+    return block_->inputs_[index_].previous_index;
+}
+
+const data_slice& input_view::script() const NOEXCEPT
+{
+    return block_->inputs_[index_].script;
+}
+
+uint32_t input_view::sequence() const NOEXCEPT
+{
+    return block_->inputs_[index_].sequence;
+}
+
+size_t input_view::witness_count() const NOEXCEPT
+{
+    return block_->inputs_[index_].witness_count;
+}
+
+const data_slice& input_view::witness_at(size_t index) const NOEXCEPT
+{
+    return block_->witnesses_[block_->inputs_[index_].witness_offset + index];
+}
+
+chain::point input_view::point() const NOEXCEPT
+{
+    return { previous_hash(), previous_index() };
+}
+
+bool input_view::is_null() const NOEXCEPT
+{
+    const auto hash = block_->inputs_[index_].previous_hash;
+    return previous_index() == chain::point::null_index &&
+        std::equal(null_hash.begin(), null_hash.end(), hash);
+}
+
+// output_view
+// ----------------------------------------------------------------------------
+
+output_view::output_view(const block_view& block, size_t index) NOEXCEPT
+  : block_(&block), index_(index)
+{
+}
+
+uint64_t output_view::value() const NOEXCEPT
+{
+    return block_->outputs_[index_].value;
+}
+
+const data_slice& output_view::script() const NOEXCEPT
+{
+    return block_->outputs_[index_].script;
+}
+
+// transaction_view
+// ----------------------------------------------------------------------------
+
+transaction_view::transaction_view(const block_view& block,
+    size_t index) NOEXCEPT
+  : block_(&block), index_(index)
+{
+}
+
+uint32_t transaction_view::version() const NOEXCEPT
+{
+    return block_->transactions_[index_].version;
+}
+
+size_t transaction_view::input_count() const NOEXCEPT
+{
+    return block_->transactions_[index_].input_count;
+}
+
+input_view transaction_view::input_at(size_t index) const NOEXCEPT
+{
+    return { *block_, block_->transactions_[index_].input_offset + index };
+}
+
+size_t transaction_view::output_count() const NOEXCEPT
+{
+    return block_->transactions_[index_].output_count;
+}
+
+output_view transaction_view::output_at(size_t index) const NOEXCEPT
+{
+    return { *block_, block_->transactions_[index_].output_offset + index };
+}
+
+uint32_t transaction_view::locktime() const NOEXCEPT
+{
+    return block_->transactions_[index_].locktime;
+}
+
+hash_digest transaction_view::hash(bool witness) const NOEXCEPT
+{
+    const auto& tx = block_->transactions_[index_];
+
+    // Witness coinbase tx hash is assumed to be null_hash (bip141).
+    if (witness && tx.segregated && is_coinbase())
+        return null_hash;
+
+    // If no inputs are witness programs then witness hash is tx hash.
+    if (witness || !tx.segregated)
+        return bitcoin_hash(tx.data.size(), tx.data.data());
+
+    // Nominal is witness serialization less marker, flag and witnesses.
+    constexpr auto version = sizeof(uint32_t);
+    constexpr auto locktime = sizeof(uint32_t);
+    constexpr auto marker = two;
+    const auto body = tx.witness_start - version - marker;
+    const auto begin = tx.data.data();
+
+    accumulator<sha256> context{};
+    context.write(version, begin);
+    context.write(body, std::next(begin, version + marker));
+    context.write(locktime, std::next(begin, tx.data.size() - locktime));
+    return context.double_flush();
+}
+
+bool transaction_view::is_coinbase() const NOEXCEPT
+{
+    return input_count() == one && input_at(zero).is_null();
+}
+
+bool transaction_view::is_segregated() const NOEXCEPT
+{
+    return block_->transactions_[index_].segregated;
+}
+
+size_t transaction_view::serialized_size(bool witness) const NOEXCEPT
+{
+    const auto& tx = block_->transactions_[index_];
+    if (witness || !tx.segregated)
+        return tx.data.size();
+
+    // Marker and flag are excluded, locktime follows witnesses.
+    return tx.witness_start - two + sizeof(uint32_t);
+}
+
+const data_slice& transaction_view::data() const NOEXCEPT
+{
+    return block_->transactions_[index_].data;
+}
+
+chain::transaction transaction_view::to_transaction(
+    bool witness) const NOEXCEPT
+{
+    return chain::transaction{ data(), witness };
+}
+
+// block_view
+// ----------------------------------------------------------------------------
+
+block_view::block_view() NOEXCEPT
+  : block_view(data_slice{})
+{
+}
+
+block_view::block_view(const chunk_cptr& data) NOEXCEPT
+  : block_view(data ? data_slice{ *data } : data_slice{})
+{
+    buffer_ = data;
+}
+
+block_view::block_view(const data_slice& data) NOEXCEPT
+  : data_(data), valid_(false)
+{
+    read::bytes::copy source(data_);
+    valid_ = parse(source);
+
+    // The view references only the bytes consumed by the block.
+    if (valid_)
+        data_.resize(source.get_read_position());
+}
+
+// private
+bool block_view::parse(reader& source) NOEXCEPT
+{
+    header_ = chain::header{ source };
+    const auto count = source.read_size(max_block_size);
+    if (!source)
+        return false;
+
+    // Each transaction has at least one input and one output, so these are
+    // reserved by count and grow geometrically for larger transactions. The
+    // count is untrusted, so reservation is capped by the remaining bytes.
+    const auto remaining = floored_subtract(data_.size(),
+        source.get_read_position());
+    const auto reserve = lesser(count, remaining / minimum_transaction_size);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    transactions_.reserve(reserve);
+    inputs_.reserve(reserve);
+    outputs_.reserve(reserve);
+    BC_POP_WARNING()
+
+    for (size_t tx = 0; tx < count; ++tx)
+        if (!parse_transaction(source))
+            return false;
+
+    return true;
+}
+
+// private
+bool block_view::parse_transaction(reader& source) NOEXCEPT
+{
+    const auto begin = data_.data();
+    const auto start = source.get_read_position();
+    const auto slice = [&](size_t position) NOEXCEPT
+    {
+        return data_slice
+        {
+            std::next(begin, position),
+            std::next(begin, source.get_read_position())
+        };
+    };
+
+    transaction_record tx{};
+    tx.version = source.read_4_bytes_little_endian();
+    tx.input_offset = inputs_.size();
+    tx.input_count = source.read_size(max_block_size);
+
+    // Detect witness as no inputs (marker) and expected flag (bip144).
+    tx.segregated =
+        tx.input_count == witness_marker &&
+        source.peek_byte() == witness_enabled;
+
+    if (tx.segregated)
+    {
+        // Skip over the peeked witness flag.
+        source.skip_byte();
+        tx.input_count = source.read_size(max_block_size);
+    }
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    for (size_t input = 0; input < tx.input_count; ++input)
+    {
+        input_record in{};
+        const auto previous = source.get_read_position();
+        source.skip_bytes(hash_size);
+        in.previous_index = source.read_4_bytes_little_endian();
+        const auto size = source.read_size(max_block_size);
+        const auto script = source.get_read_position();
+        source.skip_bytes(size);
+        if (!source)
+            return false;
+
+        in.previous_hash = std::next(begin, previous);
+        in.script = slice(script);
+        in.sequence = source.read_4_bytes_little_endian();
+        in.witness_offset = witnesses_.size();
+        inputs_.push_back(in);
+    }
+
+    tx.output_offset = outputs_.size();
+    tx.output_count = source.read_size(max_block_size);
+    for (size_t output = 0; output < tx.output_count; ++output)
+    {
+        output_record out{};
+        out.value = source.read_8_bytes_little_endian();
+        const auto size = source.read_size(max_block_size);
+        const auto script = source.get_read_position();
+        source.skip_bytes(size);
+        if (!source)
+            return false;
+
+        out.script = slice(script);
+        outputs_.push_back(out);
+    }
+
+    tx.witness_start = source.get_read_position() - start;
+    if (tx.segregated)
+    {
+        for (size_t input = 0; input < tx.input_count; ++input)
+        {
+            auto& in = inputs_[tx.input_offset + input];
+            in.witness_offset = witnesses_.size();
+            in.witness_count = source.read_size(max_block_weight);
+            for (size_t element = 0; element < in.witness_count; ++element)
+            {
+                const auto size = source.read_size(max_block_weight);
+                const auto witness = source.get_read_position();
+                source.skip_bytes(size);
+                if (!source)
+                    return false;
+
+                witnesses_.push_back(slice(witness));
+            }
+        }
+    }
+
+    tx.locktime = source.read_4_bytes_little_endian();
+    if (!source)
+        return false;
+
+    tx.data = slice(start);
+    transactions_.push_back(tx);
+    BC_POP_WARNING()
+    return true;
+}
+
+// Properties.
+// ----------------------------------------------------------------------------
+
+bool block_view::is_valid() const NOEXCEPT
+{
+    return valid_;
+}
+
+const chain::header& block_view::header() const NOEXCEPT
+{
+    return header_;
+}
+
+size_t block_view::transaction_count() const NOEXCEPT
+{
+    return transactions_.size();
+}
+
+transaction_view block_view::transaction_at(size_t index) const NOEXCEPT
+{
+    return { *this, index };
+}
+
+hashes block_view::transaction_hashes(bool witness) const NOEXCEPT
+{
+    const auto count = transactions_.size();
+    const auto size = is_odd(count) && count > one ? add1(count) : count;
+
+    // Contiguous serializations are double hashed in parallel lanes. Nominal
+    // hashes of segregated txs and witness hashes of segregated coinbases are
+    // not contiguous in the buffer, and are computed individually.
+    const auto batched = [&](size_t index) NOEXCEPT
+    {
+        return !transactions_[index].segregated ||
+            (witness && !transaction_at(index).is_coinbase());
+    };
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    hashes out(size);
+    sha256::messages_t messages{};
+    messages.reserve(count);
+    BC_POP_WARNING()
+
+    for (size_t index = 0; index < count; ++index)
+        if (batched(index))
+            messages.push_back(transactions_[index].data);
+
+    // Extra allocation for odd count optimizes for merkle root.
+    // Vector capacity is never reduced when resizing to smaller size.
+    out.resize(count);
+
+    const auto digests = sha256::double_hashes(messages);
+    auto digest = digests.begin();
+    for (size_t index = 0; index < count; ++index)
+    {
+        out[index] = batched(index) ? *digest++ :
+            transaction_at(index).hash(witness);
+    }
+
+    return out;
+}
+
+hash_digest block_view::hash() const NOEXCEPT
+{
+    return header_.hash();
+}
+
+bool block_view::is_segregated() const NOEXCEPT
+{
+    return std::any_of(transactions_.begin(), transactions_.end(),
+        [](const transaction_record& tx) NOEXCEPT { return tx.segregated; });
+}
+
+size_t block_view::serialized_size(bool witness) const NOEXCEPT
+{
+    if (witness)
+        return data_.size();
+
+    const auto count = transactions_.size();
+    auto total = chain::header::serialized_size() + variable_size(count);
+    for (size_t index = 0; index < count; ++index)
+        total += transaction_at(index).serialized_size(false);
+
+    return total;
+}
+
+const data_slice& block_view::data() const NOEXCEPT
+{
+    return data_;
+}
+
+chain::block block_view::to_block(bool witness) const NOEXCEPT
+{
+    return chain::block{ data_, witness };
+}
+
+BC_POP_WARNING()
+
+} // namespace chain
+} // namespace system
+} // namespace libbitcoin
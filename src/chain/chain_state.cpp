@@ -48,6 +48,12 @@ static const checkpoint mainnet_bip30_exception_checkpoint2
     "00000000000743f190a18c5577a3c2d2a1f610ae9601ac046a38084ccb7cd721", 91880
 };
 
+// github.com/bitcoin/bitcoin/pull/23536 (block violates taproot script rules).
+static const checkpoint mainnet_taproot_exception_checkpoint
+{
+    "0000000000000000000f14c35b2d841e986ab5441de8c585d5ffe55ea1e395ad", 692261
+};
+
 // Inlines.
 // ----------------------------------------------------------------------------
 
@@ -82,6 +88,11 @@ inline bool is_bip30_exception(const checkpoint& check, bool mainnet) NOEXCEPT
          (check == mainnet_bip30_exception_checkpoint2));
 }
 
+inline bool is_taproot_exception(const checkpoint& check, bool mainnet) NOEXCEPT
+{
+    return mainnet && (check == mainnet_taproot_exception_checkpoint);
+}
+
 inline uint32_t timestamp_high(const chain_state::data& values) NOEXCEPT
 {
     return values.timestamp.ordered.back();
@@ -92,42 +103,40 @@ inline uint32_t bits_high(const chain_state::data& values) NOEXCEPT
     return values.bits.ordered.back();
 }
 
+//*****************************************************************************
+// CONSENSUS: Though unspecified in bip34, the satoshi implementation
+// performed this comparison using the signed integer version value.
+//*****************************************************************************
+constexpr size_t is_version_ge(uint32_t value, uint32_t version) NOEXCEPT
+{
+    return to_int<size_t>(sign_cast<int32_t>(value) >=
+        sign_cast<int32_t>(version));
+}
+
 // activation
 // ----------------------------------------------------------------------------
 
 chain_state::activations chain_state::activation(const data& values,
     uint32_t forks, const system::settings& settings) NOEXCEPT
+{
+    return activation(values, to_tallies(values, settings), forks, settings);
+}
+
+chain_state::activations chain_state::activation(const data& values,
+    const tallies& counts, uint32_t forks,
+    const system::settings& settings) NOEXCEPT
 {
     const auto height = values.height;
     const auto version = values.version.self;
-    const auto& history = values.version.ordered;
     const auto frozen = script::is_enabled(forks, forks::bip90_rule);
     const auto difficult = script::is_enabled(forks, forks::difficult);
     const auto retarget = script::is_enabled(forks, forks::retarget);
     const auto mainnet = retarget && difficult;
 
-    // C++17: lambda closure types are literal types (use constexpr).
-    //*************************************************************************
-    // CONSENSUS: Though unspecified in bip34, the satoshi implementation
-    // performed this comparison using the signed integer version value.
-    //*************************************************************************
-    const auto ge = [](uint32_t value, uint32_t version) NOEXCEPT
-    {
-        return sign_cast<int32_t>(value) >= sign_cast<int32_t>(version);
-    };
-
-    // Declare bip34-based version predicates.
-    const auto ge_2 = [&](uint32_t value) NOEXCEPT { return ge(value,
-        settings.bip34_version); };
-    const auto ge_3 = [&](uint32_t value) NOEXCEPT { return ge(value,
-        settings.bip66_version); };
-    const auto ge_4 = [&](uint32_t value) NOEXCEPT { return ge(value,
-        settings.bip65_version); };
-
-    // Compute bip34-based activation version summaries.
-    const auto count_2 = std::count_if(history.begin(), history.end(), ge_2);
-    const auto count_3 = std::count_if(history.begin(), history.end(), ge_3);
-    const auto count_4 = std::count_if(history.begin(), history.end(), ge_4);
+    // Bip34-based activation version summaries.
+    const auto count_2 = counts.bip34;
+    const auto count_3 = counts.bip66;
+    const auto count_4 = counts.bip65;
 
     // Frozen activations (require version and enforce above freeze height).
     const auto bip34_ice = frozen && height >= settings.bip34_freeze;
@@ -204,6 +213,14 @@ chain_state::activations chain_state::activation(const data& values,
     if (values.bip9_bit1_hash == settings.bip9_bit1_active_checkpoint.hash())
     {
         result.forks |= (forks::bip9_bit1_group & forks);
+
+        // taproot is buried, active with bip141 for all but one mainnet block.
+        // That block spends a v1 witness output in violation of bip341, and
+        // no other block prior to activation violates the rules.
+        if (!is_taproot_exception({ values.hash, height }, mainnet))
+        {
+            result.forks |= (forks::taproot_group & forks);
+        }
     }
 
     // version 4/3/2 enforced based on 95% of preceding 1000 mainnet blocks.
@@ -294,6 +311,99 @@ size_t chain_state::bip9_bit1_height(size_t height,
     return height > activation_height ? activation_height : map::unrequested;
 }
 
+// tallies
+// ----------------------------------------------------------------------------
+
+chain_state::tallies chain_state::to_tallies(const data& values,
+    const system::settings& settings) NOEXCEPT
+{
+    tallies counts{};
+    for (const auto version: values.version.ordered)
+    {
+        counts.bip34 += is_version_ge(version, settings.bip34_version);
+        counts.bip66 += is_version_ge(version, settings.bip66_version);
+        counts.bip65 += is_version_ge(version, settings.bip65_version);
+    }
+
+    return counts;
+}
+
+// Promotion pushes the parent version and pops the oldest if full.
+chain_state::tallies chain_state::roll_tallies(const chain_state& parent,
+    const data& values, const system::settings& settings) NOEXCEPT
+{
+    const auto& prior = parent.data_.version.ordered;
+    const auto& history = values.version.ordered;
+    const auto popped = (history.size() == prior.size());
+
+    if (history.empty())
+        return {};
+
+    if (!popped && history.size() != add1(prior.size()))
+        return to_tallies(values, settings);
+
+    auto counts = parent.tallies_;
+    const auto pushed = history.back();
+    counts.bip34 += is_version_ge(pushed, settings.bip34_version);
+    counts.bip66 += is_version_ge(pushed, settings.bip66_version);
+    counts.bip65 += is_version_ge(pushed, settings.bip65_version);
+
+    if (popped)
+    {
+        const auto expired = prior.front();
+        counts.bip34 -= is_version_ge(expired, settings.bip34_version);
+        counts.bip66 -= is_version_ge(expired, settings.bip66_version);
+        counts.bip65 -= is_version_ge(expired, settings.bip65_version);
+    }
+
+    return counts;
+}
+
+// Only the most recent median_time_past_interval timestamps are sampled.
+chain_state::sample chain_state::to_sample(const data& values) NOEXCEPT
+{
+    const auto& history = values.timestamp.ordered;
+
+    sample times{};
+    times.size = std::min(history.size(), times.times.size());
+    const auto first = std::next(history.begin(), history.size() - times.size);
+    const auto last = std::copy(first, history.end(), times.times.begin());
+    std::sort(times.times.begin(), last);
+    return times;
+}
+
+// Promotion pushes the parent timestamp and pops the oldest if full.
+chain_state::sample chain_state::roll_sample(const chain_state& parent,
+    const data& values) NOEXCEPT
+{
+    const auto& prior = parent.data_.timestamp.ordered;
+    const auto& history = values.timestamp.ordered;
+    const auto popped = (history.size() == prior.size());
+
+    if (history.empty() || history.size() > median_time_past_interval ||
+        parent.sample_.size != prior.size() ||
+        (!popped && history.size() != add1(prior.size())))
+        return to_sample(values);
+
+    auto times = parent.sample_;
+    const auto begin = times.times.begin();
+
+    // Remove one instance of the expired timestamp, preserving order.
+    if (popped)
+    {
+        const auto end = std::next(begin, times.size--);
+        const auto it = std::lower_bound(begin, end, prior.front());
+        std::copy(std::next(it), end, it);
+    }
+
+    // Insert the promoted timestamp, preserving order.
+    const auto end = std::next(begin, times.size++);
+    const auto it = std::upper_bound(begin, end, history.back());
+    std::copy_backward(it, end, std::next(end));
+    *it = history.back();
+    return times;
+}
+
 // work_required
 // ----------------------------------------------------------------------------
 
@@ -498,15 +608,17 @@ uint32_t chain_state::signal_version(uint32_t forks,
 //*****************************************************************************
 uint32_t chain_state::median_time_past(const data& values, uint32_t) NOEXCEPT
 {
-    // Sort the times by value to obtain the median.
-    auto times = sort_copy(values.timestamp.ordered);
+    return median_time_past(to_sample(values));
+}
 
+uint32_t chain_state::median_time_past(const sample& times) NOEXCEPT
+{
     // Consensus defines median time using modulo 2 element selection.
     // This differs from arithmetic median which averages two middle values.
 
     // times[] indexation is guarded.
     BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-    return times.empty() ? 0 : times[to_half(times.size())];
+    return is_zero(times.size) ? 0 : times.times[to_half(times.size)];
     BC_POP_WARNING()
 }
 
@@ -577,9 +689,11 @@ chain_state::chain_state(const chain_state& top,
     forks_(top.forks_),
     stale_seconds_(top.stale_seconds_),
     checkpoints_(top.checkpoints_),
-    active_(activation(data_, forks_, settings)),
+    tallies_(roll_tallies(top, data_, settings)),
+    sample_(roll_sample(top, data_)),
+    active_(activation(data_, tallies_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(sample_))
 {
 }
 
@@ -618,9 +732,11 @@ chain_state::chain_state(const chain_state& pool, const block& block,
     forks_(pool.forks_),
     stale_seconds_(pool.stale_seconds_),
     checkpoints_(pool.checkpoints_),
-    active_(activation(data_, forks_, settings)),
+    tallies_(pool.tallies_),
+    sample_(pool.sample_),
+    active_(activation(data_, tallies_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(sample_))
 {
 }
 
@@ -658,9 +774,11 @@ chain_state::chain_state(const chain_state& parent, const header& header,
     forks_(parent.forks_),
     stale_seconds_(parent.stale_seconds_),
     checkpoints_(parent.checkpoints_),
-    active_(activation(data_, forks_, settings)),
+    tallies_(roll_tallies(parent, data_, settings)),
+    sample_(roll_sample(parent, data_)),
+    active_(activation(data_, tallies_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(sample_))
 {
 }
 
@@ -672,9 +790,11 @@ chain_state::chain_state(data&& values, const checkpoints& checkpoints,
     forks_(forks),
     stale_seconds_(stale_seconds),
     checkpoints_(checkpoints),
-    active_(activation(data_, forks_, settings)),
+    tallies_(to_tallies(data_, settings)),
+    sample_(to_sample(data_)),
+    active_(activation(data_, tallies_, forks_, settings)),
     work_required_(work_required(data_, forks_, settings)),
-    median_time_past_(median_time_past(data_, forks_))
+    median_time_past_(median_time_past(sample_))
 {
 }
 
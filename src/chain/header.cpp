@@ -18,6 +18,7 @@
  */
 #include <bitcoin/system/chain/header.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <utility>
 #include <bitcoin/system/chain/chain_state.hpp>
@@ -229,17 +230,47 @@ hash_digest header::hash() const NOEXCEPT
     return digest;
 }
 
+// static
+hashes header::to_hashes(const std::vector<cptr>& headers) NOEXCEPT
+{
+    constexpr auto size = serialized_size();
+    const auto count = headers.size();
+    if (is_zero(count))
+        return {};
+
+    // Headers are serialized to one buffer, and then double hashed in
+    // parallel lanes (vectorized), as opposed to one streamed header at a
+    // time. Any remainder not hashed by a kernel is hashed individually.
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    data_chunk buffer(count * size);
+    hashes out(count);
+    BC_POP_WARNING()
+
+    write::bytes::copy sink(buffer);
+    for (const auto& header: headers)
+        header->to_data(sink);
+
+    const auto data = buffer.data();
+    const auto hashed = sha::dispatch::headers(out.front().data(), data,
+        count);
+
+    for (auto index = hashed; index < count; ++index)
+        out[index] = bitcoin_hash(size, std::next(data, index * size));
+
+    return out;
+}
+
 // static/private
 uint256_t header::difficulty(uint32_t bits) NOEXCEPT
 {
-    auto target = compact::expand(bits);
+    const auto target = compact::expand<limbs256>(bits);
 
     //*************************************************************************
     // CONSENSUS: bits may be overflowed, which is guarded here.
     // A target of zero is disallowed so is useful as a sentinel value.
     //*************************************************************************
-    if (is_zero(target))
-        return target;
+    if (!target)
+        return {};
 
     //*************************************************************************
     // CONSENSUS: If target is (2^256)-1, division would fail, however compact
@@ -250,7 +281,7 @@ uint256_t header::difficulty(uint32_t bits) NOEXCEPT
     // as it's too large for uint256. However as 2**256 is at least as large as
     // target + 1, it is equal to ((2**256 - target - 1) / (target + 1)) + 1, or
     // (~target / (target + 1)) + 1.
-    return ++(~target / (target + one));
+    return static_cast<uint256_t>(++(~target / (target + one)));
 }
 
 // computed
@@ -266,22 +297,31 @@ uint256_t header::difficulty() const NOEXCEPT
 bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
     bool scrypt) const NOEXCEPT
 {
-    static const auto limit = compact::expand(proof_of_work_limit);
-    const auto target = compact::expand(bits_);
+    // Conditionally use scrypt proof of work (e.g. Litecoin).
+    return is_invalid_proof_of_work(proof_of_work_limit,
+        scrypt ? scrypt_hash(to_data()) : hash());
+}
+
+bool header::is_invalid_proof_of_work(uint32_t proof_of_work_limit,
+    const hash_digest& work_hash) const NOEXCEPT
+{
+    // Native limbs, as uint256_t expansion and comparison dominate this check.
+    // The limit is not cached, as it may vary by caller (e.g. regtest).
+    const auto limit = compact::expand<limbs256>(proof_of_work_limit);
+    const auto target = compact::expand<limbs256>(bits_);
 
     //*************************************************************************
     // CONSENSUS: bits_ may be overflowed, which is guarded here.
     // A target of zero is disallowed so is useful as a sentinel value.
     //*************************************************************************
-    if (is_zero(target))
+    if (!target)
         return true;
 
     // Ensure claimed work is at or above minimum (less is more).
     if (target > limit)
         return true;
 
-    // Conditionally use scrypt proof of work (e.g. Litecoin).
-    return to_uintx(scrypt ? scrypt_hash(to_data()) : hash()) > target;
+    return limbs256{ work_hash } > target;
 }
 
 // ****************************************************************************
@@ -300,6 +340,26 @@ bool header::is_invalid_timestamp(
 // Validation.
 // ----------------------------------------------------------------------------
 
+// Scrypt proofs of work are hashed as a batch (vectorized).
+template <typename Headers>
+static hashes scrypt_work(const Headers& headers) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std_vector<data_chunk> data(headers.size());
+    BC_POP_WARNING()
+
+    std::transform(headers.begin(), headers.end(), data.begin(),
+        [](const auto& item) NOEXCEPT
+        {
+            if constexpr (is_same_type<decltype(item), header::cptr>)
+                return item->to_data();
+            else
+                return item.to_data();
+        });
+
+    return scrypt_hashes({ data.begin(), data.end() });
+}
+
 code header::check(uint32_t timestamp_limit_seconds,
     uint32_t proof_of_work_limit, bool scrypt) const NOEXCEPT
 {
@@ -312,6 +372,71 @@ code header::check(uint32_t timestamp_limit_seconds,
     return error::success;
 }
 
+code header::check(const std::vector<header>& headers,
+    uint32_t timestamp_limit_seconds, uint32_t proof_of_work_limit,
+    bool scrypt) NOEXCEPT
+{
+    if (!scrypt)
+    {
+        for (const auto& header: headers)
+            if (const auto ec = header.check(timestamp_limit_seconds,
+                proof_of_work_limit))
+                return ec;
+
+        return error::success;
+    }
+
+    // Empty (out of memory) is an unverified proof of work.
+    const auto hashes = scrypt_work(headers);
+    if (hashes.size() != headers.size())
+        return error::invalid_proof_of_work;
+
+    for (size_t index = 0; index < headers.size(); ++index)
+    {
+        const auto& header = headers[index];
+        if (header.is_invalid_proof_of_work(proof_of_work_limit,
+            hashes[index]))
+            return error::invalid_proof_of_work;
+
+        if (header.is_invalid_timestamp(timestamp_limit_seconds))
+            return error::futuristic_timestamp;
+    }
+
+    return error::success;
+}
+
+code header::check(const std::vector<cptr>& headers,
+    const hash_digest& previous, uint32_t timestamp_limit_seconds,
+    uint32_t proof_of_work_limit, bool scrypt) NOEXCEPT
+{
+    const auto hashes = to_hashes(headers);
+
+    // Empty (out of memory) is an unverified proof of work.
+    const auto scrypts = scrypt ? scrypt_work(headers) : system::hashes{};
+    if (scrypt && scrypts.size() != headers.size())
+        return error::invalid_proof_of_work;
+
+    // Linkage, proof of work and timestamp are checked in one pass.
+    auto link = &previous;
+    for (size_t index = 0; index < headers.size(); ++index)
+    {
+        const auto& header = *headers[index];
+        if (header.previous_block_hash() != *link)
+            return error::orphan_header;
+
+        if (header.is_invalid_proof_of_work(proof_of_work_limit,
+            scrypt ? scrypts[index] : hashes[index]))
+            return error::invalid_proof_of_work;
+
+        if (header.is_invalid_timestamp(timestamp_limit_seconds))
+            return error::futuristic_timestamp;
+
+        link = &hashes[index];
+    }
+
+    return error::success;
+}
+
 code header::accept(const chain_state& state) const NOEXCEPT
 {
     if (state.is_checkpoint_conflict(hash()))
@@ -165,12 +165,14 @@ bool input::operator!=(const input& other) const NOEXCEPT
 // static/private
 input input::from_data(reader& source) NOEXCEPT
 {
+    const auto arena = source.get_arena();
+
     // Witness is deserialized by transaction.
     return
     {
-        to_shared<chain::point>(source),
-        to_shared<chain::script>(source, true),
-        to_shared<chain::witness>(),
+        to_allocated<chain::point>(arena, source),
+        to_allocated<chain::script>(arena, source, true),
+        to_allocated<chain::witness>(arena),
         source.read_4_bytes_little_endian(),
         source
     };
@@ -166,7 +166,8 @@ operation operation::from_data(reader& source) NOEXCEPT
         return {};
     }
 
-    auto push = to_shared(source.read_bytes(size));
+    auto push = to_allocated<data_chunk>(source.get_arena(),
+        source.read_bytes(size));
     const auto underflow = !source;
 
     // This requires that provided stream terminates at the end of the script.
@@ -179,7 +180,8 @@ operation operation::from_data(reader& source) NOEXCEPT
     {
         code = any_invalid;
         source.set_position(start);
-        push = to_shared(source.read_bytes());
+        push = to_allocated<data_chunk>(source.get_arena(),
+            source.read_bytes());
     }
 
     // All byte vectors are deserializable, stream indicates own failure.
@@ -551,6 +553,11 @@ bool operation::is_reserved() const NOEXCEPT
     return is_reserved(code_);
 }
 
+bool operation::is_success() const NOEXCEPT
+{
+    return is_success(code_);
+}
+
 bool operation::is_conditional() const NOEXCEPT
 {
     return is_conditional(code_);
@@ -115,7 +115,7 @@ output output::from_data(reader& source) NOEXCEPT
     return
     {
         source.read_8_bytes_little_endian(),
-        to_shared<chain::script>(source, true),
+        to_allocated<chain::script>(source.get_arena(), source, true),
         source
     };
 }
@@ -70,13 +70,31 @@ script::~script() NOEXCEPT
 {
 }
 
+// Precomputed metadata is copied, not recomputed.
 script::script(script&& other) NOEXCEPT
-  : script(std::move(other.ops_), other.valid_, other.prefail_)
+  : ops_(std::move(other.ops_)),
+    valid_(other.valid_),
+    prefail_(other.prefail_),
+    roller_(other.roller_),
+    push_only_(other.push_only_),
+    common_pattern_(other.common_pattern_),
+    sigops_(other.sigops_),
+    accurate_sigops_(other.accurate_sigops_),
+    offset(ops_.begin())
 {
 }
 
+// Precomputed metadata is copied, not recomputed.
 script::script(const script& other) NOEXCEPT
-  : script(other.ops_, other.valid_, other.prefail_)
+  : ops_(other.ops_),
+    valid_(other.valid_),
+    prefail_(other.prefail_),
+    roller_(other.roller_),
+    push_only_(other.push_only_),
+    common_pattern_(other.common_pattern_),
+    sigops_(other.sigops_),
+    accurate_sigops_(other.accurate_sigops_),
+    offset(ops_.begin())
 {
 }
 
@@ -138,12 +156,14 @@ script::script(const std::string& mnemonic) NOEXCEPT
 script::script(operations&& ops, bool valid, bool prefail) NOEXCEPT
   : ops_(std::move(ops)), valid_(valid), prefail_(prefail), offset(ops_.begin())
 {
+    initialize_metadata();
 }
 
 // protected
 script::script(const operations& ops, bool valid, bool prefail) NOEXCEPT
   : ops_(ops), valid_(valid), prefail_(prefail), offset(ops_.begin())
 {
+    initialize_metadata();
 }
 
 // Operators.
@@ -154,6 +174,11 @@ script& script::operator=(script&& other) NOEXCEPT
     ops_ = std::move(other.ops_);
     valid_ = other.valid_;
     prefail_ = other.prefail_;
+    roller_ = other.roller_;
+    push_only_ = other.push_only_;
+    common_pattern_ = other.common_pattern_;
+    sigops_ = other.sigops_;
+    accurate_sigops_ = other.accurate_sigops_;
     offset = ops_.begin();
     return *this;
 }
@@ -163,6 +188,11 @@ script& script::operator=(const script& other) NOEXCEPT
     ops_ = other.ops_;
     valid_ = other.valid_;
     prefail_ = other.prefail_;
+    roller_ = other.roller_;
+    push_only_ = other.push_only_;
+    common_pattern_ = other.common_pattern_;
+    sigops_ = other.sigops_;
+    accurate_sigops_ = other.accurate_sigops_;
     offset = ops_.begin();
     return *this;
 }
@@ -386,6 +416,9 @@ script_version script::version() const NOEXCEPT
     {
         case opcode::push_size_0:
             return script_version::zero;
+        case opcode::push_positive_1:
+            return is_pay_taproot_pattern(ops()) ? script_version::taproot :
+                script_version::reserved;
         default:
             return script_version::reserved;
     }
@@ -475,22 +508,79 @@ constexpr bool is_multiple_sigop(opcode code) NOEXCEPT
 
 size_t script::sigops(bool accurate) const NOEXCEPT
 {
-    auto total = zero;
+    return accurate ? accurate_sigops_ : sigops_;
+}
+
+bool script::is_roller() const NOEXCEPT
+{
+    return roller_;
+}
+
+bool script::is_push_only() const NOEXCEPT
+{
+    return push_only_;
+}
+
+script_pattern script::common_pattern() const NOEXCEPT
+{
+    return common_pattern_;
+}
+
+// static/private
+script_pattern script::common_pattern(const operations& ops) NOEXCEPT
+{
+    if (is_pay_key_hash_pattern(ops))
+        return script_pattern::pay_key_hash;
+
+    if (is_pay_script_hash_pattern(ops))
+        return script_pattern::pay_script_hash;
+
+    if (is_pay_witness_key_hash_pattern(ops))
+        return script_pattern::pay_witness_key_hash;
+
+    if (is_pay_witness_script_hash_pattern(ops))
+        return script_pattern::pay_witness_script_hash;
+
+    if (is_pay_taproot_pattern(ops))
+        return script_pattern::pay_taproot;
+
+    return script_pattern::non_standard;
+}
+
+// private
+// Metadata is computed in one pass over ops, as scripts are immutable (other
+// than by assignment) and these are otherwise recomputed in each validation.
+void script::initialize_metadata() NOEXCEPT
+{
     auto preceding = opcode::push_negative_1;
+    roller_ = false;
+    push_only_ = true;
+    sigops_ = zero;
+    accurate_sigops_ = zero;
 
-    for (const auto& op: ops())
+    for (const auto& op: ops_)
     {
         const auto code = op.code();
+        roller_ |= (code == opcode::roll);
+        push_only_ &= operation::is_push(code);
 
         if (is_single_sigop(code))
-            total = ceilinged_add(total, one);
+        {
+            sigops_ = ceilinged_add(sigops_, one);
+            accurate_sigops_ = ceilinged_add(accurate_sigops_, one);
+        }
         else if (is_multiple_sigop(code))
-            total = ceilinged_add(total, multisig_sigops(accurate, preceding));
+        {
+            sigops_ = ceilinged_add(sigops_,
+                multisig_sigops(false, preceding));
+            accurate_sigops_ = ceilinged_add(accurate_sigops_,
+                multisig_sigops(true, preceding));
+        }
 
         preceding = code;
     }
 
-    return total;
+    common_pattern_ = common_pattern(ops_);
 }
 
 bool script::is_oversized() const NOEXCEPT
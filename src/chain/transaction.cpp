@@ -19,6 +19,7 @@
 #include <bitcoin/system/chain/transaction.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <numeric>
@@ -38,6 +39,7 @@
 #include <bitcoin/system/machine/machine.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/stream/stream.hpp>
+#include "../parallel.hpp"
 
 namespace libbitcoin {
 namespace system {
@@ -66,6 +68,28 @@ static const auto& zero_sequence() NOEXCEPT
     return sequence;
 }
 
+// 64 null outputs (9 sha256 blocks), hashed in runs for hash_single.
+static const auto& null_outputs() NOEXCEPT
+{
+    static const auto nulls = [&]() NOEXCEPT
+    {
+        data_chunk out{};
+        for (size_t output = 0; output < 64; ++output)
+            out.insert(out.end(), null_output().begin(), null_output().end());
+
+        return out;
+    }();
+
+    return nulls;
+}
+
+// Unversioned signature hash caching applies from this many inputs.
+constexpr size_t sighash_cache_inputs = 16;
+
+// Each cached input is its point, an empty script and a sequence.
+constexpr auto sighash_entry = point::serialized_size() + one +
+    sizeof(uint32_t);
+
 // Constructors.
 // ----------------------------------------------------------------------------
 
@@ -79,6 +103,9 @@ transaction::transaction() NOEXCEPT
 
 transaction::~transaction() NOEXCEPT
 {
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    delete txid_cache_.load(std::memory_order_acquire);
+    BC_POP_WARNING()
 }
 
 transaction::transaction(transaction&& other) NOEXCEPT
@@ -178,6 +205,13 @@ transaction& transaction::operator=(const transaction& other) NOEXCEPT
     locktime_ = other.locktime_;
     segregated_ = other.segregated_;
     valid_ = other.valid_;
+
+    // Assignment is not thread safe, so neither are these resets.
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    delete txid_cache_.exchange(nullptr, std::memory_order_acq_rel);
+    BC_POP_WARNING()
+    sighash_cache_.reset();
+    taproot_cache_.reset();
     return *this;
 }
 
@@ -211,12 +245,13 @@ read_puts(Source& source) NOEXCEPT
     puts->reserve(source.read_size(max_block_size));
     BC_POP_WARNING()
 
+    // Shared objects are allocated from the reader's arena (or heap if not
+    // set), though the buffers that they own are allocated from the heap.
+    const auto arena = source.get_arena();
     for (auto put = zero; put < puts->capacity(); ++put)
     {
-        BC_PUSH_WARNING(NO_NEW_OR_DELETE)
         BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        puts->emplace_back(new Put{ source });
-        BC_POP_WARNING()
+        puts->push_back(to_allocated<Put>(arena, source));
         BC_POP_WARNING()
     }
 
@@ -257,7 +292,8 @@ transaction transaction::from_data(reader& source, bool witness) NOEXCEPT
                 // Safe to cast as this method exclusively owns the input and
                 // input::witness_ a mutable public property of the instance.
                 const auto setter = const_cast<chain::input*>(input.get());
-                setter->witness_ = to_shared<chain::witness>(source, true);
+                setter->witness_ = to_allocated<chain::witness>(
+                    source.get_arena(), source, true);
             }
             else
             {
@@ -394,15 +430,62 @@ hash_digest transaction::hash(bool witness) const NOEXCEPT
     if (witness && segregated_ && is_coinbase())
         return null_hash;
 
-    // This is an out parameter.
-    BC_PUSH_WARNING(LOCAL_VARIABLE_NOT_INITIALIZED)
-    hash_digest digest;
+    const auto& cache = hashes();
+    return witness ? cache.witness : cache.nominal;
+}
+
+bool transaction::is_hashed() const NOEXCEPT
+{
+    return !is_null(txid_cache_.load(std::memory_order_acquire));
+}
+
+// private
+const transaction::txid_cache& transaction::hashes() const NOEXCEPT
+{
+    if (const auto cached = txid_cache_.load(std::memory_order_acquire))
+        return *cached;
+
+    // Witness serialization contains all nominal serialization bytes.
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto cache = new txid_cache{};
+    BC_POP_WARNING()
     BC_POP_WARNING()
 
-    hash::sha256x2::copy sink(digest);
-    to_data(sink, witness);
-    sink.flush();
-    return digest;
+    const auto data = to_data(true);
+    cache->witness = accumulator<sha256>::double_hash(data);
+
+    // If no inputs are witness programs then witness hash is tx hash.
+    if (!segregated_)
+    {
+        cache->nominal = cache->witness;
+    }
+    else
+    {
+        // Nominal is witness serialization less marker, flag and witnesses.
+        constexpr auto version = sizeof(uint32_t);
+        constexpr auto locktime = sizeof(uint32_t);
+        constexpr auto marker = two;
+        const auto body = serialized_size(false) - version - locktime;
+        const auto begin = data.data();
+
+        accumulator<sha256> context{};
+        context.write(version, begin);
+        context.write(body, std::next(begin, version + marker));
+        context.write(locktime, std::next(begin, data.size() - locktime));
+        cache->nominal = context.double_flush();
+    }
+
+    // Publish once, a concurrent first call may lose and discard its result.
+    const txid_cache* expected{ nullptr };
+    if (txid_cache_.compare_exchange_strong(expected, cache,
+        std::memory_order_acq_rel, std::memory_order_acquire))
+        return *cache;
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    delete cache;
+    BC_POP_WARNING()
+    return *expected;
 }
 
 // Methods.
@@ -683,6 +766,9 @@ hash_digest transaction::unversioned_signature_hash(
     const input_iterator& input, const script& sub,
     uint8_t flags) const NOEXCEPT
 {
+    if (sighash_cache_)
+        return cached_signature_hash(input, sub, flags);
+
     // Set options.
     const auto flag = mask_sighash(flags);
 
@@ -720,11 +806,185 @@ hash_digest transaction::unversioned_signature_hash(
     return digest;
 }
 
+// Signing (unversioned, cached).
+// ----------------------------------------------------------------------------
+// Each unversioned preimage commits to all inputs and outputs, so hashing every
+// input is quadratic. The input segments are serialized once per connect and
+// the sha256 state is saved at each block boundary, so that the preimage of
+// an input resumes from the state preceding its point. The remainder of the
+// preimage must still be hashed, but from contiguous serialized bytes.
+
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+
+// The sha256 state at each block boundary of data (first is initial).
+static std_vector<sha256::state_t> sighash_states(
+    const data_chunk& data) NOEXCEPT
+{
+    constexpr auto block_size = array_count<sha256::block_t>;
+    const auto blocks = data.size() / block_size;
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std_vector<sha256::state_t> states(add1(blocks));
+    BC_POP_WARNING()
+
+    states.front() = sha256::H::get;
+    for (size_t block = 0; block < blocks; ++block)
+    {
+        states[add1(block)] = states[block];
+        sha256::accumulate(states[add1(block)],
+            unsafe_array_cast<uint8_t, block_size>(
+                &data[block * block_size]));
+    }
+
+    return states;
+}
+
+// protected
+void transaction::initialize_sighash_cache() const NOEXCEPT
+{
+    // Version 0 and taproot spends do not use the cache.
+    const auto count = inputs_->size();
+    if (count < sighash_cache_inputs || !is_unversioned_spend())
+    {
+        sighash_cache_.reset();
+        return;
+    }
+
+    BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    sighash_cache_.reset(new sighash_cache{});
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+
+    auto& cache = *sighash_cache_;
+    const auto header = sizeof(uint32_t) + variable_size(count);
+    cache.all.resize(header + count * sighash_entry);
+
+    write::bytes::copy inputs(cache.all);
+    inputs.write_4_bytes_little_endian(version_);
+    inputs.write_variable(count);
+    for (const auto& input: *inputs_)
+    {
+        input->point().to_data(inputs);
+        inputs.write_bytes(empty_script());
+        inputs.write_4_bytes_little_endian(input->sequence());
+    }
+
+    // None and single commit to zero sequences for all other inputs.
+    cache.zeroed = cache.all;
+    constexpr auto sequence = sighash_entry - sizeof(uint32_t);
+    for (auto it = std::next(cache.zeroed.begin(), header + sequence);
+        it < cache.zeroed.end(); it += sighash_entry)
+        std::fill_n(it, sizeof(uint32_t), uint8_t{ 0 });
+
+    cache.all_states = sighash_states(cache.all);
+    cache.zeroed_states = sighash_states(cache.zeroed);
+
+    cache.outputs.resize(variable_size(outputs_->size()) +
+        std::accumulate(outputs_->begin(), outputs_->end(), zero,
+            [](size_t total, const auto& output) NOEXCEPT
+            {
+                return ceilinged_add(total, output->serialized_size());
+            }));
+
+    write::bytes::copy outputs(cache.outputs);
+    outputs.write_variable(outputs_->size());
+    for (const auto& output: *outputs_)
+        output->to_data(outputs);
+}
+
+// protected
+bool transaction::is_sighash_cached() const NOEXCEPT
+{
+    return !is_null(sighash_cache_.get());
+}
+
+// private
+hash_digest transaction::cached_signature_hash(const input_iterator& input,
+    const script& sub, uint8_t flags) const NOEXCEPT
+{
+    constexpr auto block_size = array_count<sha256::block_t>;
+    constexpr auto point_size = point::serialized_size();
+    const auto anyone = to_bool(flags & coverage::anyone_can_pay);
+    const auto flag = mask_sighash(flags);
+    const auto index = input_index(input);
+    const auto& cache = *sighash_cache_;
+
+    // CONSENSUS: return one_hash if index exceeds outputs in sighash.
+    if (flag == coverage::hash_single && index >= outputs_->size())
+        return one_hash;
+
+    const auto all = (flag == coverage::hash_all);
+    const auto& data = all ? cache.all : cache.zeroed;
+    const auto& states = all ? cache.all_states : cache.zeroed_states;
+    const auto start = data.size() - (inputs_->size() - index) * sighash_entry;
+    const auto end = start + sighash_entry;
+
+    accumulator<sha256> context{};
+
+    if (anyone)
+    {
+        // Version and a single input.
+        context.write(sizeof(uint32_t), data.data());
+        context.write(to_array(0x01));
+    }
+    else
+    {
+        // Version, input count and all preceding inputs.
+        const auto blocks = start / block_size;
+        const auto offset = blocks * block_size;
+        context = accumulator<sha256>{ states[blocks], blocks };
+        context.write(start - offset, &data[offset]);
+    }
+
+    context.write(point_size, &data[start]);
+    context.write(sub.to_data(prefixed));
+    context.write(to_little_endian((*input)->sequence()));
+
+    // All following inputs.
+    if (!anyone)
+        context.write(data.size() - end, &data[end]);
+
+    switch (flag)
+    {
+        case coverage::hash_single:
+        {
+            data_array<add1(sizeof(uint64_t))> count{};
+            write::bytes::copy sink(count);
+            sink.write_variable(add1(index));
+            context.write(variable_size(add1(index)), count.data());
+
+            const auto& nulls = null_outputs();
+            const auto runs = index / (nulls.size() / null_output().size());
+            const auto rest = index % (nulls.size() / null_output().size());
+            for (size_t run = 0; run < runs; ++run)
+                context.write(nulls);
+
+            context.write(rest * null_output().size(), nulls.data());
+            context.write(outputs_->at(index)->to_data());
+            break;
+        }
+        case coverage::hash_none:
+            context.write(to_array(0x00));
+            break;
+        default:
+        case coverage::hash_all:
+            context.write(cache.outputs);
+    }
+
+    context.write(to_little_endian(locktime_));
+    context.write(to_little_endian<uint32_t>(flags));
+    return context.double_flush();
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 // Signing (version 0).
 // ----------------------------------------------------------------------------
 
 // private
-// TODO: taproot requires both single and double hash of each.
 void transaction::initialize_hash_cache() const NOEXCEPT
 {
     // This overconstructs the cache (anyone or !all), however it is simple and
@@ -733,15 +993,32 @@ void transaction::initialize_hash_cache() const NOEXCEPT
     {
         BC_PUSH_WARNING(NO_NEW_OR_DELETE)
         BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-        cache_.reset(new hash_cache
+        if (is_taproot_spend())
         {
-            outputs_hash(),
-            points_hash(),
-            sequences_hash()
-        });
+            // The bip143 hashes are the second hash of the bip341 hashes.
+            taproot_cache_.reset(new taproot_cache{ taproot_hashes() });
+            cache_.reset(new hash_cache
+            {
+                sha256_hash(taproot_cache_->outputs),
+                sha256_hash(taproot_cache_->points),
+                sha256_hash(taproot_cache_->sequences)
+            });
+        }
+        else
+        {
+            taproot_cache_.reset();
+            cache_.reset(new hash_cache
+            {
+                outputs_hash(),
+                points_hash(),
+                sequences_hash()
+            });
+        }
         BC_POP_WARNING()
         BC_POP_WARNING()
     }
+
+    initialize_sighash_cache();
 }
 
 // private
@@ -827,6 +1104,186 @@ hash_digest transaction::version_0_signature_hash(const input_iterator& input,
     return digest;
 }
 
+// Signing (taproot).
+// ----------------------------------------------------------------------------
+
+// private
+// Taproot hashes commit to all prevouts, so these must all be populated.
+bool transaction::is_taproot_spend() const NOEXCEPT
+{
+    const auto populated = [](const auto& input) NOEXCEPT
+    {
+        return !is_null(input->prevout);
+    };
+
+    const auto taproot = [](const auto& input) NOEXCEPT
+    {
+        return input->prevout->script().version() == script_version::taproot;
+    };
+
+    return std::all_of(inputs_->begin(), inputs_->end(), populated) &&
+        std::any_of(inputs_->begin(), inputs_->end(), taproot);
+}
+
+// private
+// An input without witness that spends an unversioned (populated) prevout.
+bool transaction::is_unversioned_spend() const NOEXCEPT
+{
+    const auto unversioned = [](const auto& input) NOEXCEPT
+    {
+        return !is_null(input->prevout) && input->witness().stack().empty() &&
+            input->prevout->script().version() == script_version::unversioned;
+    };
+
+    return std::any_of(inputs_->begin(), inputs_->end(), unversioned);
+}
+
+// private
+// Each of the five hashes is a single sha256 of the concatenation (bip341).
+transaction::taproot_cache transaction::taproot_hashes() const NOEXCEPT
+{
+    taproot_cache cache{};
+    hash::sha256::copy points(cache.points);
+    hash::sha256::copy amounts(cache.amounts);
+    hash::sha256::copy scripts(cache.scripts);
+    hash::sha256::copy sequences(cache.sequences);
+    hash::sha256::copy outputs(cache.outputs);
+
+    for (const auto& input: *inputs_)
+    {
+        input->point().to_data(points);
+        amounts.write_8_bytes_little_endian(input->prevout->value());
+        input->prevout->script().to_data(scripts, prefixed);
+        sequences.write_4_bytes_little_endian(input->sequence());
+    }
+
+    for (const auto& output: *outputs_)
+        output->to_data(outputs);
+
+    points.flush();
+    amounts.flush();
+    scripts.flush();
+    sequences.flush();
+    outputs.flush();
+    return cache;
+}
+
+// Undefined taproot sighash flags invalidate the signature (bip341).
+constexpr bool is_taproot_sighash(uint8_t flags) NOEXCEPT
+{
+    switch (flags)
+    {
+        case coverage::hash_default:
+        case coverage::hash_all:
+        case coverage::hash_none:
+        case coverage::hash_single:
+        case coverage::all_anyone_can_pay:
+        case coverage::none_anyone_can_pay:
+        case coverage::single_anyone_can_pay:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool transaction::signature_hash(hash_digest& out, const input_iterator& input,
+    uint8_t flags, const data_slice& annex, const hash_digest* tapleaf,
+    uint32_t codeseparator) const NOEXCEPT
+{
+    // There is no rational interpretation of a signature hash for a coinbase.
+    BC_ASSERT(!is_coinbase());
+
+    static const auto tag = sha256_hash(std::string{ "TapSighash" });
+    constexpr uint8_t epoch = 0x00;
+    constexpr uint8_t key_version = 0x00;
+
+    const auto anyone = to_bool(flags & coverage::anyone_can_pay);
+    const auto flag = mask_sighash(flags);
+    const auto single = (flag == coverage::hash_single);
+    const auto all = (flag == coverage::hash_all);
+    const auto index = input_index(input);
+    const auto& self = **input;
+
+    // A hash_single signature without a corresponding output is invalid.
+    if (!is_taproot_sighash(flags) || (single && index >= outputs_->size()))
+        return false;
+
+    // The tx-level hashes commit to all prevouts, so must be cached or all
+    // populated (for a taproot spend the prevout of self is populated).
+    if (!taproot_cache_ && !is_taproot_spend())
+        return false;
+
+    const auto cache = taproot_cache_ ? *taproot_cache_ : taproot_hashes();
+    hash::sha256::copy sink(out);
+
+    // Tagged hash prefix (bip340) and signature message (bip341).
+    sink.write_bytes(tag);
+    sink.write_bytes(tag);
+    sink.write_byte(epoch);
+    sink.write_byte(flags);
+    sink.write_4_bytes_little_endian(version_);
+    sink.write_4_bytes_little_endian(locktime_);
+
+    if (!anyone)
+    {
+        sink.write_bytes(cache.points);
+        sink.write_bytes(cache.amounts);
+        sink.write_bytes(cache.scripts);
+        sink.write_bytes(cache.sequences);
+    }
+
+    if (all)
+        sink.write_bytes(cache.outputs);
+
+    // Spend type is the extension flag (tapscript) doubled, plus annex bit.
+    const uint8_t extension = is_null(tapleaf) ? 0x00 : 0x02;
+    const uint8_t annexed = annex.empty() ? 0x00 : 0x01;
+    sink.write_byte(bit_or(extension, annexed));
+
+    if (anyone)
+    {
+        self.point().to_data(sink);
+        sink.write_8_bytes_little_endian(self.prevout->value());
+        self.prevout->script().to_data(sink, prefixed);
+        sink.write_4_bytes_little_endian(self.sequence());
+    }
+    else
+    {
+        sink.write_4_bytes_little_endian(index);
+    }
+
+    // The annex is committed as the sha256 of its prefixed serialization.
+    if (!annex.empty())
+    {
+        hash_digest digest{};
+        hash::sha256::copy annexer(digest);
+        annexer.write_variable(annex.size());
+        annexer.write_bytes(annex);
+        annexer.flush();
+        sink.write_bytes(digest);
+    }
+
+    if (single)
+    {
+        hash_digest digest{};
+        hash::sha256::copy outputer(digest);
+        outputs_->at(index)->to_data(outputer);
+        outputer.flush();
+        sink.write_bytes(digest);
+    }
+
+    // Tapscript extension (bip342).
+    if (!is_null(tapleaf))
+    {
+        sink.write_bytes(*tapleaf);
+        sink.write_byte(key_version);
+        sink.write_4_bytes_little_endian(codeseparator);
+    }
+
+    sink.flush();
+    return true;
+}
+
 // Signing (unversioned and version 0).
 // ----------------------------------------------------------------------------
 
@@ -848,6 +1305,9 @@ hash_digest transaction::signature_hash(const input_iterator& input,
             return unversioned_signature_hash(input, sub, flags);
         case script_version::zero:
             return version_0_signature_hash(input, sub, value, flags, bip143);
+
+        // Taproot signature hashing is not subscript based (bip341).
+        case script_version::taproot:
         case script_version::reserved:
         default:
             return {};
@@ -1257,37 +1717,100 @@ code transaction::accept(const context& state) const NOEXCEPT
 // Connect (contextual).
 // ------------------------------------------------------------------------
 
+// private
+code transaction::connect_input(const context& state,
+    const input_iterator& input, ec_signature_checks* checks) const NOEXCEPT
+{
+    using namespace machine;
+    const auto& in = **input;
+
+    // Any op_roll in either script, precomputed on script construction.
+    const auto roller = in.script().is_roller()
+        || (in.prevout && in.prevout->script().is_roller());
+
+    // Evaluate rolling scripts with linear search but constant erase.
+    // Evaluate non-rolling scripts with constant search but linear erase.
+    if (is_null(checks))
+        return roller ?
+            interpreter<linked_stack>::connect(state, *this, input) :
+            interpreter<contiguous_stack>::connect(state, *this, input);
+
+    return roller ?
+        interpreter<linked_stack>::connect(state, *this, input, *checks) :
+        interpreter<contiguous_stack>::connect(state, *this, input, *checks);
+}
+
 code transaction::connect(const context& state) const NOEXCEPT
 {
-    code ec;
+    code ec{ error::transaction_success };
 
     // Cache witness hash components that don't change per input.
     initialize_hash_cache();
-    
-    const auto is_roller = [](const auto& input) NOEXCEPT
-    {
-        static const auto roll = operation{ opcode::roll };
-
-        // Naive implementation, any op_roll in either script, late-counted.
-        // TODO: precompute on script parse, tune using performance profiling.
-        return contains(input.script().ops(), roll)
-            || (input.prevout && contains(input.prevout->script().ops(), roll));
-    };
 
     // Validate scripts, skip coinbase.
     for (auto input = inputs_->begin(); input != inputs_->end(); ++input)
+        if ((ec = connect_input(state, input, nullptr)))
+            break;
+
+    // The unversioned cache is large and only useful to connect.
+    sighash_cache_.reset();
+    return ec ? ec : error::transaction_success;
+}
+
+code transaction::connect(const context& state,
+    boost::asio::thread_pool& pool) const NOEXCEPT
+{
+    // Cache witness hash components that don't change per input.
+    initialize_hash_cache();
+
+    // Inputs are independent, sharing only the (populated) hash cache.
+    // Inputs are claimed in order and an input above the lowest known failure
+    // is skipped, so the lowest failure is always evaluated and the result
+    // matches sequential connect.
+    const auto count = inputs_->size();
+    std::atomic<size_t> lowest{ count };
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<code> codes(count);
+    BC_POP_WARNING()
+
+    parallel_for(pool, count, [&](size_t index) NOEXCEPT
     {
-        using namespace machine;
+        if (index > lowest.load(std::memory_order_relaxed))
+            return;
 
-        // Evaluate rolling scripts with linear search but constant erase.
-        // Evaluate non-rolling scripts with constant search but linear erase.
-        if ((ec = is_roller(**input) ?
-            interpreter<linked_stack>::connect(state, *this, input) :
-            interpreter<contiguous_stack>::connect(state, *this, input)))
-            return ec;
-    }
+        if ((codes[index] = connect_input(state,
+            std::next(inputs_->begin(), index), nullptr)))
+        {
+            auto current = lowest.load(std::memory_order_relaxed);
+            while (index < current &&
+                !lowest.compare_exchange_weak(current, index));
+        }
+    });
 
-    return error::transaction_success;
+    // The unversioned cache is large and only useful to connect.
+    sighash_cache_.reset();
+
+    const auto index = lowest.load();
+    return index < count ? codes[index] : error::transaction_success;
+}
+
+code transaction::connect(const context& state,
+    ec_signature_checks& checks) const NOEXCEPT
+{
+    code ec{ error::transaction_success };
+
+    // Cache witness hash components that don't change per input.
+    initialize_hash_cache();
+
+    // Collected signatures must be verified before success is assured.
+    for (auto input = inputs_->begin(); input != inputs_->end(); ++input)
+        if ((ec = connect_input(state, input, &checks)))
+            break;
+
+    // The unversioned cache is large and only useful to connect.
+    sighash_cache_.reset();
+    return ec ? ec : error::transaction_success;
 }
 
 // JSON value convertors.
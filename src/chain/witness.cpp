@@ -138,6 +138,7 @@ static data_chunk read_element(reader& source) NOEXCEPT
 witness witness::from_data(reader& source, bool prefix) NOEXCEPT
 {
     chunk_cptrs stack;
+    const auto arena = source.get_arena();
 
     if (prefix)
     {
@@ -146,12 +147,12 @@ witness witness::from_data(reader& source, bool prefix) NOEXCEPT
         stack.reserve(source.read_size(max_block_weight));
 
         for (size_t element = 0; element < stack.capacity(); ++element)
-            stack.push_back(to_shared<data_chunk>(read_element(source)));
+            stack.push_back(to_allocated<data_chunk>(arena, read_element(source)));
     }
     else
     {
         while (!source.is_exhausted())
-            stack.push_back(to_shared<data_chunk>(read_element(source)));
+            stack.push_back(to_allocated<data_chunk>(arena, read_element(source)));
     }
 
     return { stack, source };
@@ -322,6 +323,10 @@ bool witness::extract_sigop_script(script& out_script,
             }
         }
 
+        // Tapscript signatures are not counted, limited by budget (bip342).
+        case script_version::taproot:
+            return true;
+
         // These versions are reserved for future extensions (bip141).
         case script_version::reserved:
             return true;
@@ -389,6 +394,10 @@ bool witness::extract_script(script::cptr& out_script,
             }
         }
 
+        // Taproot spends are extracted by key or script path (bip341).
+        case script_version::taproot:
+            return false;
+
         // These versions are reserved for future extensions (bip141).
         case script_version::reserved:
             return true;
@@ -22,10 +22,13 @@
 #include <bitcoin/system/crypto/golomb_coding.hpp>
 
 #include <algorithm>
+#include <bit>
 #include <iostream>
 #include <iterator>
+#include <utility>
 #include <vector>
 #include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/math/math.hpp>
 
 // Avoid in header, circular dependency with stream to crypto.
 #include <bitcoin/system/stream/stream.hpp>
@@ -55,11 +58,139 @@ static uint64_t decode(bitreader& source, uint8_t modulo_exponent) NOEXCEPT
     return ((quotient << modulo_exponent) + remainder);
 }
 
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+// Word-at-a-time decoding of a byte span (bits are read msb first), for
+// scanning of filters in memory. The bitreader form above reads bit by bit.
+class span_decoder
+{
+public:
+    span_decoder(const data_slice& data, uint8_t modulo_exponent) NOEXCEPT
+      : data_(data.data()),
+        size_(data.size()),
+        modulo_(modulo_exponent),
+        position_(0)
+    {
+    }
+
+    /// False if the set is exhausted (value is then undefined).
+    inline bool decode(uint64_t& value) NOEXCEPT
+    {
+        // The unary quotient is the count of leading one bits, ended by zero.
+        uint64_t quotient{};
+        for (auto ones = bits<uint64_t>; ones == bits<uint64_t>;)
+        {
+            ones = possible_sign_cast<size_t>(std::countl_one(peek()));
+            quotient += ones;
+            position_ += ones;
+        }
+
+        // Skip the terminating zero bit, padding is zero.
+        ++position_;
+
+        const auto remainder = is_zero(modulo_) ? 0_u64 :
+            peek() >> (bits<uint64_t> - modulo_);
+
+        position_ += modulo_;
+        value = (quotient << modulo_) + remainder;
+        return position_ <= to_bits(size_);
+    }
+
+private:
+    static constexpr auto window = add1(sizeof(uint64_t));
+
+    // The next 64 bits (msb first), padded with zeros beyond the data.
+    inline uint64_t peek() const NOEXCEPT
+    {
+        const auto byte = position_ / byte_bits;
+        const auto offset = position_ % byte_bits;
+        const auto buffer = (byte + window <= size_) ? data_ + byte :
+            pad(byte).data();
+
+        const auto word = native_from_big_end(
+            unsafe_byte_cast<uint64_t>(buffer));
+
+        return is_zero(offset) ? word : (word << offset) |
+            (buffer[sizeof(uint64_t)] >> (byte_bits - offset));
+    }
+
+    // Copy of the window at the end of the data, as it is not addressable.
+    inline const data_array<window>& pad(size_t byte) const NOEXCEPT
+    {
+        tail_.fill(0);
+        if (byte < size_)
+            std::copy_n(data_ + byte, lesser(window, size_ - byte),
+                tail_.begin());
+
+        return tail_;
+    }
+
+    const uint8_t* data_;
+    const size_t size_;
+    const uint8_t modulo_;
+    size_t position_;
+    mutable data_array<window> tail_{};
+};
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+// High 64 bits of the 128 bit product (hot path). This is a single multiply
+// where a 128 bit integer or intrinsic is available, otherwise 32 bit split.
+inline uint64_t hash_to_range(uint64_t hash, uint64_t bound) NOEXCEPT
+{
+    return multiply_high(hash, bound);
+}
+
 inline uint64_t hash_to_range(const data_slice& item, uint64_t bound,
     const siphash_key& key) NOEXCEPT
 {
-    const auto product = uint128_t(siphash(key, item)) * uint128_t(bound);
-    return (product >> bits<uint64_t>).convert_to<uint64_t>();
+    return hash_to_range(siphash(key, item), bound);
+}
+
+// LSD radix sort by byte, with histograms of all bytes taken in one pass.
+// A byte that is common to all values (e.g. high zeros) is not sorted.
+static void radix_sort(std::vector<uint64_t>& values) NOEXCEPT
+{
+    constexpr auto passes = sizeof(uint64_t);
+    constexpr auto buckets = add1<size_t>(max_uint8);
+    using histogram = std_array<size_t, buckets>;
+
+    // Radix sort is not beneficial for small sets.
+    if (values.size() < buckets)
+    {
+        std::sort(values.begin(), values.end());
+        return;
+    }
+
+    std_array<histogram, passes> counts{};
+    for (const auto value: values)
+        for (size_t pass = 0; pass < passes; ++pass)
+            ++counts[pass][narrow_cast<uint8_t>(value >> to_bits(pass))];
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::vector<uint64_t> buffer(values.size());
+    BC_POP_WARNING()
+
+    for (size_t pass = 0; pass < passes; ++pass)
+    {
+        const auto shift = to_bits(pass);
+        auto& offsets = counts[pass];
+        const auto first = narrow_cast<uint8_t>(values.front() >> shift);
+        if (offsets[first] == values.size())
+            continue;
+
+        // Convert counts to offsets (exclusive prefix sum).
+        size_t total{};
+        for (auto& offset: offsets)
+            total += std::exchange(offset, total);
+
+        for (const auto value: values)
+            buffer[offsets[narrow_cast<uint8_t>(value >> shift)]++] = value;
+
+        values.swap(buffer);
+    }
 }
 
 static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
@@ -69,17 +200,17 @@ static std::vector<uint64_t> hashed_set_construct(const data_stack& items,
     if (is_multiply_overflow(target_false_positive_rate, set_size))
         return {};
 
+    // Batch siphash is vectorized (and concurrent for large sets).
     const auto bound = target_false_positive_rate * set_size;
-    std::vector<uint64_t> hashes(items.size());
-
-    // C++17: parallel policy for std::transform.
-    std::transform(items.begin(), items.end(), hashes.begin(),
-        [&](const data_chunk& item) NOEXCEPT
+    auto hashes = siphashes(key, { items.begin(), items.end() });
+    std::transform(hashes.begin(), hashes.end(), hashes.begin(),
+        [=](uint64_t hash) NOEXCEPT
         {
-            return hash_to_range(item, bound, key);
+            return hash_to_range(hash, bound);
         });
 
-    return sort(std::move(hashes));
+    radix_sort(hashes);
+    return hashes;
 }
 
 // Golomb-coded set construction
@@ -131,9 +262,65 @@ void construct(std::ostream& stream, const data_stack& items, uint8_t bits,
     sink.flush();
 }
 
+// Golomb-coded set construction from item hashes
+// ----------------------------------------------------------------------------
+
+void distinct_hashes(std::vector<uint64_t>& hashes) NOEXCEPT
+{
+    radix_sort(hashes);
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+}
+
+void construct(std::ostream& stream, const std::vector<uint64_t>& hashes,
+    uint8_t bits, uint64_t target_false_positive_rate) NOEXCEPT
+{
+    const auto set_size = hashes.size();
+    if (is_multiply_overflow(target_false_positive_rate, set_size))
+        return;
+
+    // Range mapping is monotonic, so ordered hashes map to ordered ranges.
+    const auto bound = target_false_positive_rate * set_size;
+    write::bits::ostream sink(stream);
+
+    uint64_t previous = 0;
+    for (const auto hash: hashes)
+    {
+        const auto value = hash_to_range(hash, bound);
+        encode(sink, value - previous, bits);
+        previous = value;
+    }
+
+    sink.flush();
+}
+
 // Single element match
 // ----------------------------------------------------------------------------
 
+static bool match(const data_chunk& target, span_decoder& compressed_set,
+    uint64_t set_size, const siphash_key& entropy,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    const auto bound = target_false_positive_rate * set_size;
+    const auto range = hash_to_range(target, bound, entropy);
+
+    uint64_t value = 0;
+    uint64_t delta = 0;
+    for (uint64_t index = 0; index < set_size; index++)
+    {
+        if (!compressed_set.decode(delta))
+            return false;
+
+        value += delta;
+        if (value == range)
+            return true;
+
+        if (value > range)
+            break;
+    }
+
+    return false;
+}
+
 static bool match(const data_chunk& target, bitreader& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
@@ -158,7 +345,7 @@ static bool match(const data_chunk& target, bitreader& compressed_set,
     return false;
 }
 
-bool match(const data_chunk& target, const data_chunk& compressed_set,
+bool match(const data_chunk& target, const data_slice& compressed_set,
     uint64_t set_size, const half_hash& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
 {
@@ -166,12 +353,12 @@ bool match(const data_chunk& target, const data_chunk& compressed_set,
         bits, target_false_positive_rate);
 }
 
-bool match(const data_chunk& target, const data_chunk& compressed_set,
+bool match(const data_chunk& target, const data_slice& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
 {
-    stream::in::copy source(compressed_set);
-    return match(target, source, set_size, entropy, bits,
+    span_decoder decoder(compressed_set, bits);
+    return match(target, decoder, set_size, entropy,
         target_false_positive_rate);
 }
 
@@ -195,6 +382,37 @@ bool match(const data_chunk& target, std::istream& compressed_set,
 // Intersection match
 // ----------------------------------------------------------------------------
 
+static bool match(const data_stack& targets, span_decoder& compressed_set,
+    uint64_t set_size, const siphash_key& entropy,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    if (targets.empty())
+        return false;
+
+    const auto set = hashed_set_construct(targets, set_size,
+        target_false_positive_rate, entropy);
+
+    // Merge the sorted target ranges with the (sorted) decoded set.
+    uint64_t range = 0;
+    uint64_t delta = 0;
+    auto it = set.begin();
+
+    for (uint64_t index = 0; index < set_size && it != set.end(); index++)
+    {
+        if (!compressed_set.decode(delta))
+            return false;
+
+        range += delta;
+        while (it != set.end() && *it < range)
+            ++it;
+
+        if (it != set.end() && *it == range)
+            return true;
+    }
+
+    return false;
+}
+
 static bool match(const data_stack& targets, bitreader& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
@@ -225,7 +443,7 @@ static bool match(const data_stack& targets, bitreader& compressed_set,
     return false;
 }
 
-bool match(const data_stack& targets, const data_chunk& compressed_set,
+bool match(const data_stack& targets, const data_slice& compressed_set,
     uint64_t set_size, const half_hash& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
 {
@@ -233,12 +451,12 @@ bool match(const data_stack& targets, const data_chunk& compressed_set,
         bits, target_false_positive_rate);
 }
 
-bool match(const data_stack& targets, const data_chunk& compressed_set,
+bool match(const data_stack& targets, const data_slice& compressed_set,
     uint64_t set_size, const siphash_key& entropy, uint8_t bits,
     uint64_t target_false_positive_rate) NOEXCEPT
 {
-    stream::in::copy source(compressed_set);
-    return match(targets, source, set_size, entropy, bits,
+    span_decoder decoder(compressed_set, bits);
+    return match(targets, decoder, set_size, entropy,
         target_false_positive_rate);
 }
 
@@ -259,6 +477,63 @@ bool match(const data_stack& targets, std::istream& compressed_set,
         target_false_positive_rate);
 }
 
+// Multiple element match
+// ----------------------------------------------------------------------------
+
+std::vector<bool> matches(const data_stack& targets,
+    const data_slice& compressed_set, uint64_t set_size,
+    const half_hash& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    return matches(targets, compressed_set, set_size, to_siphash_key(entropy),
+        bits, target_false_positive_rate);
+}
+
+std::vector<bool> matches(const data_stack& targets,
+    const data_slice& compressed_set, uint64_t set_size,
+    const siphash_key& entropy, uint8_t bits,
+    uint64_t target_false_positive_rate) NOEXCEPT
+{
+    std::vector<bool> out(targets.size(), false);
+    if (targets.empty() ||
+        is_multiply_overflow(target_false_positive_rate, set_size))
+        return out;
+
+    // Target ranges are not deduplicated here, so are ordered by index.
+    const auto bound = target_false_positive_rate * set_size;
+    auto ranges = siphashes(entropy, { targets.begin(), targets.end() });
+    std::vector<size_t> order(targets.size());
+    for (size_t index = 0; index < ranges.size(); ++index)
+    {
+        ranges[index] = hash_to_range(ranges[index], bound);
+        order[index] = index;
+    }
+
+    std::sort(order.begin(), order.end(),
+        [&](size_t left, size_t right) NOEXCEPT
+        {
+            return ranges[left] < ranges[right];
+        });
+
+    // Merge the ordered target ranges with the (sorted) decoded set.
+    span_decoder decoder(compressed_set, bits);
+    uint64_t range = 0;
+    uint64_t delta = 0;
+    auto it = order.begin();
+
+    for (uint64_t index = 0; index < set_size && it != order.end(); index++)
+    {
+        if (!decoder.decode(delta))
+            break;
+
+        range += delta;
+        for (; it != order.end() && ranges[*it] <= range; ++it)
+            out[*it] = (ranges[*it] == range);
+    }
+
+    return out;
+}
+
 } // namespace golomb
 } // namespace system
 } // namespace libbitcoin
@@ -19,14 +19,18 @@
 #include <bitcoin/system/crypto/secp256k1.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 #include <secp256k1.h>
+#include <secp256k1_extrakeys.h>
 #include <secp256k1_recovery.h>
+#include <secp256k1_schnorrsig.h>
 #include <bitcoin/system/crypto/der_parser.hpp>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/hash/hash.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include "ec_context.hpp"
+#include "../parallel.hpp"
 
 namespace libbitcoin {
 namespace system {
@@ -185,6 +189,30 @@ bool ec_add(ec_uncompressed& point, const ec_secret& scalar) NOEXCEPT
     return ec_add(context, point, scalar);
 }
 
+// parse once, add and serialize each
+bool ec_add(compressed_list& out, const ec_compressed& point,
+    const secret_list& scalars) NOEXCEPT
+{
+    auto const* context = ec_context_verify::context();
+
+    secp256k1_pubkey parsed;
+    if (!parse(context, parsed, point))
+        return false;
+
+    out.resize(scalars.size());
+    std::transform(scalars.begin(), scalars.end(), out.begin(),
+        [&](const ec_secret& scalar) NOEXCEPT
+        {
+            auto pubkey = parsed;
+            ec_compressed sum;
+            return secp256k1_ec_pubkey_tweak_add(context, &pubkey,
+                scalar.data()) == ec_success && serialize(context, sum,
+                    pubkey) ? sum : null_ec_compressed;
+        });
+
+    return true;
+}
+
 // secrets are normal
 bool ec_add(ec_secret& left, const ec_secret& right) NOEXCEPT
 {
@@ -427,6 +455,115 @@ bool verify_signature(const data_slice& point, const hash_digest& hash,
         verify_signature(context, pubkey, hash, signature);
 }
 
+// Schnorr sign/verify (bip340)
+// ----------------------------------------------------------------------------
+
+namespace schnorr {
+
+// parse, verify
+static bool verify_signature(const secp256k1_context* context,
+    const data_slice& x_point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    secp256k1_xonly_pubkey pubkey;
+    return x_point.size() == ec_xonly_size &&
+        secp256k1_xonly_pubkey_parse(context, &pubkey, x_point.data()) ==
+            ec_success &&
+        secp256k1_schnorrsig_verify(context, signature.data(), hash.data(),
+            hash.size(), &pubkey) == ec_success;
+}
+
+// create keypair, sign (secrets are normal)
+bool sign(ec_signature& out, const ec_secret& secret,
+    const hash_digest& hash, const hash_digest& auxiliary) NOEXCEPT
+{
+    secp256k1_keypair keypair;
+    const auto context = ec_context_sign::context();
+
+    return secp256k1_keypair_create(context, &keypair, secret.data()) ==
+        ec_success && secp256k1_schnorrsig_sign32(context, out.data(),
+            hash.data(), &keypair, auxiliary.data()) == ec_success;
+}
+
+bool verify_signature(const data_slice& x_point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    const auto context = ec_context_verify::context();
+    return verify_signature(context, x_point, hash, signature);
+}
+
+// parse, tweak, serialize
+bool tweak(ec_xonly& out, bool& odd, const ec_xonly& point,
+    const hash_digest& tweak) NOEXCEPT
+{
+    int parity{};
+    secp256k1_pubkey tweaked;
+    secp256k1_xonly_pubkey pubkey;
+    const auto context = ec_context_verify::context();
+
+    if (secp256k1_xonly_pubkey_parse(context, &pubkey, point.data()) !=
+        ec_success ||
+        secp256k1_xonly_pubkey_tweak_add(context, &tweaked, &pubkey,
+            tweak.data()) != ec_success ||
+        secp256k1_xonly_pubkey_from_pubkey(context, &pubkey, &parity,
+            &tweaked) != ec_success ||
+        secp256k1_xonly_pubkey_serialize(context, out.data(), &pubkey) !=
+            ec_success)
+        return false;
+
+    odd = to_bool(parity);
+    return true;
+}
+
+// parse, tweak check
+bool verify_tweak(const data_slice& x_point, bool odd,
+    const data_slice& point, const hash_digest& tweak) NOEXCEPT
+{
+    secp256k1_xonly_pubkey pubkey;
+    const auto context = ec_context_verify::context();
+
+    return x_point.size() == ec_xonly_size && point.size() == ec_xonly_size &&
+        secp256k1_xonly_pubkey_parse(context, &pubkey, point.data()) ==
+            ec_success &&
+        secp256k1_xonly_pubkey_tweak_add_check(context, x_point.data(),
+            to_int(odd), &pubkey, tweak.data()) == ec_success;
+}
+
+} // namespace schnorr
+
+// Deferred sign/verify
+// ----------------------------------------------------------------------------
+
+// secp256k1 provides no batch verification, so the batch is verified as
+// independent checks, distributed across tasks of the pool.
+// parse<>, verify<> (batch)
+bool verify_signatures(const ec_signature_checks& checks,
+    boost::asio::thread_pool& pool) NOEXCEPT
+{
+    // The verify context is read-only once created, so may be shared.
+    const auto context = ec_context_verify::context();
+    const auto verify = [context](const ec_signature_check& check) NOEXCEPT
+    {
+        if (check.schnorr)
+            return schnorr::verify_signature(context, check.point,
+                check.hash, check.signature);
+
+        secp256k1_pubkey pubkey;
+        return parse(context, pubkey, check.point) &&
+            verify_signature(context, pubkey, check.hash, check.signature);
+    };
+
+    // Remaining checks are skipped once any check has failed.
+    std::atomic_bool valid{ true };
+    parallel_for(pool, checks.size(), [&](size_t index) NOEXCEPT
+    {
+        if (valid.load(std::memory_order_relaxed) && !verify(checks[index]))
+            valid.store(false, std::memory_order_relaxed);
+    });
+
+    return valid.load();
+}
+
 // Recoverable sign/recover
 // ----------------------------------------------------------------------------
 
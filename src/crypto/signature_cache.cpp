@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/crypto/signature_cache.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <bitcoin/system/crypto/pseudo_random.hpp>
+#include <bitcoin/system/crypto/secp256k1.hpp>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/hash/hash.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+// The salt is not persisted, so entries cannot be targeted across instances.
+static siphash_key random_siphash_key() NOEXCEPT
+{
+    return
+    {
+        pseudo_random::next<uint64_t>(),
+        pseudo_random::next<uint64_t>()
+    };
+}
+
+signature_cache& signature_cache::instance() NOEXCEPT
+{
+    static signature_cache cache(default_capacity);
+    return cache;
+}
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+signature_cache::signature_cache(size_t capacity) NOEXCEPT
+  : key0_(random_siphash_key()),
+    key1_(random_siphash_key()),
+    entries_(capacity, entry{})
+{
+}
+BC_POP_WARNING()
+
+signature_cache::entry signature_cache::to_entry(const data_slice& point,
+    const hash_digest& hash, const ec_signature& signature) const NOEXCEPT
+{
+    // Message is hash, signature and point (avoids allocation).
+    constexpr auto prefix = hash_size + ec_signature_size;
+    std_array<uint8_t, prefix + ec_uncompressed_size> message{};
+    const auto size = std::min(point.size(), ec_uncompressed_size);
+
+    std::copy(hash.begin(), hash.end(), message.begin());
+    std::copy(signature.begin(), signature.end(),
+        std::next(message.begin(), hash_size));
+    std::copy_n(point.begin(), size, std::next(message.begin(), prefix));
+
+    // Oversized points are not valid, and the slice is shortened to size.
+    const data_slice slice(message.data(), std::next(message.data(),
+        prefix + size));
+
+    return { siphash(key0_, slice), siphash(key1_, slice) };
+}
+
+bool signature_cache::contains(const data_slice& point,
+    const hash_digest& hash, const ec_signature& signature) const NOEXCEPT
+{
+    if (entries_.empty() || point.size() > ec_uncompressed_size)
+        return false;
+
+    const auto value = to_entry(point, hash, signature);
+    const auto index = value.front() % entries_.size();
+
+    const auto shard = index % shards;
+
+    bool found;
+    {
+        BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+        BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+        std::shared_lock lock(mutexes_[shard]);
+        found = (entries_[index] == value);
+        BC_POP_WARNING()
+        BC_POP_WARNING()
+    }
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    auto& counter = counters_[shard];
+    BC_POP_WARNING()
+
+    if (found)
+        counter.hits.fetch_add(one, std::memory_order_relaxed);
+    else
+        counter.misses.fetch_add(one, std::memory_order_relaxed);
+
+    return found;
+}
+
+void signature_cache::insert(const data_slice& point, const hash_digest& hash,
+    const ec_signature& signature) NOEXCEPT
+{
+    if (entries_.empty() || point.size() > ec_uncompressed_size)
+        return;
+
+    const auto value = to_entry(point, hash, signature);
+    const auto index = value.front() % entries_.size();
+
+    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    std::unique_lock lock(mutexes_[index % shards]);
+    entries_[index] = value;
+    BC_POP_WARNING()
+    BC_POP_WARNING()
+}
+
+void signature_cache::clear() NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    for (auto& mutex: mutexes_)
+        mutex.lock();
+
+    std::fill(entries_.begin(), entries_.end(), entry{});
+
+    for (auto& mutex: mutexes_)
+        mutex.unlock();
+    BC_POP_WARNING()
+
+    reset_counters();
+}
+
+void signature_cache::resize(size_t capacity) NOEXCEPT
+{
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    entries_.assign(capacity, entry{});
+    entries_.shrink_to_fit();
+    BC_POP_WARNING()
+
+    reset_counters();
+}
+
+size_t signature_cache::capacity() const NOEXCEPT
+{
+    return entries_.size();
+}
+
+size_t signature_cache::hits() const NOEXCEPT
+{
+    return std::accumulate(counters_.begin(), counters_.end(), zero,
+        [](size_t total, const counters& counter) NOEXCEPT
+        {
+            return total + counter.hits.load(std::memory_order_relaxed);
+        });
+}
+
+size_t signature_cache::misses() const NOEXCEPT
+{
+    return std::accumulate(counters_.begin(), counters_.end(), zero,
+        [](size_t total, const counters& counter) NOEXCEPT
+        {
+            return total + counter.misses.load(std::memory_order_relaxed);
+        });
+}
+
+// private
+void signature_cache::reset_counters() NOEXCEPT
+{
+    for (auto& counter: counters_)
+    {
+        counter.hits.store(zero, std::memory_order_relaxed);
+        counter.misses.store(zero, std::memory_order_relaxed);
+    }
+}
+
+} // namespace system
+} // namespace libbitcoin
@@ -117,7 +117,16 @@ DEFINE_ERROR_T_MESSAGE_MAP(op_error)
     { op_check_sequence_verify2, "op_check_sequence_verify2" },
     { op_check_sequence_verify3, "op_check_sequence_verify3" },
     { op_check_sequence_verify4, "op_check_sequence_verify4" },
-    { op_check_sequence_verify5, "op_check_sequence_verify5" }
+    { op_check_sequence_verify5, "op_check_sequence_verify5" },
+    { op_check_schnorr_sig1, "op_check_schnorr_sig1" },
+    { op_check_schnorr_sig2, "op_check_schnorr_sig2" },
+    { op_check_schnorr_sig3, "op_check_schnorr_sig3" },
+    { op_check_schnorr_sig4, "op_check_schnorr_sig4" },
+    { op_check_schnorr_sig5, "op_check_schnorr_sig5" },
+    { op_check_schnorr_sig_verify, "op_check_schnorr_sig_verify" },
+    { op_check_sig_add1, "op_check_sig_add1" },
+    { op_check_sig_add2, "op_check_sig_add2" },
+    { op_check_multisig_tapscript, "op_check_multisig_tapscript" }
 };
 
 DEFINE_ERROR_T_CATEGORY(op_error, "op", "op code")
@@ -42,7 +42,10 @@ DEFINE_ERROR_T_MESSAGE_MAP(script_error)
     { invalid_witness, "invalid witness" },
     { invalid_witness_stack, "invalid witness stack" },
     { dirty_witness, "dirty witness" },
-    { stack_false, "stack false" }
+    { stack_false, "stack false" },
+    { invalid_control_block, "invalid control block" },
+    { invalid_taproot_commitment, "invalid taproot commitment" },
+    { invalid_schnorr_signature, "invalid schnorr signature" }
 };
 
 DEFINE_ERROR_T_CATEGORY(script_error, "script", "script code")
@@ -21,9 +21,14 @@
 
 #include <bitcoin/system/hash/siphash.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <tuple>
+#include <utility>
 #include <bitcoin/system/data/data.hpp>
 #include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
 #include <bitcoin/system/math/math.hpp>
 #include <bitcoin/system/endian/endian.hpp>
 
@@ -110,6 +115,205 @@ uint64_t siphash(const half_hash& hash,
     return siphash(to_siphash_key(hash), message);
 }
 
+// Multiple message hashing.
+// ----------------------------------------------------------------------------
+// Messages are ordered by full word count, so that each group of lanes shares
+// the same schedule. Only the final (length) word is specific to a message.
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+constexpr auto eight = sizeof(uint64_t);
+
+// Below this set size hashing is not concurrent.
+constexpr size_t concurrency_threshold = 16'384;
+
+// local
+static uint64_t get_word(const data_slice& message, size_t word) NOEXCEPT
+{
+    return native_from_little_end(unsafe_byte_cast<uint64_t>(
+        std::next(message.data(), word * eight)));
+}
+
+// local
+static uint64_t get_last(const data_slice& message) NOEXCEPT
+{
+    const auto bytes = message.size();
+    const auto tail = bytes % eight;
+    data_array<eight> last{};
+    std::copy_n(std::next(message.data(), bytes - tail), tail, last.begin());
+    return from_little_endian(last) ^
+        ((bytes % max_encoded_byte_count) << to_bits(sub1(eight)));
+}
+
+// local
+template <typename xWord>
+INLINE void sip_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3) NOEXCEPT
+{
+    constexpr auto s = bits<uint64_t>;
+
+    v0 = f::add<s>(v0, v1);
+    v2 = f::add<s>(v2, v3);
+    v1 = f::rol<13, s>(v1);
+    v3 = f::rol<16, s>(v3);
+    v1 = f::xor_(v1, v0);
+    v3 = f::xor_(v3, v2);
+
+    v0 = f::rol<32, s>(v0);
+
+    v2 = f::add<s>(v2, v1);
+    v0 = f::add<s>(v0, v3);
+    v1 = f::rol<17, s>(v1);
+    v3 = f::rol<21, s>(v3);
+    v1 = f::xor_(v1, v2);
+    v3 = f::xor_(v3, v0);
+
+    v2 = f::rol<32, s>(v2);
+}
+
+// local
+template <typename xWord>
+INLINE void compression_round(xWord& v0, xWord& v1, xWord& v2, xWord& v3,
+    xWord word) NOEXCEPT
+{
+    v3 = f::xor_(v3, word);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    v0 = f::xor_(v0, word);
+}
+
+// local
+// Hash the lanes of messages identified by order[offset...], which share a
+// full word count (words).
+template <typename xWord, size_t... Lane>
+INLINE void siphash_lanes(std_vector<uint64_t>& out,
+    const std_vector<data_slice>& messages, const std_vector<size_t>& order,
+    size_t offset, size_t words, const siphash_key& key,
+    std::index_sequence<Lane...>) NOEXCEPT
+{
+    const auto& message = [&](size_t lane) NOEXCEPT -> const data_slice&
+    {
+        return messages[order[offset + lane]];
+    };
+
+    auto v0 = broadcast<xWord>(siphash_magic_0 ^ std::get<0>(key));
+    auto v1 = broadcast<xWord>(siphash_magic_1 ^ std::get<1>(key));
+    auto v2 = broadcast<xWord>(siphash_magic_2 ^ std::get<0>(key));
+    auto v3 = broadcast<xWord>(siphash_magic_3 ^ std::get<1>(key));
+
+    for (size_t word = 0; word < words; ++word)
+        compression_round(v0, v1, v2, v3,
+            set<xWord>(get_word(message(Lane), word)...));
+
+    compression_round(v0, v1, v2, v3, set<xWord>(get_last(message(Lane))...));
+
+    v2 = f::xor_(v2, broadcast<xWord>(finalization));
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+    sip_round(v0, v1, v2, v3);
+
+    const auto hash = f::xor_(f::xor_(v0, v1), f::xor_(v2, v3));
+    ((out[order[offset + Lane]] = get<uint64_t, Lane>(hash)), ...);
+}
+
+// local
+template <typename xWord>
+INLINE void siphash_lanes(std_vector<uint64_t>& out,
+    const std_vector<data_slice>& messages, const std_vector<size_t>& order,
+    size_t offset, size_t words, const siphash_key& key) NOEXCEPT
+{
+    constexpr auto lanes = capacity<xWord, uint64_t>;
+    siphash_lanes<xWord>(out, messages, order, offset, words, key,
+        std::make_index_sequence<lanes>{});
+}
+
+// local
+// Widest available lanes that can be filled.
+static size_t siphash_width(size_t count) NOEXCEPT
+{
+    if constexpr (with_avx512)
+        if (count >= capacity<xint512_t, uint64_t> && have<xint512_t>())
+            return capacity<xint512_t, uint64_t>;
+
+    if constexpr (with_avx2)
+        if (count >= capacity<xint256_t, uint64_t> && have<xint256_t>())
+            return capacity<xint256_t, uint64_t>;
+
+    if constexpr (with_sse41)
+        if (count >= capacity<xint128_t, uint64_t> && have<xint128_t>())
+            return capacity<xint128_t, uint64_t>;
+
+    return one;
+}
+
+std_vector<uint64_t> siphashes(const siphash_key& key,
+    const std_vector<data_slice>& messages) NOEXCEPT
+{
+    const auto count = messages.size();
+    std_vector<uint64_t> out(count);
+    std_vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), zero);
+
+    // Order messages by full word count (scripts are mostly of a few sizes).
+    std::stable_sort(order.begin(), order.end(),
+        [&](size_t left, size_t right) NOEXCEPT
+        {
+            return messages[left].size() / eight <
+                messages[right].size() / eight;
+        });
+
+    // Jobs are (offset, width) of runs of same full word count messages.
+    std_vector<std::pair<size_t, size_t>> jobs{};
+    for (size_t offset = 0; offset < count;)
+    {
+        const auto words = messages[order[offset]].size() / eight;
+        auto end = offset;
+        while (end < count && messages[order[end]].size() / eight == words)
+            ++end;
+
+        while (offset < end)
+        {
+            const auto width = siphash_width(end - offset);
+            jobs.emplace_back(offset, width);
+            offset += width;
+        }
+    }
+
+    const auto hasher = [&](const std::pair<size_t, size_t>& job) NOEXCEPT
+    {
+        const auto [offset, width] = job;
+        const auto words = messages[order[offset]].size() / eight;
+
+        if constexpr (with_avx512)
+            if (width == capacity<xint512_t, uint64_t>)
+                return siphash_lanes<xint512_t>(out, messages, order,
+                    offset, words, key);
+
+        if constexpr (with_avx2)
+            if (width == capacity<xint256_t, uint64_t>)
+                return siphash_lanes<xint256_t>(out, messages, order,
+                    offset, words, key);
+
+        if constexpr (with_sse41)
+            if (width == capacity<xint128_t, uint64_t>)
+                return siphash_lanes<xint128_t>(out, messages, order,
+                    offset, words, key);
+
+        out[order[offset]] = siphash(key, messages[order[offset]]);
+    };
+
+    if (count < concurrency_threshold)
+        std_for_each(bc::seq, jobs.begin(), jobs.end(), hasher);
+    else
+        std_for_each(bc::par_unseq, jobs.begin(), jobs.end(), hasher);
+
+    return out;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
 // TODO: constexpr
 siphash_key to_siphash_key(const half_hash& hash) NOEXCEPT
 {
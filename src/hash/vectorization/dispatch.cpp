@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/hash/sha/dispatch.hpp>
+
+#include <algorithm>
+#include <bitcoin/system/data/data.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/intrinsics/intrinsics.hpp>
+#include "kernels.hpp"
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+namespace dispatch {
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
+
+constexpr size_t block_size = 64;
+constexpr size_t digest_size = 32;
+constexpr size_t header_size = 80;
+constexpr size_t avx2_lanes = 8;
+constexpr size_t shani_lanes = 2;
+
+constexpr uint32_t initial[8]
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// Probed once, on first use (static initialization is thread safe).
+static bool shani() NOEXCEPT
+{
+    static const auto enable = cpu_shani();
+    return enable;
+}
+
+static bool avx2() NOEXCEPT
+{
+    static const auto enable = cpu_avx2();
+    return enable;
+}
+
+bool have_compress() NOEXCEPT
+{
+    return shani();
+}
+
+bool have_merkle() NOEXCEPT
+{
+    return shani() || avx2();
+}
+
+bool compress(uint32_t* state, const uint8_t* blocks, size_t count) NOEXCEPT
+{
+    if (!shani())
+        return false;
+
+    compress_shani(state, blocks, count);
+    return true;
+}
+
+// Second hash of a first hash state using the compression kernel (shani only).
+static void finalize_one(uint8_t* digest, uint32_t* state) NOEXCEPT
+{
+    uint8_t buffer[block_size]{};
+
+    // Half block message (big-endian state) and pad (256 bits).
+    for (size_t word = 0; word < 8; ++word)
+    {
+        buffer[word * 4 + 0] = static_cast<uint8_t>(state[word] >> 24);
+        buffer[word * 4 + 1] = static_cast<uint8_t>(state[word] >> 16);
+        buffer[word * 4 + 2] = static_cast<uint8_t>(state[word] >> 8);
+        buffer[word * 4 + 3] = static_cast<uint8_t>(state[word]);
+    }
+
+    buffer[digest_size] = 0x80;
+    buffer[block_size - 2] = 0x01;
+    std::copy(std::begin(initial), std::end(initial), state);
+    compress_shani(state, &buffer[0], one);
+
+    for (size_t word = 0; word < 8; ++word)
+    {
+        digest[word * 4 + 0] = static_cast<uint8_t>(state[word] >> 24);
+        digest[word * 4 + 1] = static_cast<uint8_t>(state[word] >> 16);
+        digest[word * 4 + 2] = static_cast<uint8_t>(state[word] >> 8);
+        digest[word * 4 + 3] = static_cast<uint8_t>(state[word]);
+    }
+}
+
+// Double hash of one block using the compression kernel (shani only).
+static void merkle_one(uint8_t* digest, const uint8_t* block) NOEXCEPT
+{
+    // One block message pad (512 bits).
+    constexpr uint8_t pad64[block_size]
+    {
+        0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0x00, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02, 0x00
+    };
+
+    uint32_t state[8];
+    std::copy(std::begin(initial), std::end(initial), std::begin(state));
+    compress_shani(state, block, one);
+    compress_shani(state, &pad64[0], one);
+    finalize_one(digest, state);
+}
+
+// Double hash of one 80 byte header using the compression kernel (shani only).
+static void header_one(uint8_t* digest, const uint8_t* header) NOEXCEPT
+{
+    constexpr auto tail = header_size - block_size;
+
+    uint32_t state[8];
+    uint8_t buffer[block_size]{};
+    std::copy(std::begin(initial), std::end(initial), std::begin(state));
+    compress_shani(state, header, one);
+
+    // Partial block message and pad (640 bits).
+    std::copy_n(header + block_size, tail, &buffer[0]);
+    buffer[tail] = 0x80;
+    buffer[block_size - 2] = 0x02;
+    buffer[block_size - 1] = 0x80;
+    compress_shani(state, &buffer[0], one);
+    finalize_one(digest, state);
+}
+
+// Blocks are consumed in order and each kernel reads its blocks before
+// writing its digests, so the digest write never overtakes the block read.
+size_t merkle(uint8_t* digests, const uint8_t* blocks, size_t count) NOEXCEPT
+{
+    size_t index{};
+
+    if (avx2())
+        for (; count - index >= avx2_lanes; index += avx2_lanes)
+            merkle_avx2(digests + index * digest_size,
+                blocks + index * block_size);
+
+    if (shani())
+    {
+        for (; count - index >= shani_lanes; index += shani_lanes)
+            merkle_shani(digests + index * digest_size,
+                blocks + index * block_size);
+
+        if (index < count)
+        {
+            merkle_one(digests + index * digest_size,
+                blocks + index * block_size);
+            ++index;
+        }
+    }
+
+    return index;
+}
+
+size_t headers(uint8_t* digests, const uint8_t* headers, size_t count) NOEXCEPT
+{
+    size_t index{};
+
+    if (avx2())
+        for (; count - index >= avx2_lanes; index += avx2_lanes)
+            headers_avx2(digests + index * digest_size,
+                headers + index * header_size);
+
+    if (shani())
+        for (; index < count; ++index)
+            header_one(digests + index * digest_size,
+                headers + index * header_size);
+
+    return index;
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+} // namespace dispatch
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
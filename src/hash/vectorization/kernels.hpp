@@ -0,0 +1,53 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_HASH_VECTORIZATION_KERNELS_HPP
+#define LIBBITCOIN_SYSTEM_HASH_VECTORIZATION_KERNELS_HPP
+
+#include <bitcoin/system/define.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace sha {
+namespace dispatch {
+
+// Each kernel is compiled for its own target (see its source), so it must
+// only be called once the corresponding CPU probe has succeeded. Kernel
+// sources include no library headers after setting the target, so that no
+// shared (inline/template) code is emitted with unsupported instructions.
+
+/// Compress count contiguous blocks into state (sha256_2_shani.cpp).
+void compress_shani(uint32_t* state, const uint8_t* blocks,
+    size_t count) NOEXCEPT;
+
+/// Double hash two contiguous blocks into two digests (sha256_2_shani.cpp).
+void merkle_shani(uint8_t* digests, const uint8_t* blocks) NOEXCEPT;
+
+/// Double hash eight contiguous blocks into eight digests (sha256_8_avx2.cpp).
+void merkle_avx2(uint8_t* digests, const uint8_t* blocks) NOEXCEPT;
+
+/// Double hash eight contiguous 80 byte headers into eight digests
+/// (sha256_8_avx2.cpp).
+void headers_avx2(uint8_t* digests, const uint8_t* headers) NOEXCEPT;
+
+} // namespace dispatch
+} // namespace sha
+} // namespace system
+} // namespace libbitcoin
+
+#endif
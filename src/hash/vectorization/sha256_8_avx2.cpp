@@ -1,133 +1,173 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "kernels.hpp"
+
+#include <cstring>
+#include <bitcoin/system/define.hpp>
+
 // Based on:
-// sha256-x86.c - Intel SHA extensions using C intrinsics
-// Written and place in public domain by Jeffrey Walton
-// Based on code from Intel, and by Sean Gulley for the miTLS project.
+// sha256_avx2.cpp - Bitcoin Core 8-way AVX2 double sha256 (MIT license).
 
-#include <stdint.h>
-#include <bitcoin/system/define.hpp>
-#include <bitcoin/system/endian/endian.hpp>
+#if defined(HAVE_XCPU)
+    #include <immintrin.h>
+#endif
 
 namespace libbitcoin {
 namespace system {
-namespace sha256 {
-
-#if defined (DISABLED)
+namespace sha {
+namespace dispatch {
 
 #if !defined(HAVE_XCPU)
 
-void merkle_avx2(digest8& out, const block8& blocks) NOEXCEPT
+void merkle_avx2(uint8_t*, const uint8_t*) NOEXCEPT
 {
     BC_ASSERT_MSG(false, "merkle_avx2 undefined");
 }
 
+void headers_avx2(uint8_t*, const uint8_t*) NOEXCEPT
+{
+    BC_ASSERT_MSG(false, "headers_avx2 undefined");
+}
+
 #else
 
-namespace i256 {
+// All code below is compiled for AVX2, called only if probed.
+#if defined(HAVE_CLANG)
+    #pragma clang attribute push(__attribute__((target("avx2"))), \
+        apply_to = function)
+#elif defined(HAVE_GNUC)
+    #pragma GCC push_options
+    #pragma GCC target("avx2")
+#endif
+
+BC_PUSH_WARNING(NO_POINTER_ARITHMETIC)
+BC_PUSH_WARNING(NO_ARRAY_INDEXING)
 
 using xint256_t = __m256i;
 
-template <uint32_t Offset>
-uint32_t get(xint256_t a) noexcept
+// primitives
+// ----------------------------------------------------------------------------
+
+template <int Lane>
+static INLINE uint32_t get(xint256_t a) NOEXCEPT
 {
-    return _mm256_extract_epi32(a, Offset);
+    return _mm256_extract_epi32(a, Lane);
 }
 
-xint256_t set(uint32_t a) noexcept 
+static INLINE xint256_t set(uint32_t a) NOEXCEPT
 {
     return _mm256_set1_epi32(a);
 }
 
-xint256_t set(uint32_t a, uint32_t b, uint32_t c, uint32_t d,
-    uint32_t e, uint32_t f, uint32_t g, uint32_t h) noexcept
+static INLINE xint256_t set(uint32_t a, uint32_t b, uint32_t c, uint32_t d,
+    uint32_t e, uint32_t f, uint32_t g, uint32_t h) NOEXCEPT
 {
     return _mm256_set_epi32(a, b, c, d, e, f, g, h);
 }
 
-xint256_t shuffle(xint256_t a, xint256_t b) noexcept
-{
-    return _mm256_shuffle_epi8(a, b);
-}
-
-xint256_t sum(xint256_t a, xint256_t b) noexcept
+static INLINE xint256_t sum(xint256_t a, xint256_t b) NOEXCEPT
 {
     return _mm256_add_epi32(a, b);
 }
 
-xint256_t sum(xint256_t a, xint256_t b, xint256_t c) noexcept
+static INLINE xint256_t sum(xint256_t a, xint256_t b, xint256_t c) NOEXCEPT
 {
     return sum(sum(a, b), c);
 }
 
-xint256_t sum(xint256_t a, xint256_t b, xint256_t c,
-    xint256_t d) noexcept
+static INLINE xint256_t sum(xint256_t a, xint256_t b, xint256_t c,
+    xint256_t d) NOEXCEPT
 {
     return sum(sum(a, b), sum(c, d));
 }
 
-xint256_t sum(xint256_t a, xint256_t b, xint256_t c, xint256_t d,
-    xint256_t e) noexcept
+static INLINE xint256_t sum(xint256_t a, xint256_t b, xint256_t c,
+    xint256_t d, xint256_t e) NOEXCEPT
 {
     return sum(sum(a, b, c), sum(d, e));
 }
 
-xint256_t inc(xint256_t& outa, xint256_t b) noexcept
+static INLINE xint256_t inc(xint256_t& a, xint256_t b) NOEXCEPT
 {
-    return ((outa = sum(outa, b)));
+    return ((a = sum(a, b)));
 }
 
-xint256_t inc(xint256_t& outa, xint256_t b, xint256_t c) noexcept
+static INLINE xint256_t inc(xint256_t& a, xint256_t b, xint256_t c) NOEXCEPT
 {
-    return ((outa = sum(outa, b, c)));
+    return ((a = sum(a, b, c)));
 }
 
-xint256_t inc(xint256_t& outa, xint256_t b, xint256_t c,
-    xint256_t d) noexcept
+static INLINE xint256_t inc(xint256_t& a, xint256_t b, xint256_t c,
+    xint256_t d) NOEXCEPT
 {
-    return ((outa = sum(outa, b, c, d)));
+    return ((a = sum(a, b, c, d)));
 }
 
-xint256_t exc(xint256_t a, xint256_t b) noexcept
+static INLINE xint256_t exc(xint256_t a, xint256_t b) NOEXCEPT
 {
     return _mm256_xor_si256(a, b);
 }
 
-xint256_t exc(xint256_t a, xint256_t b, xint256_t c) noexcept
+static INLINE xint256_t exc(xint256_t a, xint256_t b, xint256_t c) NOEXCEPT
 {
     return exc(exc(a, b), c);
 }
 
-xint256_t dis(xint256_t a, xint256_t b) noexcept
+static INLINE xint256_t dis(xint256_t a, xint256_t b) NOEXCEPT
 {
     return _mm256_or_si256(a, b);
 }
 
-xint256_t con(xint256_t a, xint256_t b) noexcept
+static INLINE xint256_t con(xint256_t a, xint256_t b) NOEXCEPT
 {
     return _mm256_and_si256(a, b);
 }
 
-xint256_t shr(xint256_t a, uint32_t bits) noexcept
+static INLINE xint256_t shr(xint256_t a, int bits) NOEXCEPT
 {
     return _mm256_srli_epi32(a, bits);
 }
 
-xint256_t shl(xint256_t a, uint32_t bits) noexcept
+static INLINE xint256_t shl(xint256_t a, int bits) NOEXCEPT
 {
     return _mm256_slli_epi32(a, bits);
 }
 
-} // namespace i256
+// Big endian word byte order, per lane.
+static INLINE xint256_t byteswap(xint256_t a) NOEXCEPT
+{
+    return _mm256_shuffle_epi8(a, set(
+        0x0c0d0e0ful, 0x08090a0bul, 0x04050607ul, 0x00010203ul,
+        0x0c0d0e0ful, 0x08090a0bul, 0x04050607ul, 0x00010203ul));
+}
 
-using namespace i256;
+// functions
+// ----------------------------------------------------------------------------
 
-xint256_t inline SIGMA0(xint256_t x) NOEXCEPT { return exc(dis(shr(x,  2), shl(x, 30)), dis(shr(x, 13), shl(x, 19)), dis(shr(x, 22), shl(x, 10))); }
-xint256_t inline SIGMA1(xint256_t x) NOEXCEPT { return exc(dis(shr(x,  6), shl(x, 26)), dis(shr(x, 11), shl(x, 21)), dis(shr(x, 25), shl(x, 7))); }
-xint256_t inline sigma0(xint256_t x) NOEXCEPT { return exc(dis(shr(x,  7), shl(x, 25)), dis(shr(x, 18), shl(x, 14)), shr(x, 3)); }
-xint256_t inline sigma1(xint256_t x) NOEXCEPT { return exc(dis(shr(x, 17), shl(x, 15)), dis(shr(x, 19), shl(x, 13)), shr(x, 10)); }
-xint256_t inline choice(  xint256_t x, xint256_t y, xint256_t z) NOEXCEPT { return exc(z, con(x, exc(y, z))); }
-xint256_t inline majority(xint256_t x, xint256_t y, xint256_t z) NOEXCEPT { return dis(con(x, y), con(z, dis(x, y))); }
+static INLINE xint256_t SIGMA0(xint256_t x) NOEXCEPT { return exc(dis(shr(x,  2), shl(x, 30)), dis(shr(x, 13), shl(x, 19)), dis(shr(x, 22), shl(x, 10))); }
+static INLINE xint256_t SIGMA1(xint256_t x) NOEXCEPT { return exc(dis(shr(x,  6), shl(x, 26)), dis(shr(x, 11), shl(x, 21)), dis(shr(x, 25), shl(x, 7))); }
+static INLINE xint256_t sigma0(xint256_t x) NOEXCEPT { return exc(dis(shr(x,  7), shl(x, 25)), dis(shr(x, 18), shl(x, 14)), shr(x, 3)); }
+static INLINE xint256_t sigma1(xint256_t x) NOEXCEPT { return exc(dis(shr(x, 17), shl(x, 15)), dis(shr(x, 19), shl(x, 13)), shr(x, 10)); }
+static INLINE xint256_t choice(  xint256_t x, xint256_t y, xint256_t z) NOEXCEPT { return exc(z, con(x, exc(y, z))); }
+static INLINE xint256_t majority(xint256_t x, xint256_t y, xint256_t z) NOEXCEPT { return dis(con(x, y), con(z, dis(x, y))); }
 
-void inline round(xint256_t a, xint256_t b, xint256_t c, xint256_t& d,
+static INLINE void round(xint256_t a, xint256_t b, xint256_t c, xint256_t& d,
     xint256_t e, xint256_t f, xint256_t g, xint256_t& h, xint256_t k) NOEXCEPT
 {
     const auto t1 = sum(h, SIGMA1(e), choice(e, f, g), k);
@@ -136,49 +176,55 @@ void inline round(xint256_t a, xint256_t b, xint256_t c, xint256_t& d,
     h = sum(t1, t2);
 }
 
+// load/store
+// ----------------------------------------------------------------------------
+// Lane 7 is the first block/digest, lane 0 is the last.
+
 template <size_t Offset>
-xint256_t inline read8(const block8& blocks) NOEXCEPT
+static INLINE uint32_t word(const uint8_t* block) NOEXCEPT
 {
-    constexpr auto four = sizeof(uint32_t);
-    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-    const auto value = set(
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[0])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[1])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[2])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[3])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[4])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[5])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[6])),
-        from_little_endian(array_cast<uint8_t, four, Offset>(blocks[7])));
-    BC_POP_WARNING()
-
-    return shuffle(value, set(
-        0x0c0d0e0ful, 0x08090a0bul, 0x04050607ul,  0x00010203ul,
-        0x0c0d0e0ful, 0x08090a0bul, 0x04050607ul, 0x00010203ul));
+    uint32_t value;
+    std::memcpy(&value, block + Offset, sizeof(uint32_t));
+    return value;
 }
 
-template <size_t Offset>
-void inline write8(digest8& hashes, xint256_t value) NOEXCEPT
+template <size_t Offset, size_t Stride = 64>
+static INLINE xint256_t read8(const uint8_t* blocks) NOEXCEPT
 {
-    value = shuffle(value, set(
-        0x0c0d0e0ful, 0x08090a0bul, 0x04050607ul, 0x00010203ul,
-        0x0c0d0e0ful, 0x08090a0bul, 0x04050607ul, 0x00010203ul));
+    return byteswap(set(
+        word<Offset>(blocks + 0 * Stride), word<Offset>(blocks + 1 * Stride),
+        word<Offset>(blocks + 2 * Stride), word<Offset>(blocks + 3 * Stride),
+        word<Offset>(blocks + 4 * Stride), word<Offset>(blocks + 5 * Stride),
+        word<Offset>(blocks + 6 * Stride), word<Offset>(blocks + 7 * Stride)));
+}
 
-    constexpr auto four = sizeof(uint32_t);
-    BC_PUSH_WARNING(NO_ARRAY_INDEXING)
-    array_cast<uint8_t, four, Offset>(hashes[0]) = to_little_endian(get<7>(value));
-    array_cast<uint8_t, four, Offset>(hashes[1]) = to_little_endian(get<6>(value));
-    array_cast<uint8_t, four, Offset>(hashes[2]) = to_little_endian(get<5>(value));
-    array_cast<uint8_t, four, Offset>(hashes[3]) = to_little_endian(get<4>(value));
-    array_cast<uint8_t, four, Offset>(hashes[4]) = to_little_endian(get<3>(value));
-    array_cast<uint8_t, four, Offset>(hashes[5]) = to_little_endian(get<2>(value));
-    array_cast<uint8_t, four, Offset>(hashes[6]) = to_little_endian(get<1>(value));
-    array_cast<uint8_t, four, Offset>(hashes[7]) = to_little_endian(get<0>(value));
-    BC_POP_WARNING()
+template <size_t Offset, int Lane>
+static INLINE void put(uint8_t* digests, xint256_t value) NOEXCEPT
+{
+    const auto lane = get<Lane>(value);
+    std::memcpy(digests + (7 - Lane) * 32 + Offset, &lane, sizeof(uint32_t));
 }
 
-// Eight blocks in eight lanes, doubled.
-void merkle_avx2(digest8& out, const block8& blocks) NOEXCEPT
+template <size_t Offset>
+static INLINE void write8(uint8_t* digests, xint256_t value) NOEXCEPT
+{
+    value = byteswap(value);
+    put<Offset, 7>(digests, value);
+    put<Offset, 6>(digests, value);
+    put<Offset, 5>(digests, value);
+    put<Offset, 4>(digests, value);
+    put<Offset, 3>(digests, value);
+    put<Offset, 2>(digests, value);
+    put<Offset, 1>(digests, value);
+    put<Offset, 0>(digests, value);
+}
+
+// kernel
+// ----------------------------------------------------------------------------
+
+// Eight blocks in eight lanes, doubled. All blocks are read before any digest
+// is written, so digests may be blocks.
+void merkle_avx2(uint8_t* digests, const uint8_t* blocks) NOEXCEPT
 {
     // Transform 1.
     auto a = set(0x6a09e667ul);
@@ -420,20 +466,158 @@ void merkle_avx2(digest8& out, const block8& blocks) NOEXCEPT
     round(b, c, d, e, f, g, h, a, sum(set(0xc67178f2ul),     w15, sigma1(w13), w08, sigma0(w00)));
 
     // Output.
-    write8< 0>(out, sum(a, set(0x6a09e667ul)));
-    write8< 4>(out, sum(b, set(0xbb67ae85ul)));
-    write8< 8>(out, sum(c, set(0x3c6ef372ul)));
-    write8<12>(out, sum(d, set(0xa54ff53aul)));
-    write8<16>(out, sum(e, set(0x510e527ful)));
-    write8<20>(out, sum(f, set(0x9b05688cul)));
-    write8<24>(out, sum(g, set(0x1f83d9abul)));
-    write8<28>(out, sum(h, set(0x5be0cd19ul)));
+    write8< 0>(digests, sum(a, set(0x6a09e667ul)));
+    write8< 4>(digests, sum(b, set(0xbb67ae85ul)));
+    write8< 8>(digests, sum(c, set(0x3c6ef372ul)));
+    write8<12>(digests, sum(d, set(0xa54ff53aul)));
+    write8<16>(digests, sum(e, set(0x510e527ful)));
+    write8<20>(digests, sum(f, set(0x9b05688cul)));
+    write8<24>(digests, sum(g, set(0x1f83d9abul)));
+    write8<28>(digests, sum(h, set(0x5be0cd19ul)));
 }
 
-#endif // HAVE_XCPU
+// Eight 80 byte headers in eight lanes, doubled.
+// ----------------------------------------------------------------------------
+// Header message blocks are not constant, so rounds are not precomputed (as
+// above) beyond the constant words of the pad blocks, which fold away.
+
+constexpr uint32_t k[64]
+{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+constexpr uint32_t initial[8]
+{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static INLINE void initialize(xint256_t* state) NOEXCEPT
+{
+    for (size_t word = 0; word < 8; ++word)
+        state[word] = set(initial[word]);
+}
 
-#endif // DISABLED
+static INLINE void schedule(xint256_t* w, size_t i) NOEXCEPT
+{
+    inc(w[i % 16], sigma1(w[(i + 14) % 16]), w[(i + 9) % 16],
+        sigma0(w[(i + 1) % 16]));
+}
+
+// Compress one message block (w, consumed) into state.
+static INLINE void compress(xint256_t* state, xint256_t* w) NOEXCEPT
+{
+    auto a = state[0], b = state[1], c = state[2], d = state[3];
+    auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (size_t i = 0; i < 64; i += 8)
+    {
+        if (i >= 16)
+            for (size_t j = i; j < i + 8; ++j)
+                schedule(w, j);
+
+        round(a, b, c, d, e, f, g, h, sum(set(k[i + 0]), w[(i + 0) % 16]));
+        round(h, a, b, c, d, e, f, g, sum(set(k[i + 1]), w[(i + 1) % 16]));
+        round(g, h, a, b, c, d, e, f, sum(set(k[i + 2]), w[(i + 2) % 16]));
+        round(f, g, h, a, b, c, d, e, sum(set(k[i + 3]), w[(i + 3) % 16]));
+        round(e, f, g, h, a, b, c, d, sum(set(k[i + 4]), w[(i + 4) % 16]));
+        round(d, e, f, g, h, a, b, c, sum(set(k[i + 5]), w[(i + 5) % 16]));
+        round(c, d, e, f, g, h, a, b, sum(set(k[i + 6]), w[(i + 6) % 16]));
+        round(b, c, d, e, f, g, h, a, sum(set(k[i + 7]), w[(i + 7) % 16]));
+    }
+
+    inc(state[0], a); inc(state[1], b); inc(state[2], c); inc(state[3], d);
+    inc(state[4], e); inc(state[5], f); inc(state[6], g); inc(state[7], h);
+}
+
+// All headers are read before any digest is written.
+void headers_avx2(uint8_t* digests, const uint8_t* headers) NOEXCEPT
+{
+    constexpr size_t size = 80;
+    xint256_t state[8];
+    xint256_t w[16];
+
+    // First block (header bytes 0..63).
+    initialize(state);
+    w[ 0] = read8< 0, size>(headers);
+    w[ 1] = read8< 4, size>(headers);
+    w[ 2] = read8< 8, size>(headers);
+    w[ 3] = read8<12, size>(headers);
+    w[ 4] = read8<16, size>(headers);
+    w[ 5] = read8<20, size>(headers);
+    w[ 6] = read8<24, size>(headers);
+    w[ 7] = read8<28, size>(headers);
+    w[ 8] = read8<32, size>(headers);
+    w[ 9] = read8<36, size>(headers);
+    w[10] = read8<40, size>(headers);
+    w[11] = read8<44, size>(headers);
+    w[12] = read8<48, size>(headers);
+    w[13] = read8<52, size>(headers);
+    w[14] = read8<56, size>(headers);
+    w[15] = read8<60, size>(headers);
+    compress(state, w);
+
+    // Second block (header bytes 64..79), pad and 640 bit length.
+    w[ 0] = read8<64, size>(headers);
+    w[ 1] = read8<68, size>(headers);
+    w[ 2] = read8<72, size>(headers);
+    w[ 3] = read8<76, size>(headers);
+    w[ 4] = set(0x80000000ul);
+    for (size_t word = 5; word < 15; ++word)
+        w[word] = set(0ul);
+
+    w[15] = set(0x00000280ul);
+    compress(state, w);
+
+    // Second hash (state as 32 byte message), pad and 256 bit length.
+    for (size_t word = 0; word < 8; ++word)
+        w[word] = state[word];
+
+    w[8] = set(0x80000000ul);
+    for (size_t word = 9; word < 15; ++word)
+        w[word] = set(0ul);
+
+    w[15] = set(0x00000100ul);
+    initialize(state);
+    compress(state, w);
+
+    write8< 0>(digests, state[0]);
+    write8< 4>(digests, state[1]);
+    write8< 8>(digests, state[2]);
+    write8<12>(digests, state[3]);
+    write8<16>(digests, state[4]);
+    write8<20>(digests, state[5]);
+    write8<24>(digests, state[6]);
+    write8<28>(digests, state[7]);
+}
+
+BC_POP_WARNING()
+BC_POP_WARNING()
+
+#if defined(HAVE_CLANG)
+    #pragma clang attribute pop
+#elif defined(HAVE_GNUC)
+    #pragma GCC pop_options
+#endif
+
+#endif // HAVE_XCPU
 
-} // namespace sha256
+} // namespace dispatch
+} // namespace sha
 } // namespace system
 } // namespace libbitcoin
@@ -0,0 +1,266 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/system/machine/profiler.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <utility>
+#include <bitcoin/system/chain/enums/forks.hpp>
+#include <bitcoin/system/chain/enums/opcode.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+namespace machine {
+
+using namespace std::chrono;
+constexpr auto relaxed = std::memory_order_relaxed;
+
+// Process-wide counters, relaxed as each is independent.
+struct counters
+{
+    std::array<std::atomic<uint64_t>, profile::opcodes> counts{};
+    std::array<std::atomic<uint64_t>, profile::opcodes> nanoseconds{};
+    std::atomic<uint64_t> runs{};
+    std::atomic<uint64_t> allocations{};
+    std::atomic<uint64_t> embedded_runs{};
+    std::atomic<uint64_t> embedded_allocations{};
+    std::atomic<uint64_t> sighashes{};
+    std::atomic<uint64_t> verifications{};
+    std::atomic<uint64_t> stack_high_water{};
+    std::atomic<profiler::allocation_counter> counter{};
+};
+
+static counters& instance() NOEXCEPT
+{
+    static counters values{};
+    return values;
+}
+
+static size_t allocated() NOEXCEPT
+{
+    const auto counter = instance().counter.load(relaxed);
+    return is_null(counter) ? zero : counter();
+}
+
+// Depth of embedded connections on this thread.
+thread_local size_t embedding{};
+
+// scope
+// ----------------------------------------------------------------------------
+
+profiler::scope::scope() NOEXCEPT
+  : embedded_(!is_zero(embedding)),
+    allocations_(embedded_ ? zero : allocated())
+{
+    auto& values = instance();
+    (embedded_ ? values.embedded_runs : values.runs).fetch_add(one, relaxed);
+}
+
+profiler::scope::~scope() NOEXCEPT
+{
+    // Allocations are attributed to the outermost embedded connection.
+    if (embedded_)
+        return;
+
+    // A counter set or unset within the scope may precede the start value.
+    instance().allocations.fetch_add(floored_subtract(allocated(),
+        allocations_), relaxed);
+}
+
+// embedded
+// ----------------------------------------------------------------------------
+
+profiler::embedded::embedded() NOEXCEPT
+  : outermost_(is_zero(embedding++)),
+    allocations_(outermost_ ? allocated() : zero)
+{
+}
+
+profiler::embedded::~embedded() NOEXCEPT
+{
+    --embedding;
+    if (!outermost_)
+        return;
+
+    instance().embedded_allocations.fetch_add(floored_subtract(allocated(),
+        allocations_), relaxed);
+}
+
+// Evaluation hooks.
+// ----------------------------------------------------------------------------
+
+profiler::timer profiler::start() NOEXCEPT
+{
+    return steady_clock::now();
+}
+
+void profiler::executed(chain::opcode code, const timer& start) NOEXCEPT
+{
+    const auto elapsed = duration_cast<nanoseconds>(steady_clock::now() -
+        start).count();
+
+    const auto index = static_cast<size_t>(code);
+    auto& values = instance();
+    values.counts.at(index).fetch_add(one, relaxed);
+    values.nanoseconds.at(index).fetch_add(
+        possible_sign_cast<uint64_t>(elapsed), relaxed);
+}
+
+void profiler::stacked(size_t size) NOEXCEPT
+{
+    auto& high = instance().stack_high_water;
+    auto current = high.load(relaxed);
+    while (current < size &&
+        !high.compare_exchange_weak(current, size, relaxed));
+}
+
+void profiler::sighashed() NOEXCEPT
+{
+    instance().sighashes.fetch_add(one, relaxed);
+}
+
+void profiler::verified() NOEXCEPT
+{
+    instance().verifications.fetch_add(one, relaxed);
+}
+
+void profiler::set_allocation_counter(allocation_counter counter) NOEXCEPT
+{
+    instance().counter.store(counter, relaxed);
+}
+
+// Counters.
+// ----------------------------------------------------------------------------
+
+profile profiler::snapshot() NOEXCEPT
+{
+    profile out{};
+    const auto& values = instance();
+
+    for (size_t code = 0; code < profile::opcodes; ++code)
+    {
+        auto& operation = out.operations.at(code);
+        operation.count = values.counts.at(code).load(relaxed);
+        operation.nanoseconds = values.nanoseconds.at(code).load(relaxed);
+    }
+
+    out.runs = values.runs.load(relaxed);
+    out.allocations = values.allocations.load(relaxed);
+    out.embedded_runs = values.embedded_runs.load(relaxed);
+    out.embedded_allocations = values.embedded_allocations.load(relaxed);
+    out.sighashes = values.sighashes.load(relaxed);
+    out.verifications = values.verifications.load(relaxed);
+    out.stack_high_water = values.stack_high_water.load(relaxed);
+    return out;
+}
+
+void profiler::clear() NOEXCEPT
+{
+    auto& values = instance();
+
+    for (size_t code = 0; code < profile::opcodes; ++code)
+    {
+        values.counts.at(code).store(zero, relaxed);
+        values.nanoseconds.at(code).store(zero, relaxed);
+    }
+
+    values.runs.store(zero, relaxed);
+    values.allocations.store(zero, relaxed);
+    values.embedded_runs.store(zero, relaxed);
+    values.embedded_allocations.store(zero, relaxed);
+    values.sighashes.store(zero, relaxed);
+    values.verifications.store(zero, relaxed);
+    values.stack_high_water.store(zero, relaxed);
+}
+
+// JSON value convertors.
+// ----------------------------------------------------------------------------
+
+namespace json = boost::json;
+
+// boost/json will soon have NOEXCEPT: github.com/boostorg/json/pull/636
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+profile tag_invoke(json::value_to_tag<profile>,
+    const json::value& value) NOEXCEPT
+{
+    profile out{};
+    for (const auto& element: value.at("operations").as_array())
+    {
+        const auto code = element.at("code").to_number<uint8_t>();
+        auto& operation = out.operations.at(code);
+        operation.count = element.at("count").to_number<uint64_t>();
+        operation.nanoseconds =
+            element.at("nanoseconds").to_number<uint64_t>();
+    }
+
+    out.runs = value.at("runs").to_number<uint64_t>();
+    out.allocations = value.at("allocations").to_number<uint64_t>();
+    out.embedded_runs = value.at("embedded_runs").to_number<uint64_t>();
+    out.embedded_allocations =
+        value.at("embedded_allocations").to_number<uint64_t>();
+    out.sighashes = value.at("sighashes").to_number<uint64_t>();
+    out.verifications = value.at("verifications").to_number<uint64_t>();
+    out.stack_high_water = value.at("stack_high_water").to_number<uint64_t>();
+    return out;
+}
+
+// Only executed operations are written, named as if all rules are active.
+void tag_invoke(json::value_from_tag, json::value& value,
+    const profile& profile) NOEXCEPT
+{
+    json::array operations{};
+    for (size_t code = 0; code < profile::opcodes; ++code)
+    {
+        const auto& operation = profile.operations.at(code);
+        if (is_zero(operation.count))
+            continue;
+
+        const auto opcode = static_cast<chain::opcode>(code);
+        operations.push_back(
+        {
+            { "opcode", chain::opcode_to_mnemonic(opcode,
+                chain::forks::all_rules) },
+            { "code", code },
+            { "count", operation.count },
+            { "nanoseconds", operation.nanoseconds }
+        });
+    }
+
+    value =
+    {
+        { "runs", profile.runs },
+        { "allocations", profile.allocations },
+        { "embedded_runs", profile.embedded_runs },
+        { "embedded_allocations", profile.embedded_allocations },
+        { "sighashes", profile.sighashes },
+        { "verifications", profile.verifications },
+        { "stack_high_water", profile.stack_high_water },
+        { "operations", std::move(operations) }
+    };
+}
+
+BC_POP_WARNING()
+
+} // namespace machine
+} // namespace system
+} // namespace libbitcoin
@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_SYSTEM_PARALLEL_HPP
+#define LIBBITCOIN_SYSTEM_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <bitcoin/system/boost.hpp>
+#include <bitcoin/system/define.hpp>
+#include <bitcoin/system/math/math.hpp>
+
+namespace libbitcoin {
+namespace system {
+
+/// Invoke function(index) for each index in [0, count), on tasks posted to the
+/// caller-owned pool (up to hardware concurrency), with the caller working as
+/// one of them. Each task claims the next unclaimed index, so indexes start in
+/// order and uneven work is balanced across tasks. Returns once every index
+/// has completed, without waiting on tasks that have yet to start, so the
+/// caller may itself be a thread of the pool. The function must not throw.
+template <typename Function>
+void parallel_for(boost::asio::thread_pool& pool, size_t count,
+    const Function& function) NOEXCEPT
+{
+    const auto tasks = std::min(count,
+        std::max(one, size_t{ std::thread::hardware_concurrency() }));
+
+    if (tasks <= one)
+    {
+        for (size_t index = zero; index < count; ++index)
+            function(index);
+
+        return;
+    }
+
+    // Shared by tasks that may start after return (these claim no index).
+    struct progress
+    {
+        std::atomic<size_t> next{ zero };
+        std::atomic<size_t> done{ zero };
+        std::mutex mutex{};
+        std::condition_variable completed{};
+    };
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    const auto shared = std::make_shared<progress>();
+    const auto task = [shared, count, &function]() NOEXCEPT
+    {
+        auto& state = *shared;
+        for (auto index = state.next.fetch_add(one, std::memory_order_relaxed);
+            index < count;
+            index = state.next.fetch_add(one, std::memory_order_relaxed))
+        {
+            function(index);
+            if (add1(state.done.fetch_add(one,
+                std::memory_order_acq_rel)) == count)
+            {
+                std::lock_guard lock(state.mutex);
+                state.completed.notify_all();
+            }
+        }
+    };
+
+    for (auto posted = one; posted < tasks; ++posted)
+        boost::asio::post(pool, task);
+
+    task();
+    std::unique_lock lock(shared->mutex);
+    shared->completed.wait(lock, [&]() NOEXCEPT
+    {
+        return shared->done.load(std::memory_order_acquire) == count;
+    });
+    BC_POP_WARNING()
+}
+
+} // namespace system
+} // namespace libbitcoin
+
+#endif
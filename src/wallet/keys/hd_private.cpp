@@ -18,6 +18,7 @@
  */
 #include <bitcoin/system/wallet/keys/hd_private.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -269,6 +270,58 @@ hd_public hd_private::derive_public(uint32_t index) const NOEXCEPT
     return derive_private(index).to_public();
 }
 
+std::vector<hd_private> hd_private::derive_private_range(uint32_t first,
+    size_t count) const NOEXCEPT
+{
+    constexpr uint8_t depth = 0;
+
+    if (is_zero(count) || count > add1<uint64_t>(max_uint32 - first) ||
+        lineage_.depth == max_uint8)
+        return {};
+
+    // Hardened and non-hardened child data are the same size.
+    using child_data = data_array<ec_compressed_size + sizeof(uint32_t)>;
+    std::vector<child_data> data(count);
+    for (size_t child = 0; child < count; ++child)
+    {
+        const auto index = possible_narrow_cast<uint32_t>(first + child);
+        data[child] = (index >= hd_first_hardened_key) ?
+            splice(to_array(depth), secret_, to_big_endian(index)) :
+            splice(point_, to_big_endian(index));
+    }
+
+    const std_vector<data_slice> set(data.begin(), data.end());
+    const auto codes = hmac<sha512>::codes(set, chain_);
+    const auto parent = fingerprint();
+    std::vector<hd_private> children{};
+    children.reserve(count);
+
+    for (size_t child = 0; child < count; ++child)
+    {
+        const auto intermediate = split(codes[child]);
+
+        // The child key ki is (parse256(IL) + kpar) mod n:
+        auto secret = secret_;
+        if (!ec_add(secret, intermediate.first))
+        {
+            children.emplace_back();
+            continue;
+        }
+
+        const hd_lineage lineage
+        {
+            lineage_.prefixes,
+            add1(lineage_.depth),
+            parent,
+            possible_narrow_cast<uint32_t>(first + child)
+        };
+
+        children.push_back(hd_private(secret, intermediate.second, lineage));
+    }
+
+    return children;
+}
+
 // Operators.
 // ----------------------------------------------------------------------------
 
@@ -18,6 +18,7 @@
  */
 #include <bitcoin/system/wallet/keys/hd_public.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <bitcoin/system/crypto/crypto.hpp>
@@ -230,6 +231,62 @@ hd_public hd_public::derive_public(uint32_t index) const NOEXCEPT
     return hd_public(child, intermediate.second, lineage);
 }
 
+std::vector<hd_public> hd_public::derive_public_range(uint32_t first,
+    size_t count) const NOEXCEPT
+{
+    if (is_zero(count) || first >= hd_first_hardened_key ||
+        count > (hd_first_hardened_key - first) ||
+        lineage_.depth == max_uint8)
+        return {};
+
+    using child_data = data_array<ec_compressed_size + sizeof(uint32_t)>;
+    std::vector<child_data> data(count);
+    for (size_t child = 0; child < count; ++child)
+        data[child] = splice(point_, to_big_endian(
+            possible_narrow_cast<uint32_t>(first + child)));
+
+    const std_vector<data_slice> set(data.begin(), data.end());
+    const auto codes = hmac<sha512>::codes(set, chain_);
+
+    secret_list tweaks(count);
+    std::transform(codes.begin(), codes.end(), tweaks.begin(),
+        [](const long_hash& code) NOEXCEPT
+        {
+            return split(code).first;
+        });
+
+    // The returned child key Ki is point(parse256(IL)) + Kpar.
+    compressed_list points;
+    if (!ec_add(points, point_, tweaks))
+        return {};
+
+    const auto parent = fingerprint();
+    std::vector<hd_public> children{};
+    children.reserve(count);
+
+    for (size_t child = 0; child < count; ++child)
+    {
+        if (points[child] == null_ec_compressed)
+        {
+            children.emplace_back();
+            continue;
+        }
+
+        const hd_lineage lineage
+        {
+            lineage_.prefixes,
+            add1(lineage_.depth),
+            parent,
+            possible_narrow_cast<uint32_t>(first + child)
+        };
+
+        children.push_back(hd_public(points[child],
+            split(codes[child]).second, lineage));
+    }
+
+    return children;
+}
+
 // Helpers.
 // ----------------------------------------------------------------------------
 
@@ -36,12 +36,40 @@ constexpr uint8_t golomb_bits = 19;
 constexpr uint64_t golomb_target_false_positive_rate = 784931;
 
 constexpr auto rate = golomb_target_false_positive_rate;
+constexpr auto op_return = static_cast<uint8_t>(chain::opcode::op_return);
+
+// Encode the (siphash) set of filter scripts.
+static void encode_filter(std::vector<uint64_t>& hashes,
+    data_chunk& out_filter) NOEXCEPT
+{
+    // Order and remove duplicates (by hash value).
+    golomb::distinct_hashes(hashes);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stream::out::data stream(out_filter);
+    BC_POP_WARNING()
+
+    write::bytes::ostream writer(stream);
+    writer.write_variable(hashes.size());
+    golomb::construct(stream, hashes, golomb_bits, rate);
+
+    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+    stream.flush();
+    BC_POP_WARNING()
+}
 
 bool compute_filter(const chain::block& block, data_chunk& out_filter) NOEXCEPT
 {
     const auto hash = block.hash();
     const auto key = to_siphash_key(slice<zero, to_half(hash_size)>(hash));
-    data_stack scripts;
+    std_vector<const chain::script*> scripts{};
+    size_t size{};
+
+    const auto include = [&](const chain::script& script) NOEXCEPT
+    {
+        scripts.push_back(&script);
+        size += script.serialized_size(false);
+    };
 
     for (const auto& tx: *block.transactions_ptr())
     {
@@ -55,7 +83,7 @@ bool compute_filter(const chain::block& block, data_chunk& out_filter) NOEXCEPT
                 const auto& script = input->prevout->script();
 
                 if (!script.ops().empty())
-                    scripts.push_back(script.to_data(false));
+                    include(script);
             }
         }
 
@@ -67,25 +95,92 @@ bool compute_filter(const chain::block& block, data_chunk& out_filter) NOEXCEPT
             // bip138:exclude all outputs that start with OP_RETURN.
             if (!script.ops().empty() &&
                 !chain::script::is_pay_op_return_pattern(script.ops()))
-                scripts.push_back(script.to_data(false));
+                include(script);
         }
     }
 
-    // Order and remove duplicates.
-    distinct(scripts);
+    // Scripts are serialized into one buffer and hashed from slices of it.
+    data_chunk buffer(size);
+    std_vector<data_slice> slices{};
+    slices.reserve(scripts.size());
+    write::bytes::copy writer(buffer);
 
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream::out::data stream(out_filter);
-    BC_POP_WARNING()
+    for (const auto script: scripts)
+    {
+        const auto first = std::next(buffer.begin(),
+            writer.get_write_position());
 
-    write::bytes::ostream writer(stream);
-    writer.write_variable(scripts.size());
-    golomb::construct(stream, scripts, golomb_bits, key, rate);
+        script->to_data(writer, false);
+        slices.emplace_back(first, std::next(buffer.begin(),
+            writer.get_write_position()));
+    }
 
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream.flush();
-    BC_POP_WARNING()
+    auto hashes = siphashes(key, slices);
+    encode_filter(hashes, out_filter);
+    return true;
+}
+
+bool compute_filter(const chain::block_view& block,
+    const std_vector<data_slice>& prevout_scripts,
+    data_chunk& out_filter) NOEXCEPT
+{
+    if (!block.is_valid())
+        return false;
+
+    const auto hash = block.hash();
+    const auto key = to_siphash_key(slice<zero, to_half(hash_size)>(hash));
+    std_vector<data_slice> slices{};
+    size_t inputs{};
+
+    for (size_t tx = 0; tx < block.transaction_count(); ++tx)
+    {
+        const auto transaction = block.transaction_at(tx);
+        if (!transaction.is_coinbase())
+            inputs += transaction.input_count();
+
+        for (size_t index = 0; index < transaction.output_count(); ++index)
+        {
+            const auto& script = transaction.output_at(index).script();
+
+            // bip138: any "nil" items MUST NOT be included.
+            // bip138:exclude all outputs that start with OP_RETURN.
+            if (!script.empty() && script.front() != op_return)
+                slices.push_back(script);
+        }
+    }
+
+    if (prevout_scripts.size() != inputs)
+        return false;
+
+    for (const auto& script: prevout_scripts)
+        if (!script.empty())
+            slices.push_back(script);
+
+    auto hashes = siphashes(key, slices);
+    encode_filter(hashes, out_filter);
+    return true;
+}
+
+bool compute_filter(const chain::block& block,
+    const hash_digest& previous_header, data_chunk& out_filter,
+    hash_digest& out_header) NOEXCEPT
+{
+    if (!compute_filter(block, out_filter))
+        return false;
 
+    out_header = compute_filter_header(previous_header, out_filter);
+    return true;
+}
+
+bool compute_filter(const chain::block_view& block,
+    const std_vector<data_slice>& prevout_scripts,
+    const hash_digest& previous_header, data_chunk& out_filter,
+    hash_digest& out_header) NOEXCEPT
+{
+    if (!compute_filter(block, prevout_scripts, out_filter))
+        return false;
+
+    out_header = compute_filter_header(previous_header, out_filter);
     return true;
 }
 
@@ -95,17 +190,23 @@ hash_digest compute_filter_header(const hash_digest& previous_block_hash,
     return bitcoin_hash(splice(bitcoin_hash(filter), previous_block_hash));
 }
 
+// The filter following the set size.
+static data_slice compressed_set(const block_filter& filter,
+    bytereader& reader) NOEXCEPT
+{
+    const auto start = std::next(filter.filter.begin(),
+        reader.get_read_position());
+
+    return { start, filter.filter.end() };
+}
+
 bool match_filter(const block_filter& filter,
     const chain::script& script) NOEXCEPT
 {
     if (script.ops().empty())
         return false;
 
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream::in::copy stream(filter.filter);
-    BC_POP_WARNING()
-
-    read::bytes::istream reader(stream);
+    read::bytes::copy reader(filter.filter);
     const auto set_size = reader.read_variable();
 
     if (!reader)
@@ -115,7 +216,9 @@ bool match_filter(const block_filter& filter,
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
 
-    return golomb::match(target, stream, set_size, key, golomb_bits, rate);
+    // The compressed set is decoded in place (word at a time).
+    return golomb::match(target, compressed_set(filter, reader), set_size,
+        key, golomb_bits, rate);
 }
 
 bool match_filter(const block_filter& filter,
@@ -138,11 +241,7 @@ bool match_filter(const block_filter& filter,
     if (stack.empty())
         return false;
 
-    BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
-    stream::in::copy stream(filter.filter);
-    BC_POP_WARNING()
-
-    read::bytes::istream reader(stream);
+    read::bytes::copy reader(filter.filter);
     const auto set_size = reader.read_variable();
 
     if (!reader)
@@ -151,8 +250,9 @@ bool match_filter(const block_filter& filter,
     const auto hash = slice<zero, to_half(hash_size)>(filter.hash);
     const auto key = to_siphash_key(hash);
 
-    stack.shrink_to_fit();
-    return golomb::match(stack, stream, set_size, key, golomb_bits, rate);
+    // The compressed set is decoded in place (word at a time).
+    return golomb::match(stack, compressed_set(filter, reader), set_size,
+        key, golomb_bits, rate);
 }
 
 bool match_filter(const block_filter& filter,
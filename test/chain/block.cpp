@@ -205,6 +205,23 @@ BOOST_AUTO_TEST_CASE(block__constructor__reader__success)
     BOOST_REQUIRE(!block.is_invalid_merkle_root());
 }
 
+BOOST_AUTO_TEST_CASE(block__constructor__reader_arena__expected)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto data = genesis.to_data(true);
+    std::pmr::monotonic_buffer_resource arena{};
+    read::bytes::copy source(data);
+    source.set_arena(&arena);
+
+    // Block must be destroyed before its arena.
+    {
+        const accessor block(source, true);
+        BOOST_REQUIRE(block.is_valid());
+        BOOST_REQUIRE(!block.is_invalid_merkle_root());
+        BOOST_REQUIRE(block == genesis);
+    }
+}
+
 // operators
 // ----------------------------------------------------------------------------
 
@@ -302,6 +319,38 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
     BOOST_REQUIRE_EQUAL(instance.hash(), instance.header().hash());
 }
 
+// transaction_hashes
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__default__empty)
+{
+    const block instance;
+    BOOST_REQUIRE(instance.transaction_hashes(false).empty());
+    BOOST_REQUIRE(instance.transaction_hashes(true).empty());
+}
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__expected_block__transaction_hashes)
+{
+    const auto nominal = expected_block.transaction_hashes(false);
+    const auto witness = expected_block.transaction_hashes(true);
+    const auto& txs = *expected_block.transactions_ptr();
+    BOOST_REQUIRE_EQUAL(nominal.size(), txs.size());
+    BOOST_REQUIRE_EQUAL(witness.size(), txs.size());
+
+    for (size_t index = 0; index < txs.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(nominal[index], txs[index]->hash(false));
+        BOOST_REQUIRE_EQUAL(witness[index], txs[index]->hash(true));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block__transaction_hashes__mainnet_genesis__merkle_root)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto hashes = genesis.transaction_hashes(false);
+    BOOST_REQUIRE_EQUAL(hashes.size(), one);
+    BOOST_REQUIRE_EQUAL(hashes.front(), genesis.header().merkle_root());
+}
+
 // is_segregated
 // serialized_size
 
@@ -312,6 +361,169 @@ BOOST_AUTO_TEST_CASE(block__hash__default__matches_header_hash)
 // accept
 // connect
 
+BOOST_AUTO_TEST_CASE(block__connect__concurrent_missing_prevouts__same_as_sequential)
+{
+    const context state{};
+    BOOST_REQUIRE_EQUAL(expected_block.connect(state), error::missing_previous_output);
+
+    for (const size_t threads: { 1u, 4u })
+    {
+        boost::asio::thread_pool pool(threads);
+        BOOST_REQUIRE_EQUAL(expected_block.connect(state, pool), error::missing_previous_output);
+        pool.join();
+    }
+}
+
+// Single input p2pkh spend by a key distinct to index. An invalid spend has
+// a valid signature encoding, but for hash_all (not the declared hash_none).
+static transaction key_hash_spend(size_t index, bool valid=true)
+{
+    constexpr uint64_t value = 42;
+    ec_compressed key{};
+    const auto secret = sha256_hash(to_little_endian(index));
+    BOOST_REQUIRE(secret_to_public(key, secret));
+    const script prevout{ script::to_pay_key_hash_pattern(bitcoin_short_hash(key)) };
+    const point outpoint{ sha256_hash(to_big_endian(index)), 0 };
+    const outputs outs{ { sub1(value), script{ "return" } } };
+
+    endorsement endorsed{};
+    const transaction unsigned_tx{ 1, { { outpoint, script{}, witness{}, max_uint32 } }, outs, 0 };
+    BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed, secret, prevout, 0, value, coverage::hash_all, script_version::unversioned, false));
+    if (!valid)
+        endorsed.back() = coverage::hash_none;
+
+    const script input_script{ { { endorsed, true }, { to_chunk(key), true } } };
+    transaction tx{ 1, inputs{ { outpoint, input_script, witness{}, max_uint32 } }, outs, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(value, prevout);
+    return tx;
+}
+
+// Single input bare 2-of-3 multisig spend by keys distinct to index, signed
+// by the second and third keys (not the leading key).
+static transaction multisig_spend(size_t index)
+{
+    constexpr uint64_t value = 42;
+    std::vector<ec_secret> secrets{};
+    data_stack keys{};
+    for (size_t key = 0; key < 3u; ++key)
+    {
+        ec_compressed point{};
+        secrets.push_back(sha256_hash(to_little_endian(index * 3u + key)));
+        BOOST_REQUIRE(secret_to_public(point, secrets.back()));
+        keys.push_back(to_chunk(point));
+    }
+
+    const script prevout{ script::to_pay_multisig_pattern(2, keys) };
+    const point outpoint{ bitcoin_hash(to_big_endian(index)), 0 };
+    const outputs outs{ { sub1(value), script{ "return" } } };
+    const transaction unsigned_tx{ 1, { { outpoint, script{}, witness{}, max_uint32 } }, outs, 0 };
+
+    operations ops{ { opcode::push_size_0 } };
+    for (size_t key = 1; key < 3u; ++key)
+    {
+        endorsement endorsed{};
+        BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed, secrets[key], prevout, 0, value, coverage::hash_all, script_version::unversioned, false));
+        ops.emplace_back(endorsed, true);
+    }
+
+    transaction tx{ 1, inputs{ { outpoint, script{ std::move(ops) }, witness{}, max_uint32 } }, outs, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(value, prevout);
+    return tx;
+}
+
+// Alternating p2pkh and multisig spends, with the given spend invalid.
+static block get_mixed_block(size_t count, size_t invalid=max_size_t)
+{
+    transactions txs{};
+    txs.reserve(count);
+    for (size_t index = 0; index < count; ++index)
+        txs.push_back(is_odd(index) ? multisig_spend(index) :
+            key_hash_spend(index, index != invalid));
+
+    return { header{}, std::move(txs) };
+}
+
+// Connect with uncached signatures, sequential and with pool sizes.
+static void require_connect(const block& instance, const code& expected)
+{
+    context state{};
+    state.forks = forks::all_rules;
+    for (const size_t threads: { 1u, 2u, 4u })
+    {
+        boost::asio::thread_pool pool(threads);
+        signature_cache::instance().clear();
+        BOOST_REQUIRE_EQUAL(instance.connect(state, pool), expected);
+
+        // The pool is reusable across connects.
+        signature_cache::instance().clear();
+        BOOST_REQUIRE_EQUAL(instance.connect(state, pool), expected);
+        pool.join();
+    }
+
+    signature_cache::instance().clear();
+    BOOST_REQUIRE_EQUAL(instance.connect(state), expected);
+    signature_cache::instance().clear();
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__mixed_valid__deferred_checks_verified)
+{
+    // Every deferred check verifies, so concurrent connect does not fall back.
+    context state{};
+    state.forks = forks::all_rules;
+    const auto instance = get_mixed_block(8);
+    boost::asio::thread_pool pool(2);
+    for (const auto& tx: *instance.transactions_ptr())
+    {
+        ec_signature_checks checks{};
+        signature_cache::instance().clear();
+        BOOST_REQUIRE_EQUAL(tx->connect(state, checks), error::transaction_success);
+        BOOST_REQUIRE(verify_signatures(checks, pool));
+    }
+
+    pool.join();
+
+    require_connect(instance, error::block_success);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__mixed_invalid_deferred_signature__sequential_code)
+{
+    // The invalid signature passes deferred evaluation, so concurrent connect
+    // falls back to undeferred evaluation for the exact code.
+    context state{};
+    state.forks = forks::all_rules;
+    const auto instance = get_mixed_block(8, 4);
+    const auto& invalid = *(*instance.transactions_ptr())[4];
+    ec_signature_checks checks{};
+    signature_cache::instance().clear();
+    BOOST_REQUIRE_EQUAL(invalid.connect(state, checks), error::transaction_success);
+    boost::asio::thread_pool pool(2);
+    BOOST_REQUIRE(!verify_signatures(checks, pool));
+    pool.join();
+
+    require_connect(instance, error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(block__connect__mixed_invalid_signatures__lowest_failure)
+{
+    transactions txs{};
+    for (size_t index = 0; index < 8u; ++index)
+        txs.push_back(key_hash_spend(index, index < 3u || index > 5u));
+
+    // A missing prevout (index 2) precedes the invalid signatures (3 to 5).
+    txs[2].inputs_ptr()->front()->prevout.reset();
+    require_connect({ header{}, std::move(txs) }, error::missing_previous_output);
+}
+
+BOOST_AUTO_TEST_CASE(block__check__mainnet_genesis__hashes_cached)
+{
+    const auto genesis = settings(selection::mainnet).genesis_block;
+    const auto& coinbase = *genesis.transactions_ptr()->front();
+    BOOST_REQUIRE(!coinbase.is_hashed());
+    BOOST_REQUIRE_EQUAL(genesis.check(), error::block_success);
+    BOOST_REQUIRE(coinbase.is_hashed());
+    BOOST_REQUIRE_EQUAL(genesis.transaction_hashes(false).front(), genesis.header().merkle_root());
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -671,4 +883,263 @@ BOOST_AUTO_TEST_CASE(block__json__conversions__expected)
     BOOST_REQUIRE(json::value_to<chain::block>(value) == instance);
 }
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Approximates concurrent block parsing (e.g. download) with and without an
+// arena per block. The heap path is the default (make_shared) allocation, and
+// all heap allocations are counted in both (including arena slabs). Only the
+// shared chain objects and their control blocks move to the arena, as script
+// bytes, witness elements and operation vectors remain heap allocated. So
+// the reduction is bounded by the object count, not the total allocations.
+BOOST_AUTO_TEST_CASE(block__constructor__concurrent_arena__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t blocks = 64;
+    constexpr size_t spends = 2'000;
+
+    transactions txs{};
+    txs.reserve(spends);
+    for (size_t spend = 0; spend < spends; ++spend)
+    {
+        txs.emplace_back(
+            1,
+            inputs
+            {
+                { point{ sha256_hash(to_little_endian(spend)), 0 }, script{ "[3044] [02aa]" }, 7 },
+                { point{ sha256_hash(to_big_endian(spend)), 1 }, script{ "[3045] [03bb]" }, 8 }
+            },
+            outputs
+            {
+                { 42, script{ "dup hash160 [1111111111111111111111111111111111111111] equalverify checksig" } },
+                { 24, script{ "hash160 [2222222222222222222222222222222222222222] equal" } }
+            },
+            0);
+    }
+
+    const auto data = block{ header{}, std::move(txs) }.to_data(true);
+
+    // Boost test assertions are not thread safe.
+    std::atomic_bool valid{ true };
+
+    // Each block is parsed by a task of a pool.
+    const auto parse = [&](const auto& parser) NOEXCEPT
+    {
+        boost::asio::thread_pool pool{};
+        for (size_t index = 0; index < blocks; ++index)
+            boost::asio::post(pool, parser);
+
+        pool.join();
+    };
+
+    const auto parse_heap = [&]() NOEXCEPT
+    {
+        read::bytes::copy source(data);
+        if (!block(source, true).is_valid())
+            valid = false;
+    };
+
+    auto allocations = test::allocations();
+    auto start = steady_clock::now();
+    parse(parse_heap);
+
+    const auto heap_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+    const auto heap_allocations = test::allocations() - allocations;
+
+    const auto parse_arena = [&]() NOEXCEPT
+    {
+        std::pmr::monotonic_buffer_resource arena{ data.size() };
+        read::bytes::copy source(data);
+        source.set_arena(&arena);
+        if (!block(source, true).is_valid())
+            valid = false;
+    };
+
+    allocations = test::allocations();
+    start = steady_clock::now();
+    parse(parse_arena);
+
+    const auto arena_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+    const auto arena_allocations = test::allocations() - allocations;
+
+    std::cout << "blocks       : " << blocks << std::endl
+        << "block bytes  : " << data.size() << std::endl
+        << "heap allocs  : " << heap_allocations << std::endl
+        << "arena allocs : " << arena_allocations << std::endl
+        << "heap         : " << heap_time << "us" << std::endl
+        << "arena        : " << arena_time << "us" << std::endl;
+
+    BOOST_REQUIRE(valid);
+    BOOST_REQUIRE_LT(arena_allocations, heap_allocations);
+}
+
+// Padded sha256 message blocks, plus one for the second (double) hash.
+static size_t compressions(size_t bytes)
+{
+    return add1((bytes + 9u + 63u) / 64u);
+}
+
+// Tx hashing in block check and accept: nominal hashes for forward reference,
+// merkle root and hash limit, and witness hashes for the witness commitment.
+// Uncached, each call serializes and hashes. Cached, each tx is serialized
+// once (witness) with both hashes computed from that buffer.
+BOOST_AUTO_TEST_CASE(block__check__cached_hashes__fewer_compressions)
+{
+    using namespace std::chrono;
+    constexpr size_t nominal_calls = 3;
+    constexpr size_t witness_calls = 1;
+    constexpr size_t spends = 2'000;
+
+    transactions txs{};
+    txs.reserve(spends);
+    for (size_t spend = 0; spend < spends; ++spend)
+    {
+        txs.emplace_back(
+            1,
+            inputs
+            {
+                { point{ sha256_hash(to_little_endian(spend)), 0 }, script{}, witness{ "[3044] [02aa]" }, 7 },
+                { point{ sha256_hash(to_big_endian(spend)), 1 }, script{ "[3045] [03bb]" }, witness{}, 8 }
+            },
+            outputs
+            {
+                { 42, script{ "0 [1111111111111111111111111111111111111111]" } },
+                { 24, script{ "hash160 [2222222222222222222222222222222222222222] equal" } }
+            },
+            0);
+    }
+
+    const block instance{ header{}, std::move(txs) };
+    const auto& items = *instance.transactions_ptr();
+
+    size_t uncached_compressions{};
+    size_t cached_compressions{};
+    for (const auto& tx: items)
+    {
+        const auto nominal = compressions(tx->serialized_size(false));
+        const auto witness = compressions(tx->serialized_size(true));
+        uncached_compressions += nominal_calls * nominal + witness_calls * witness;
+        cached_compressions += nominal + witness;
+    }
+
+    hash_digest total{};
+    auto start = steady_clock::now();
+    for (const auto& tx: items)
+    {
+        for (size_t call = 0; call < nominal_calls; ++call)
+            total = xor_data<hash_size>(total, bitcoin_hash(tx->to_data(false)));
+
+        for (size_t call = 0; call < witness_calls; ++call)
+            total = xor_data<hash_size>(total, bitcoin_hash(tx->to_data(true)));
+    }
+
+    const auto uncached_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (const auto& tx: items)
+    {
+        for (size_t call = 0; call < nominal_calls; ++call)
+            total = xor_data<hash_size>(total, tx->hash(false));
+
+        for (size_t call = 0; call < witness_calls; ++call)
+            total = xor_data<hash_size>(total, tx->hash(true));
+    }
+
+    const auto cached_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    std::cout << "transactions : " << items.size() << std::endl
+        << "uncached     : " << uncached_compressions << " compressions, "
+        << uncached_time << "us" << std::endl
+        << "cached       : " << cached_compressions << " compressions, "
+        << cached_time << "us" << std::endl
+        << "digest       : " << encode_base16(total) << std::endl;
+
+    BOOST_REQUIRE_LT(cached_compressions, uncached_compressions);
+}
+
+// Replays connect of a block-sized set of signed spends (uncached), doubling
+// the number of threads from one up to hardware concurrency.
+BOOST_AUTO_TEST_CASE(block__connect__block_replay__thread_scaling)
+{
+    using namespace std::chrono;
+    constexpr size_t spends = 4'000;
+    constexpr size_t rounds = 3;
+    const auto maximum = std::max(one, size_t{ std::thread::hardware_concurrency() });
+
+    context state{};
+    state.forks = forks::all_rules;
+    const auto instance = get_mixed_block(spends);
+    auto& cache = signature_cache::instance();
+
+    std::cout << "transactions : " << spends << std::endl;
+    for (size_t threads = one; threads <= maximum; threads *= 2u)
+    {
+        // The caller also works, so the pool is sized one less than threads.
+        boost::asio::thread_pool pool(sub1(threads));
+        microseconds::rep total{};
+        for (size_t round = 0; round < rounds; ++round)
+        {
+            cache.clear();
+            const auto start = steady_clock::now();
+            BOOST_REQUIRE_EQUAL(instance.connect(state, pool), error::block_success);
+            total += duration_cast<microseconds>(steady_clock::now() - start).count();
+        }
+
+        pool.join();
+        std::cout << "threads " << threads << " : " << total / rounds << "us"
+            << std::endl;
+    }
+
+    cache.clear();
+}
+
+// Compares inline (sequential, undeferred) verification to batched (deferred)
+// verification of a block-sized set of signed spends (uncached).
+BOOST_AUTO_TEST_CASE(block__connect__inline_versus_batched__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t spends = 4'000;
+
+    context state{};
+    state.forks = forks::all_rules;
+    const auto instance = get_mixed_block(spends);
+    auto& cache = signature_cache::instance();
+
+    cache.clear();
+    auto start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.connect(state), error::block_success);
+    const auto inline_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    // Posted tasks are never run by an empty pool, so the caller does all.
+    boost::asio::thread_pool caller(0);
+    cache.clear();
+    start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.connect(state, caller), error::block_success);
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    boost::asio::thread_pool pool{};
+    cache.clear();
+    start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.connect(state, pool), error::block_success);
+    const auto concurrent_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    caller.join();
+    pool.join();
+
+    std::cout << "transactions : " << spends << std::endl
+        << "inline       : " << inline_time << "us" << std::endl
+        << "batched      : " << batched_time << "us" << std::endl
+        << "concurrent   : " << concurrent_time << "us" << std::endl;
+
+    cache.clear();
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,261 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(block_view_tests)
+
+using namespace system::chain;
+
+constexpr auto block100k_data = base16_array(
+    "010000007f110631052deeee06f0754a3629ad7663e56359fd5f3aa7b3e30a00"
+    "000000005f55996827d9712147a8eb6d7bae44175fe0bcfa967e424a25bfe9f4"
+    "dc118244d67fb74c9d8e2f1bea5ee82a03010000000100000000000000000000"
+    "00000000000000000000000000000000000000000000ffffffff07049d8e2f1b"
+    "0114ffffffff0100f2052a0100000043410437b36a7221bc977dce712728a954"
+    "e3b5d88643ed5aef46660ddcfeeec132724cd950c1fdd008ad4a2dfd354d6af0"
+    "ff155fc17c1ee9ef802062feb07ef1d065f0ac000000000100000001260fd102"
+    "fab456d6b169f6af4595965c03c2296ecf25bfd8790e7aa29b404eff01000000"
+    "8c493046022100c56ad717e07229eb93ecef2a32a42ad041832ffe66bd2e1485"
+    "dc6758073e40af022100e4ba0559a4cebbc7ccb5d14d1312634664bac46f36dd"
+    "d35761edaae20cefb16f01410417e418ba79380f462a60d8dd12dcef8ebfd7ab"
+    "1741c5c907525a69a8743465f063c1d9182eea27746aeb9f1f52583040b1bc34"
+    "1b31ca0388139f2f323fd59f8effffffff0200ffb2081d0000001976a914fc7b"
+    "44566256621affb1541cc9d59f08336d276b88ac80f0fa02000000001976a914"
+    "617f0609c9fabb545105f7898f36b84ec583350d88ac00000000010000000122"
+    "cd6da26eef232381b1a670aa08f4513e9f91a9fd129d912081a3dd138cb01301"
+    "0000008c4930460221009339c11b83f234b6c03ebbc4729c2633cbc8cbd0d157"
+    "74594bfedc45c4f99e2f022100ae0135094a7d651801539df110a028d65459d2"
+    "4bc752d7512bc8a9f78b4ab368014104a2e06c38dc72c4414564f190478e3b0d"
+    "01260f09b8520b196c2f6ec3d06239861e49507f09b7568189efe8d327c3384a"
+    "4e488f8c534484835f8020b3669e5aebffffffff0200ac23fc060000001976a9"
+    "14b9a2c9700ff9519516b21af338d28d53ddf5349388ac00743ba40b00000019"
+    "76a914eb675c349c474bec8dea2d79d12cff6f330ab48788ac00000000");
+
+// Coinbase and spend, both with witnesses.
+static block segregated_block(size_t spends)
+{
+    transactions txs
+    {
+        {
+            1,
+            { { point{}, script{ "[0042]" }, witness{ "[0000000000000000000000000000000000000000000000000000000000000000]" }, max_uint32 } },
+            { { 5000000000, script{ "dup hash160 [0000000000000000000000000000000000000000] equalverify checksig" } } },
+            0
+        }
+    };
+
+    for (size_t spend = 0; spend < spends; ++spend)
+    {
+        txs.emplace_back(
+            2,
+            inputs
+            {
+                { point{ sha256_hash(to_little_endian(spend)), 0 }, script{}, witness{ "[304402] [03bc88]" }, 7 },
+                { point{ sha256_hash(to_big_endian(spend)), 1 }, script{}, witness{ "[3045] [02] [aabbccdd]" }, 8 }
+            },
+            outputs
+            {
+                { 42, script{ "0 [1111111111111111111111111111111111111111]" } },
+                { 24, script{ "1 [2222222222222222222222222222222222222222222222222222222222222222]" } }
+            },
+            static_cast<uint32_t>(spend));
+    }
+
+    return { header{}, std::move(txs) };
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__default__invalid)
+{
+    const block_view instance{};
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__truncated__invalid)
+{
+    const data_slice truncated{ block100k_data.begin(), std::prev(block100k_data.end()) };
+    const block_view instance{ truncated };
+    BOOST_REQUIRE(!instance.is_valid());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__overstated_count__invalid)
+{
+    // Header and a count of 999,999 transactions (fe3f420f00), without any.
+    auto data = header{}.to_data();
+    const auto count = base16_chunk("fe3f420f00");
+    data.insert(data.end(), count.begin(), count.end());
+
+    const block_view instance{ data };
+    BOOST_REQUIRE(!instance.is_valid());
+    BOOST_REQUIRE_EQUAL(instance.transaction_count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__block100k__expected)
+{
+    const block expected{ block100k_data, true };
+    const block_view instance{ block100k_data };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE(instance.header() == expected.header());
+    BOOST_REQUIRE_EQUAL(instance.hash(), expected.hash());
+    BOOST_REQUIRE_EQUAL(instance.data().size(), block100k_data.size());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), expected.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), expected.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(instance.transaction_count(), expected.transactions_ptr()->size());
+    BOOST_REQUIRE(instance.transaction_at(0).is_coinbase());
+    BOOST_REQUIRE(!instance.transaction_at(1).is_coinbase());
+    BOOST_REQUIRE(instance.to_block(true) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__constructor__retained__expected)
+{
+    const auto data = to_shared<data_chunk>(to_chunk(block100k_data));
+    const block_view instance{ data };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.data().data() == data->data());
+    BOOST_REQUIRE(instance.header() == block(*data, true).header());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__transaction_hashes__block100k__merkle_root)
+{
+    const block_view instance{ block100k_data };
+    auto hashes = instance.transaction_hashes(false);
+    BOOST_REQUIRE_EQUAL(hashes.size(), instance.transaction_count());
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(true), hashes);
+    BOOST_REQUIRE_EQUAL(sha256::merkle_root(std::move(hashes)), instance.header().merkle_root());
+}
+
+BOOST_AUTO_TEST_CASE(block_view__transaction_at__block100k__expected_puts)
+{
+    const block expected{ block100k_data, true };
+    const block_view instance{ block100k_data };
+    const auto& txs = *expected.transactions_ptr();
+
+    for (size_t tx = 0; tx < txs.size(); ++tx)
+    {
+        const auto& expected_tx = *txs[tx];
+        const auto view = instance.transaction_at(tx);
+        BOOST_REQUIRE_EQUAL(view.version(), expected_tx.version());
+        BOOST_REQUIRE_EQUAL(view.locktime(), expected_tx.locktime());
+        BOOST_REQUIRE_EQUAL(view.hash(false), expected_tx.hash(false));
+        BOOST_REQUIRE_EQUAL(view.serialized_size(false), expected_tx.serialized_size(false));
+        BOOST_REQUIRE_EQUAL(view.input_count(), expected_tx.inputs_ptr()->size());
+        BOOST_REQUIRE_EQUAL(view.output_count(), expected_tx.outputs_ptr()->size());
+        BOOST_REQUIRE(view.to_transaction(true) == expected_tx);
+
+        for (size_t index = 0; index < view.input_count(); ++index)
+        {
+            const auto& input = *(*expected_tx.inputs_ptr())[index];
+            const auto in = view.input_at(index);
+            BOOST_REQUIRE(in.point() == input.point());
+            BOOST_REQUIRE_EQUAL(in.sequence(), input.sequence());
+            BOOST_REQUIRE_EQUAL(in.script().to_chunk(), input.script().to_data(false));
+            BOOST_REQUIRE_EQUAL(in.witness_count(), zero);
+        }
+
+        for (size_t index = 0; index < view.output_count(); ++index)
+        {
+            const auto& output = *(*expected_tx.outputs_ptr())[index];
+            const auto out = view.output_at(index);
+            BOOST_REQUIRE_EQUAL(out.value(), output.value());
+            BOOST_REQUIRE_EQUAL(out.script().to_chunk(), output.script().to_data(false));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_view__transaction_hashes__segregated__expected)
+{
+    const auto expected = segregated_block(5);
+    const auto data = expected.to_data(true);
+    const block_view instance{ data };
+    BOOST_REQUIRE(instance.is_valid());
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(true), expected.serialized_size(true));
+    BOOST_REQUIRE_EQUAL(instance.serialized_size(false), expected.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(false), expected.transaction_hashes(false));
+    BOOST_REQUIRE_EQUAL(instance.transaction_hashes(true), expected.transaction_hashes(true));
+    BOOST_REQUIRE_EQUAL(instance.transaction_at(0).hash(true), null_hash);
+    BOOST_REQUIRE(instance.to_block(true) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(block_view__transaction_at__segregated__expected_witnesses)
+{
+    const auto expected = segregated_block(1);
+    const auto data = expected.to_data(true);
+    const block_view instance{ data };
+    BOOST_REQUIRE(instance.is_valid());
+
+    const auto view = instance.transaction_at(1);
+    const auto& tx = *(*expected.transactions_ptr())[1];
+    BOOST_REQUIRE(view.is_segregated());
+    BOOST_REQUIRE_EQUAL(view.hash(false), tx.hash(false));
+    BOOST_REQUIRE_EQUAL(view.hash(true), tx.hash(true));
+    BOOST_REQUIRE_EQUAL(view.serialized_size(false), tx.serialized_size(false));
+    BOOST_REQUIRE_EQUAL(view.serialized_size(true), tx.serialized_size(true));
+
+    for (size_t index = 0; index < view.input_count(); ++index)
+    {
+        const auto& stack = (*tx.inputs_ptr())[index]->witness().stack();
+        const auto in = view.input_at(index);
+        BOOST_REQUIRE_EQUAL(in.witness_count(), stack.size());
+
+        for (size_t element = 0; element < stack.size(); ++element)
+        {
+            BOOST_REQUIRE_EQUAL(in.witness_at(element).to_chunk(), *stack[element]);
+        }
+    }
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Approximates a full (~2MB) segregated block served or reindexed from store.
+BOOST_AUTO_TEST_CASE(block_view__parse__two_megabytes__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t rounds = 20;
+    const auto data = segregated_block(10'000).to_data(true);
+
+    auto start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        const block instance{ data, true };
+        BOOST_REQUIRE(instance.is_valid());
+    }
+
+    const auto object_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        const block_view instance{ data };
+        BOOST_REQUIRE(instance.is_valid());
+    }
+
+    const auto view_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    std::cout << "block bytes : " << data.size() << std::endl
+        << "rounds      : " << rounds << std::endl
+        << "block       : " << object_time << "us" << std::endl
+        << "block_view  : " << view_time << "us" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -56,4 +56,228 @@ BOOST_AUTO_TEST_CASE(chain_state__work_required_retarget__overflow_patch_enabled
     BOOST_REQUIRE_EQUAL(work, settings.proof_of_work_limit);
 }
 
+// Header states rolled forward from a parent versus states computed from raw
+// data windows maintained (as in chain_state::map) by the test.
+class rolling_chain
+{
+public:
+    static constexpr uint32_t forks = chain::forks::difficult |
+        chain::forks::retarget | chain::forks::bip34_activations;
+
+    rolling_chain(const settings& settings)
+      : settings_(settings)
+    {
+        values_.height = 1;
+        values_.bits.self = settings.proof_of_work_limit;
+        values_.bits.ordered.push_back(settings.proof_of_work_limit);
+        values_.version.self = version(1);
+        values_.version.ordered.push_back(version(0));
+        values_.timestamp.self = timestamp(1);
+        values_.timestamp.retarget = timestamp(0);
+        values_.timestamp.ordered.push_back(timestamp(0));
+        rolled_ = std::make_shared<chain::chain_state>(
+            chain::chain_state::data{ values_ }, checkpoints_, forks, 0,
+            settings_);
+    }
+
+    // Versions rise from one to four, with unsigned and bip9 versions.
+    static uint32_t version(size_t height)
+    {
+        if (is_zero(height % 97u))
+            return 0x20000000;
+
+        if (is_zero(height % 89u))
+            return max_uint32;
+
+        return narrow_cast<uint32_t>(add1((height / 700u) % 4u));
+    }
+
+    // Timestamps are not monotonic.
+    static uint32_t timestamp(size_t height)
+    {
+        return narrow_cast<uint32_t>(1231006505u + height * 600u +
+            (height * 7919u) % 7200u);
+    }
+
+    const chain::chain_state& rolled() const
+    {
+        return *rolled_;
+    }
+
+    chain::chain_state::ptr computed() const
+    {
+        return std::make_shared<chain::chain_state>(
+            chain::chain_state::data{ values_ }, checkpoints_, forks, 0,
+            settings_);
+    }
+
+    chain::header header(size_t height, const hash_digest& previous) const
+    {
+        return { version(height), previous, {}, timestamp(height),
+            settings_.proof_of_work_limit, 0 };
+    }
+
+    // Advance the rolled state by one header.
+    void roll()
+    {
+        const auto height = add1(rolled_->height());
+        rolled_ = std::make_shared<chain::chain_state>(*rolled_,
+            header(height, rolled_->hash()), settings_);
+    }
+
+    // Advance the data windows by one header (mirrors roll).
+    void promote()
+    {
+        const auto height = add1(values_.height);
+        const auto interval = settings_.retargeting_interval();
+        values_.version.ordered.push_back(values_.version.self);
+        values_.timestamp.ordered.push_back(values_.timestamp.self);
+
+        if (values_.version.ordered.size() > settings_.activation_sample)
+            values_.version.ordered.pop_front();
+
+        if (values_.timestamp.ordered.size() > chain::median_time_past_interval)
+            values_.timestamp.ordered.pop_front();
+
+        if (is_zero(sub1(height) % interval))
+            values_.timestamp.retarget = values_.timestamp.self;
+
+        values_.height = height;
+        values_.version.self = version(height);
+        values_.timestamp.self = timestamp(height);
+        values_.hash = header(height, values_.hash).hash();
+
+        if (height == settings_.bip9_bit0_active_checkpoint.height())
+            values_.bip9_bit0_hash = values_.hash;
+
+        if (height == settings_.bip9_bit1_active_checkpoint.height())
+            values_.bip9_bit1_hash = values_.hash;
+    }
+
+private:
+    const settings& settings_;
+    const chain::checkpoints checkpoints_{};
+    chain::chain_state::data values_{};
+    chain::chain_state::ptr rolled_{};
+};
+
+BOOST_AUTO_TEST_CASE(chain_state__header_constructor__5000_headers__expected_rolled_values)
+{
+    const settings settings(chain::selection::mainnet);
+    rolling_chain chain(settings);
+
+    for (size_t height = 2; height <= 5000u; ++height)
+    {
+        chain.roll();
+        chain.promote();
+        const auto& rolled = chain.rolled();
+        const auto computed = chain.computed();
+        BOOST_REQUIRE_EQUAL(rolled.height(), height);
+        BOOST_REQUIRE_EQUAL(rolled.hash(), computed->hash());
+        BOOST_REQUIRE_EQUAL(rolled.median_time_past(), computed->median_time_past());
+        BOOST_REQUIRE_EQUAL(rolled.minimum_block_version(), computed->minimum_block_version());
+        BOOST_REQUIRE_EQUAL(rolled.forks(), computed->forks());
+        BOOST_REQUIRE_EQUAL(rolled.work_required(), computed->work_required());
+    }
+
+    // The version sample activates bip34 and bip66 (but not bip65) rules.
+    const auto forks = chain.rolled().forks();
+    BOOST_REQUIRE(chain::script::is_enabled(forks, chain::forks::bip34_rule));
+    BOOST_REQUIRE(chain::script::is_enabled(forks, chain::forks::bip66_rule));
+    BOOST_REQUIRE(!chain::script::is_enabled(forks, chain::forks::bip65_rule));
+}
+
+// Mainnet block 692261 spends a v1 witness output in violation of bip341.
+// github.com/bitcoin/bitcoin/pull/23536
+static const chain::checkpoint taproot_exception
+{
+    "0000000000000000000f14c35b2d841e986ab5441de8c585d5ffe55ea1e395ad", 692261
+};
+
+chain::chain_state::ptr get_taproot_state(const settings& settings,
+    const hash_digest& hash, size_t height)
+{
+    constexpr uint32_t forks = chain::forks::difficult |
+        chain::forks::retarget | chain::forks::bip9_bit1_group |
+        chain::forks::taproot_group;
+
+    chain::chain_state::data values{};
+    values.hash = hash;
+    values.height = height;
+    values.bits.self = settings.proof_of_work_limit;
+    values.bits.ordered.push_back(settings.proof_of_work_limit);
+    values.version.self = settings.bip65_version;
+    values.version.ordered.push_back(settings.bip65_version);
+    values.timestamp.self = 1626109434u;
+    values.timestamp.retarget = 1626109434u;
+    values.timestamp.ordered.push_back(1626109434u);
+    values.bip9_bit1_hash = settings.bip9_bit1_active_checkpoint.hash();
+    return std::make_shared<chain::chain_state>(std::move(values),
+        chain::checkpoints{}, forks, 0, settings);
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__forks__mainnet_taproot_exception__taproot_not_active)
+{
+    const settings settings(chain::selection::mainnet);
+    const auto state = get_taproot_state(settings, taproot_exception.hash(),
+        taproot_exception.height());
+    const auto forks = state->forks();
+    BOOST_REQUIRE(chain::script::is_enabled(forks, chain::forks::bip141_rule));
+    BOOST_REQUIRE(!chain::script::is_enabled(forks, chain::forks::bip341_rule));
+    BOOST_REQUIRE(!chain::script::is_enabled(forks, chain::forks::bip342_rule));
+}
+
+BOOST_AUTO_TEST_CASE(chain_state__forks__mainnet_taproot_exception_next_height__taproot_active)
+{
+    const settings settings(chain::selection::mainnet);
+    const auto state = get_taproot_state(settings, null_hash,
+        add1(taproot_exception.height()));
+    const auto forks = state->forks();
+    BOOST_REQUIRE(chain::script::is_enabled(forks, chain::forks::bip141_rule));
+    BOOST_REQUIRE(chain::script::is_enabled(forks, chain::forks::bip341_rule));
+    BOOST_REQUIRE(chain::script::is_enabled(forks, chain::forks::bip342_rule));
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Approximates headers-first chain state promotion to the tip.
+BOOST_AUTO_TEST_CASE(chain_state__header_constructor__1m_headers__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 1'000'000;
+    const settings settings(chain::selection::mainnet);
+
+    rolling_chain rolled(settings);
+    auto start = steady_clock::now();
+    for (size_t height = 2; height <= count; ++height)
+        rolled.roll();
+
+    const auto rolled_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    // Prior cost, with version and timestamp samples rescanned per header.
+    rolling_chain computed(settings);
+    chain::chain_state::ptr state{};
+    start = steady_clock::now();
+    for (size_t height = 2; height <= count; ++height)
+    {
+        computed.promote();
+        state = computed.computed();
+    }
+
+    const auto computed_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_REQUIRE_EQUAL(rolled.rolled().hash(), state->hash());
+    BOOST_REQUIRE_EQUAL(rolled.rolled().median_time_past(), state->median_time_past());
+    BOOST_REQUIRE_EQUAL(rolled.rolled().forks(), state->forks());
+    std::cout << "headers        : " << count << std::endl
+        << "rolled         : " << rolled_time << "us" << std::endl
+        << "rolled/second  : " << (count * 1'000'000u) /
+            std::max<uint64_t>(one, rolled_time) << std::endl
+        << "recomputed     : " << computed_time << "us" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -253,6 +253,15 @@ static_assert(compact::compress(compact::expand(regtest)) == regtest);
 static_assert(compact::expand(compact::compress(uint256_t(0))) == uint256_t(0));
 static_assert(compact::expand(compact::compress(uint256_t(42))) == uint256_t(42));
 
+// expand<limbs256>
+
+static_assert(compact::expand<limbs256>(0x1d00ffff) == limbs256{ base16_hash("00000000ffff0000000000000000000000000000000000000000000000000000") });
+static_assert(compact::expand<limbs256>(0x1b0404cb) == limbs256{ base16_hash("00000000000404cb000000000000000000000000000000000000000000000000") });
+static_assert(compact::expand<limbs256>(0x03000001) == limbs256{ 1 });
+static_assert(compact::expand<limbs256>(0x01003456) == limbs256{});
+static_assert(compact::expand<limbs256>(factory(-3, true, 0x007fffff)) == limbs256{});
+static_assert(compact::expand<limbs256>(factory(29, false, 0x007fffff)) == limbs256{ base16_hash("7fffff0000000000000000000000000000000000000000000000000000000000") });
+
 // Satoshi: for any exponent [0x00..0x000000ff] and mantissa [0x000000..0x007fffff].
 //bool overflow =
 //(
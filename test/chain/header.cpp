@@ -50,6 +50,12 @@ public:
         return header::is_invalid_proof_of_work(proof_of_work_limit, scrypt);
     }
 
+    bool is_invalid_proof_of_work(uint32_t proof_of_work_limit,
+        const hash_digest& work_hash) const
+    {
+        return header::is_invalid_proof_of_work(proof_of_work_limit, work_hash);
+    }
+
     bool is_invalid_timestamp(uint32_t timestamp_limit_seconds) const
     {
         return header::is_invalid_timestamp(timestamp_limit_seconds);
@@ -237,12 +243,159 @@ BOOST_AUTO_TEST_CASE(header__difficulty__genesis_block__expected)
     BOOST_REQUIRE_EQUAL(block.header().difficulty(), 0x0000000100010001);
 }
 
+BOOST_AUTO_TEST_CASE(header__difficulty__bits__uint256_t_expected)
+{
+    // Difficulty is computed with limbs256, uint256_t is the reference.
+    constexpr std_array<uint32_t, 6> values
+    {
+        0x1d00ffff, 0x1b0404cb, 0x170331db, 0x207fffff, 0x03000001, 0x01003456
+    };
+
+    for (const auto value: values)
+    {
+        const auto target = compact::expand(value);
+        const uint256_t expected = is_zero(target) ? target :
+            uint256_t(uint256_t(~target / (target + one)) + one);
+        BOOST_REQUIRE_EQUAL((header{ 0, null_hash, null_hash, 0, value, 0 }.difficulty()), expected);
+    }
+}
+
 // validation (public)
 // ----------------------------------------------------------------------------
 
 // check
 // accept
 
+BOOST_AUTO_TEST_CASE(header__check__scrypt_headers__first_failure)
+{
+    const settings settings(selection::mainnet);
+    const header valid
+    {
+        536870912,
+        base16_hash("313ced849aafeff324073bb2bd31ecdcc365ed215a34e827bb797ad33d158542"),
+        base16_hash("5163359dde15eb3f49cbd0926981f065ef1405fc9d4cece8818662b3b65f5dc6"),
+        1535119178,
+        436332170,
+        2135224651
+    };
+
+    const header invalid
+    {
+        536870912,
+        base16_hash("abababababababababababababababababababababababababababababababab"),
+        base16_hash("5163359dde15eb3f49cbd0926981f065ef1405fc9d4cece8818662b3b65f5dc6"),
+        1535119178,
+        436332170,
+        2135224651
+    };
+
+    // Count exercises vectorized and normal form scrypt.
+    std::vector<header> headers(21, valid);
+    BOOST_REQUIRE_EQUAL(header::check(headers, settings.timestamp_limit_seconds,
+        settings.proof_of_work_limit, true), error::success);
+
+    // Not a valid sha256 proof of work.
+    BOOST_REQUIRE_EQUAL(header::check(headers, settings.timestamp_limit_seconds,
+        settings.proof_of_work_limit, false), error::invalid_proof_of_work);
+
+    headers[17] = invalid;
+    BOOST_REQUIRE_EQUAL(header::check(headers, settings.timestamp_limit_seconds,
+        settings.proof_of_work_limit, true), error::invalid_proof_of_work);
+
+    BOOST_REQUIRE_EQUAL(header::check({}, settings.timestamp_limit_seconds,
+        settings.proof_of_work_limit, true), error::success);
+}
+
+// Mainnet blocks 0..2 (genesis previous is null_hash).
+static const header::cptr block0 = std::make_shared<const header>(
+    1,
+    null_hash,
+    base16_hash("4a5e1e4baab89f3a32518a88c31bc87f618f76673e2cc77ab2127b7afdeda33b"),
+    1231006505,
+    0x1d00ffff,
+    2083236893);
+static const header::cptr block1 = std::make_shared<const header>(
+    1,
+    base16_hash("000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f"),
+    base16_hash("0e3e2357e806b6cdb1f70b54c3a3a17b6714ee1f0e68bebb44a74b1efd512098"),
+    1231469665,
+    0x1d00ffff,
+    2573394689);
+static const header::cptr block2 = std::make_shared<const header>(
+    1,
+    base16_hash("00000000839a8e6886ab5951d76f411475428afc90947ee320161bbf18eb6048"),
+    base16_hash("9b0fc92260312ce44e74ef369f5c66bbb85848f2eddd5a7a1cde251e54ccfdd5"),
+    1231469744,
+    0x1d00ffff,
+    1639830024);
+
+BOOST_AUTO_TEST_CASE(header__to_hashes__headers__expected)
+{
+    // Counts exercise vectorized and normal form hashing.
+    for (const size_t count: { 0u, 1u, 3u, 8u, 9u, 17u })
+    {
+        header_cptrs headers{};
+        for (size_t index = 0; index < count; ++index)
+            headers.push_back(std::make_shared<const header>(1, hash1, hash2,
+                possible_narrow_cast<uint32_t>(index), 0x1d00ffff, 42));
+
+        const auto hashes = header::to_hashes(headers);
+        BOOST_REQUIRE_EQUAL(hashes.size(), count);
+
+        for (size_t index = 0; index < count; ++index)
+            BOOST_REQUIRE_EQUAL(hashes[index], headers[index]->hash());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(header__check__linked_headers__success)
+{
+    const settings settings(selection::mainnet);
+    BOOST_REQUIRE_EQUAL(header::check({ block0, block1, block2 }, null_hash,
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit),
+        error::success);
+
+    BOOST_REQUIRE_EQUAL(header::check({ block1, block2 }, block0->hash(),
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit),
+        error::success);
+
+    BOOST_REQUIRE_EQUAL(header::check(header_cptrs{}, null_hash,
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit),
+        error::success);
+}
+
+BOOST_AUTO_TEST_CASE(header__check__unlinked_headers__orphan_header)
+{
+    const settings settings(selection::mainnet);
+    BOOST_REQUIRE_EQUAL(header::check({ block1, block2 }, null_hash,
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit),
+        error::orphan_header);
+
+    BOOST_REQUIRE_EQUAL(header::check({ block0, block2 }, null_hash,
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit),
+        error::orphan_header);
+}
+
+BOOST_AUTO_TEST_CASE(header__check__linked_invalid_proof_of_work__invalid_proof_of_work)
+{
+    const settings settings(selection::mainnet);
+    const auto invalid = std::make_shared<const header>(block1->version(),
+        block1->previous_block_hash(), block1->merkle_root(),
+        block1->timestamp(), block1->bits(), add1(block1->nonce()));
+
+    BOOST_REQUIRE_EQUAL(header::check({ block0, invalid, block2 }, null_hash,
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit),
+        error::invalid_proof_of_work);
+}
+
+BOOST_AUTO_TEST_CASE(header__check__linked_scrypt__invalid_proof_of_work)
+{
+    // Mainnet sha256 proofs of work are not valid scrypt proofs of work.
+    const settings settings(selection::mainnet);
+    BOOST_REQUIRE_EQUAL(header::check({ block0, block1, block2 }, null_hash,
+        settings.timestamp_limit_seconds, settings.proof_of_work_limit, true),
+        error::invalid_proof_of_work);
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -371,4 +524,153 @@ BOOST_AUTO_TEST_CASE(header__json__conversions__expected)
     BOOST_REQUIRE(json::value_to<chain::header>(value) == instance);
 }
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+BOOST_AUTO_TEST_CASE(header__is_invalid_proof_of_work__1m_headers__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 1'000'000;
+    const settings settings(selection::mainnet);
+    const auto limit = settings.proof_of_work_limit;
+
+    // Hashes both above and below a range of targets.
+    constexpr std_array<uint32_t, 4> targets{ 0x1d00ffff, 0x1b0404cb, 0x1a05db8b, 0x170331db };
+    std::vector<accessor> headers{};
+    headers.reserve(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto value = possible_narrow_cast<uint32_t>(index);
+        auto hash = sha256_hash(to_little_endian(value));
+        std::fill_n(std::prev(hash.end(), index % 12), index % 12, 0x00);
+        headers.emplace_back(1, null_hash, hash, value, targets[index % 4], value);
+    }
+
+    const auto uint256_invalid = [&](const accessor& header)
+    {
+        const auto target = compact::expand(header.bits());
+        return is_zero(target) || target > compact::expand(limit) ||
+            to_uintx(header.merkle_root()) > target;
+    };
+
+    const auto limbs_invalid = [&](const accessor& header)
+    {
+        return header.is_invalid_proof_of_work(limit, header.merkle_root());
+    };
+
+    size_t uint256_count{};
+    auto start = steady_clock::now();
+    for (const auto& header: headers)
+        uint256_count += to_int<size_t>(uint256_invalid(header));
+
+    const auto uint256_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    size_t limbs_count{};
+    start = steady_clock::now();
+    for (const auto& header: headers)
+        limbs_count += to_int<size_t>(limbs_invalid(header));
+
+    const auto limbs_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    std::cout << "headers  : " << count << std::endl
+        << "invalid  : " << limbs_count << std::endl
+        << "uint256_t: " << uint256_time << "us" << std::endl
+        << "limbs256 : " << limbs_time << "us" << std::endl;
+
+    BOOST_REQUIRE_EQUAL(limbs_count, uint256_count);
+}
+
+BOOST_AUTO_TEST_CASE(header__check__800k_header_chain__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 800'000;
+    constexpr size_t message = 2'000;
+    const settings settings(selection::regtest);
+    const auto limit = settings.proof_of_work_limit;
+    const auto timestamp_limit = settings.timestamp_limit_seconds;
+
+    // Synthetic chain mined to the regtest limit (about two tries a header).
+    header_cptrs chain{};
+    chain.reserve(count);
+    auto previous = null_hash;
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto time = possible_narrow_cast<uint32_t>(index);
+        auto next = std::make_shared<const header>(1, previous, null_hash,
+            time, limit, 0);
+
+        while (next->check(timestamp_limit, limit))
+            next = std::make_shared<const header>(1, previous, null_hash,
+                time, limit, add1(next->nonce()));
+
+        previous = next->hash();
+        chain.push_back(next);
+    }
+
+    // Headers-first sync checks one headers message at a time.
+    const auto messages = [&](auto&& checker)
+    {
+        auto link = null_hash;
+        size_t checked{};
+        for (auto it = chain.begin(); it != chain.end();)
+        {
+            const auto end = std::next(it, std::min<ptrdiff_t>(message,
+                std::distance(it, chain.end())));
+            const header_cptrs headers(it, end);
+            if (!checker(headers, link))
+                return checked;
+
+            link = headers.back()->hash();
+            checked += headers.size();
+            it = end;
+        }
+
+        return checked;
+    };
+
+    const auto single = [&](const header_cptrs& headers, const hash_digest& link)
+    {
+        auto last = &link;
+        hash_digest hash{};
+        for (const auto& header: headers)
+        {
+            if (header->previous_block_hash() != *last ||
+                header->check(timestamp_limit, limit))
+                return false;
+
+            hash = header->hash();
+            last = &hash;
+        }
+
+        return true;
+    };
+
+    const auto batch = [&](const header_cptrs& headers, const hash_digest& link)
+    {
+        return !header::check(headers, link, timestamp_limit, limit);
+    };
+
+    auto start = steady_clock::now();
+    const auto single_count = messages(single);
+    const auto single_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto batch_count = messages(batch);
+    const auto batch_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    std::cout << "headers : " << count << std::endl
+        << "single  : " << single_time << "us ("
+        << (count * 1'000'000 / add1(single_time)) << " headers/s)" << std::endl
+        << "batch   : " << batch_time << "us ("
+        << (count * 1'000'000 / add1(batch_time)) << " headers/s)" << std::endl;
+
+    BOOST_REQUIRE_EQUAL(single_count, count);
+    BOOST_REQUIRE_EQUAL(batch_count, count);
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -833,6 +833,23 @@ BOOST_AUTO_TEST_CASE(operation__to_string__nop3_bip112_rule__checksequenceverify
 ////static bool is_conditional(opcode code);
 ////static bool is_relaxed_push(opcode code);
 
+BOOST_AUTO_TEST_CASE(operation__is_success__bip342_codes__expected)
+{
+    size_t count{};
+    for (auto value = 0; value <= max_uint8; ++value)
+        count += (operation::is_success(static_cast<opcode>(value)) ? 1 : 0);
+
+    BOOST_REQUIRE_EQUAL(count, 87u);
+    BOOST_REQUIRE(operation::is_success(opcode::reserved_80));
+    BOOST_REQUIRE(operation::is_success(opcode::op_cat));
+    BOOST_REQUIRE(operation::is_success(opcode::reserved_187));
+    BOOST_REQUIRE(operation::is_success(opcode::reserved_254));
+    BOOST_REQUIRE(!operation::is_success(opcode::op_verif));
+    BOOST_REQUIRE(!operation::is_success(opcode::op_return));
+    BOOST_REQUIRE(!operation::is_success(opcode::reserved_186));
+    BOOST_REQUIRE(!operation::is_success(opcode::reserved_255));
+}
+
 // utilities (member)
 // ----------------------------------------------------------------------------
 
@@ -844,6 +861,7 @@ BOOST_AUTO_TEST_CASE(operation__to_string__nop3_bip112_rule__checksequenceverify
 ////bool is_positive() const;
 ////bool is_invalid() const;
 ////bool is_reserved() const;
+////bool is_success() const;
 ////bool is_conditional() const;
 ////bool is_relaxed_push() const;
 ////bool is_oversized() const;
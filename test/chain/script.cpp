@@ -434,6 +434,148 @@ BOOST_AUTO_TEST_CASE(script__pattern__17_of_17_multisig__non_standard)
     BOOST_REQUIRE(instance.pattern() == chain::script_pattern::non_standard);
 }
 
+// precomputed properties
+// ----------------------------------------------------------------------------
+
+static const std::string script_p2pkh = "dup hash160 [0000000000000000000000000000000000000000] equalverify checksig";
+static const std::string script_p2sh = "hash160 [0000000000000000000000000000000000000000] equal";
+static const std::string script_p2wpkh = "0 [0000000000000000000000000000000000000000]";
+static const std::string script_p2wsh = "0 [0000000000000000000000000000000000000000000000000000000000000000]";
+static const std::string script_p2tr = "1 [0000000000000000000000000000000000000000000000000000000000000000]";
+static const std::string script_sign_key_hash = "[3044] [02aa]";
+
+BOOST_AUTO_TEST_CASE(script__common_pattern__templates__expected)
+{
+    BOOST_REQUIRE(script{ script_p2pkh }.common_pattern() == script_pattern::pay_key_hash);
+    BOOST_REQUIRE(script{ script_p2sh }.common_pattern() == script_pattern::pay_script_hash);
+    BOOST_REQUIRE(script{ script_p2wpkh }.common_pattern() == script_pattern::pay_witness_key_hash);
+    BOOST_REQUIRE(script{ script_p2wsh }.common_pattern() == script_pattern::pay_witness_script_hash);
+    BOOST_REQUIRE(script{ script_p2tr }.common_pattern() == script_pattern::pay_taproot);
+    BOOST_REQUIRE(script{ script_3_of_3_multisig }.common_pattern() == script_pattern::non_standard);
+    BOOST_REQUIRE(script{}.common_pattern() == script_pattern::non_standard);
+}
+
+BOOST_AUTO_TEST_CASE(script__is_push_only__templates__expected)
+{
+    BOOST_REQUIRE(script{}.is_push_only());
+    BOOST_REQUIRE(script{ script_sign_key_hash }.is_push_only());
+    BOOST_REQUIRE(script{ script_p2wpkh }.is_push_only());
+    BOOST_REQUIRE(!script{ script_p2pkh }.is_push_only());
+    BOOST_REQUIRE(!script{ script_return }.is_push_only());
+}
+
+BOOST_AUTO_TEST_CASE(script__is_roller__roll__true)
+{
+    BOOST_REQUIRE(script{ "1 2 1 roll" }.is_roller());
+    BOOST_REQUIRE(!script{ "1 2 1 pick" }.is_roller());
+}
+
+BOOST_AUTO_TEST_CASE(script__sigops__multisig__expected)
+{
+    const script instance{ script_3_of_3_multisig };
+    BOOST_REQUIRE_EQUAL(instance.sigops(true), 3u);
+    BOOST_REQUIRE_EQUAL(instance.sigops(false), multisig_default_sigops);
+    BOOST_REQUIRE_EQUAL(script{ script_p2pkh }.sigops(false), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(script__assign__copy__metadata_copied)
+{
+    script instance{ "1 2 1 roll" };
+    BOOST_REQUIRE(instance.is_roller());
+    instance = script{ script_p2pkh };
+    BOOST_REQUIRE(!instance.is_roller());
+    BOOST_REQUIRE(!instance.is_push_only());
+    BOOST_REQUIRE_EQUAL(instance.sigops(false), 1u);
+    BOOST_REQUIRE(instance.common_pattern() == script_pattern::pay_key_hash);
+}
+
+BOOST_AUTO_TEST_CASE(script__constructor__copy__metadata_copied)
+{
+    const script other{ script_3_of_3_multisig };
+    const script instance{ other };
+    BOOST_REQUIRE_EQUAL(instance.sigops(true), other.sigops(true));
+    BOOST_REQUIRE_EQUAL(instance.sigops(false), other.sigops(false));
+    BOOST_REQUIRE_EQUAL(instance.is_push_only(), other.is_push_only());
+    BOOST_REQUIRE(instance.common_pattern() == other.common_pattern());
+    BOOST_REQUIRE(instance.offset == instance.ops().begin());
+}
+
+BOOST_AUTO_TEST_CASE(script__constructor__move__metadata_moved)
+{
+    script other{ "1 2 1 roll" };
+    const script instance{ std::move(other) };
+    BOOST_REQUIRE(instance.is_roller());
+    BOOST_REQUIRE(!instance.is_push_only());
+    BOOST_REQUIRE(instance.offset == instance.ops().begin());
+}
+
+BOOST_AUTO_TEST_CASE(script__assign__move__metadata_moved)
+{
+    script instance{};
+    BOOST_REQUIRE(instance.is_push_only());
+    instance = script{ script_p2wpkh };
+    BOOST_REQUIRE(instance.is_push_only());
+    BOOST_REQUIRE(instance.common_pattern() == script_pattern::pay_witness_key_hash);
+    BOOST_REQUIRE(instance.offset == instance.ops().begin());
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Parses wire scripts (computing metadata once), copies them into a
+// transaction, and validates it (sigops and connect), as in block validation.
+BOOST_AUTO_TEST_CASE(script__parse_validate__pay_to_script_hash__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 2'000;
+    constexpr size_t rounds = 50;
+
+    // Redeem script evaluation exercises parse, push-only, pattern and sigops.
+    const auto redeem = script{ "1 2 add 3 equal" }.to_data(false);
+    const auto input_data = script{ { { redeem, true } } }.to_data(true);
+    const auto prevout_data = script{ "hash160 [" +
+        encode_base16(bitcoin_short_hash(redeem)) + "] equal" }.to_data(true);
+
+    context state{};
+    state.forks = forks::all_rules;
+    size_t parse_time{};
+    size_t validate_time{};
+    size_t sigops{};
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        auto start = steady_clock::now();
+        chain::inputs ins{};
+        ins.reserve(count);
+        for (size_t index = 0; index < count; ++index)
+        {
+            const auto value = possible_narrow_cast<uint32_t>(index);
+            ins.emplace_back(point{ null_hash, value },
+                script{ input_data, true }, witness{}, max_uint32);
+            ins.back().prevout = to_shared<output>(0,
+                script{ prevout_data, true });
+        }
+
+        const transaction tx{ 1, std::move(ins),
+            { { 0, script{ "return" } } }, 0 };
+
+        parse_time += duration_cast<microseconds>(
+            steady_clock::now() - start).count();
+
+        start = steady_clock::now();
+        sigops += tx.signature_operations(true, true);
+        BOOST_REQUIRE_EQUAL(tx.connect(state), error::transaction_success);
+        validate_time += duration_cast<microseconds>(
+            steady_clock::now() - start).count();
+    }
+
+    std::cout << "inputs   : " << count << " x " << rounds << std::endl
+        << "parse    : " << parse_time << "us" << std::endl
+        << "validate : " << validate_time << "us (" << sigops << ")"
+        << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 // Data-driven tests.
 // -----------------------------------------------------------------------------
 
@@ -1013,6 +1155,76 @@ BOOST_AUTO_TEST_CASE(script__verify__bip143_no_find_and_delete_tx__success)
     BOOST_REQUIRE_EQUAL(tx.connect({ forks::bip16_rule | forks::bip141_rule }, 0), error::op_check_sig_verify4);
 }
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Evaluates the valid script corpus, reporting heap allocations and time per
+// connect (input and prevout script pair).
+BOOST_AUTO_TEST_CASE(script__connect__valid_corpus__allocations)
+{
+    using namespace std::chrono;
+    constexpr size_t rounds = 100;
+    std::vector<transaction_accessor> txs{};
+
+    for (const auto& test: valid_context_free_scripts)
+        txs.push_back(test_tx(test));
+
+    for (const auto& test: valid_multisig_scripts)
+        txs.push_back(test_tx(test));
+
+    size_t failures{};
+    const auto start_allocations = test::allocations();
+    const auto start = steady_clock::now();
+
+    for (size_t round = 0; round < rounds; ++round)
+        for (const auto& tx: txs)
+            failures += to_int(tx.connect({ forks::all_rules }, 0) != error::script_success);
+
+    const auto elapsed = duration_cast<nanoseconds>(
+        steady_clock::now() - start).count();
+    const auto allocated = test::allocations() - start_allocations;
+    const auto connects = rounds * txs.size();
+
+    std::cout << "connects    : " << connects << std::endl
+        << "failures    : " << failures / rounds << std::endl
+        << "allocations : " << allocated / connects << "/connect" << std::endl
+        << "time        : " << elapsed / connects << "ns/connect" << std::endl;
+}
+
+// Replays the script corpus through the instrumented interpreter, reporting
+// the per-opcode profile (counts, time, sighashes, stack and allocations).
+BOOST_AUTO_TEST_CASE(script__connect__corpus_replay__profile)
+{
+    using profiled = interpreter<contiguous_stack, profiler>;
+    std::vector<transaction_accessor> txs{};
+
+    for (const auto& test: valid_context_free_scripts)
+        txs.push_back(test_tx(test));
+
+    for (const auto& test: invalid_context_free_scripts)
+        txs.push_back(test_tx(test));
+
+    for (const auto& test: valid_multisig_scripts)
+        txs.push_back(test_tx(test));
+
+    for (const auto& test: invalid_multisig_scripts)
+        txs.push_back(test_tx(test));
+
+    profiler::clear();
+    profiler::set_allocation_counter(&test::allocations);
+
+    for (const auto& tx: txs)
+        if (tx.is_valid())
+            profiled::connect({ forks::all_rules }, tx, 0);
+
+    profiler::set_allocation_counter(nullptr);
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE(!is_zero(profile.runs));
+
+    std::cout << json::serialize(json::value_from(profile)) << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 // json
 // ----------------------------------------------------------------------------
 
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "taproot.hpp"
 
 BOOST_AUTO_TEST_SUITE(transaction_tests)
 
@@ -162,6 +163,16 @@ public:
         return transaction::is_unconfirmed_spend(height);
     }
 
+    void initialize_sighash_cache() const
+    {
+        transaction::initialize_sighash_cache();
+    }
+
+    bool is_sighash_cached() const
+    {
+        return transaction::is_sighash_cached();
+    }
+
     bool is_confirmed_double_spend(size_t height) const
     {
         return transaction::is_confirmed_double_spend(height);
@@ -539,6 +550,91 @@ BOOST_AUTO_TEST_CASE(transaction__hash__block320670__success)
     BOOST_REQUIRE_EQUAL(instance.to_data(true), tx4_data);
 }
 
+BOOST_AUTO_TEST_CASE(transaction__hash__segregated__expected)
+{
+    const transaction instance
+    {
+        42,
+        { { point{ tx4_hash, 0 }, script{}, witness{ "[242424]" }, 7 } },
+        { { 15, script{} } },
+        24
+    };
+
+    BOOST_REQUIRE(instance.is_segregated());
+    BOOST_REQUIRE(!instance.is_hashed());
+
+    // Both hashes are computed from one serialization upon first call.
+    BOOST_REQUIRE_EQUAL(instance.hash(false), bitcoin_hash(instance.to_data(false)));
+    BOOST_REQUIRE(instance.is_hashed());
+    BOOST_REQUIRE_EQUAL(instance.hash(true), bitcoin_hash(instance.to_data(true)));
+    BOOST_REQUIRE_NE(instance.hash(false), instance.hash(true));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__unsegregated__nominal)
+{
+    const transaction instance(tx4_data, true);
+    BOOST_REQUIRE(!instance.is_segregated());
+    BOOST_REQUIRE_EQUAL(instance.hash(true), tx4_hash);
+    BOOST_REQUIRE_EQUAL(instance.hash(false), tx4_hash);
+    BOOST_REQUIRE(instance.is_hashed());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__assigned__reset)
+{
+    transaction instance;
+    const auto default_hash = instance.hash(false);
+    BOOST_REQUIRE(instance.is_hashed());
+    instance = transaction(tx4_data, true);
+    BOOST_REQUIRE(!instance.is_hashed());
+    BOOST_REQUIRE_NE(instance.hash(false), default_hash);
+    BOOST_REQUIRE_EQUAL(instance.hash(false), tx4_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__copied__not_cached)
+{
+    const transaction instance(tx4_data, true);
+    BOOST_REQUIRE_EQUAL(instance.hash(false), tx4_hash);
+    const transaction copy{ instance };
+    BOOST_REQUIRE(!copy.is_hashed());
+    BOOST_REQUIRE_EQUAL(copy.hash(false), tx4_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__hash__concurrent_first_calls__expected)
+{
+    const transaction instance
+    {
+        42,
+        { { point{ tx4_hash, 0 }, script{}, witness{ "[242424]" }, 7 } },
+        { { 15, script{} } },
+        24
+    };
+
+    const auto nominal = bitcoin_hash(instance.to_data(false));
+    const auto witness = bitcoin_hash(instance.to_data(true));
+    std::vector<hash_digest> nominals(8);
+    std::vector<hash_digest> witnesses(8);
+    std::vector<std::thread> threads{};
+
+    for (size_t index = 0; index < nominals.size(); ++index)
+    {
+        threads.emplace_back([&, index]()
+        {
+            nominals.at(index) = instance.hash(false);
+            witnesses.at(index) = instance.hash(true);
+        });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    BOOST_REQUIRE(instance.is_hashed());
+    for (size_t index = 0; index < nominals.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(nominals.at(index), nominal);
+        BOOST_REQUIRE_EQUAL(witnesses.at(index), witness);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(transaction__is_coinbase__empty__false)
 {
     transaction instance;
@@ -706,6 +802,47 @@ BOOST_AUTO_TEST_CASE(transaction__signature_operations__empty_input_output__zero
 // accept
 // connect
 
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_true_scripts__success)
+{
+    input input0{ point{}, script{ { { opcode::push_positive_1 } } }, witness{}, 0 };
+    input input1{ point{}, script{ { { opcode::push_positive_1 } } }, witness{}, 0 };
+    input0.prevout = to_shared<output>(0, script{});
+    input1.prevout = to_shared<output>(0, script{});
+    const transaction instance{ 0, { input0, input1 }, outputs{}, 0 };
+    const context state{};
+    BOOST_REQUIRE_EQUAL(instance.connect(state), error::transaction_success);
+
+    for (const size_t threads: { 1u, 4u })
+    {
+        boost::asio::thread_pool pool(threads);
+        BOOST_REQUIRE_EQUAL(instance.connect(state, pool), error::transaction_success);
+        pool.join();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__concurrent_failures__lowest_failing_input)
+{
+    input input0{ point{}, script{ { { opcode::push_positive_1 } } }, witness{}, 0 };
+    input input1{ point{}, script{ { { opcode::push_positive_1 } } }, witness{}, 0 };
+    input input2{ point{}, script{ { { opcode::push_size_0 } } }, witness{}, 0 };
+    input input3{ point{}, script{ { { opcode::push_positive_1 } } }, witness{}, 0 };
+    input0.prevout = to_shared<output>(0, script{});
+    input2.prevout = to_shared<output>(0, script{});
+    input3.prevout = to_shared<output>(0, script{});
+
+    // input1 is missing its prevout, input2 leaves a false stack.
+    const transaction instance{ 0, { input0, input1, input2, input3 }, outputs{}, 0 };
+    const context state{};
+    BOOST_REQUIRE_EQUAL(instance.connect(state), error::missing_previous_output);
+
+    for (const size_t threads: { 1u, 4u })
+    {
+        boost::asio::thread_pool pool(threads);
+        BOOST_REQUIRE_EQUAL(instance.connect(state, pool), error::missing_previous_output);
+        pool.join();
+    }
+}
+
 // validation (protected)
 // ----------------------------------------------------------------------------
 
@@ -1449,6 +1586,400 @@ BOOST_AUTO_TEST_CASE(transaction__signature_hash__all__expected)
     BOOST_REQUIRE_EQUAL(sighash, expected);
 }
 
+// Legacy (unversioned) transaction of distinct spendable inputs and outputs.
+template <typename Transaction = transaction>
+static Transaction get_legacy(size_t inputs, size_t outputs)
+{
+    chain::inputs ins{};
+    ins.reserve(inputs);
+    for (size_t index = 0; index < inputs; ++index)
+    {
+        const auto value = possible_narrow_cast<uint32_t>(index);
+        ins.emplace_back(point{ sha256_hash(to_little_endian(value)), value },
+            script{ { { opcode::push_positive_1 } } }, witness{}, add1(value));
+        ins.back().prevout = to_shared<output>(0, script{});
+    }
+
+    chain::outputs outs{};
+    outs.reserve(outputs);
+    for (size_t index = 0; index < outputs; ++index)
+        outs.emplace_back(index, script{ { { opcode::push_positive_1 } } });
+
+    return Transaction{ 1, std::move(ins), std::move(outs), 0 };
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__cached_unversioned__expected)
+{
+    // Copy does not copy the signature hash cache.
+    const auto instance = get_legacy<accessor>(40, 20);
+    const transaction uncached{ instance };
+    instance.initialize_sighash_cache();
+    BOOST_REQUIRE(instance.is_sighash_cached());
+
+    const script sub(std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" });
+    const auto& inputs = *instance.inputs_ptr();
+    const auto& uncached_inputs = *uncached.inputs_ptr();
+
+    // Flags 0x04 and 0x84 are masked to all (and anyone) but are committed.
+    for (const uint8_t flags: { 0x01, 0x02, 0x03, 0x04, 0x81, 0x82, 0x83, 0x84 })
+    {
+        for (size_t index = 0; index < inputs.size(); ++index)
+        {
+            const auto input = std::next(inputs.begin(), index);
+            const auto expected = std::next(uncached_inputs.begin(), index);
+            BOOST_REQUIRE_EQUAL(
+                instance.signature_hash(input, sub, 0, flags, script_version::unversioned, false),
+                uncached.signature_hash(expected, sub, 0, flags, script_version::unversioned, false));
+        }
+    }
+
+    // hash_single beyond outputs is one_hash.
+    const auto last = std::prev(inputs.end());
+    BOOST_REQUIRE_EQUAL(instance.signature_hash(last, sub, 0, coverage::hash_single, script_version::unversioned, false), one_hash);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__cached_unversioned_single_high_index__expected)
+{
+    // Single hashes preceding null outputs in runs of 64, and the output
+    // count varint widens at 253 (index 252).
+    const auto instance = get_legacy<accessor>(260, 256);
+    const transaction uncached{ instance };
+    instance.initialize_sighash_cache();
+    BOOST_REQUIRE(instance.is_sighash_cached());
+
+    const script sub(std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" });
+    const auto& inputs = *instance.inputs_ptr();
+    const auto& uncached_inputs = *uncached.inputs_ptr();
+
+    for (const uint8_t flags: { 0x03, 0x83 })
+    {
+        for (const size_t index: { 63, 64, 65, 127, 128, 129, 191, 192, 251, 252, 253, 255 })
+        {
+            const auto input = std::next(inputs.begin(), index);
+            const auto expected = std::next(uncached_inputs.begin(), index);
+            const auto hash = instance.signature_hash(input, sub, 0, flags, script_version::unversioned, false);
+            BOOST_REQUIRE_EQUAL(hash, uncached.signature_hash(expected, sub, 0, flags, script_version::unversioned, false));
+            BOOST_REQUIRE_NE(hash, one_hash);
+        }
+
+        // hash_single beyond outputs is one_hash.
+        for (const size_t index: { 256, 259 })
+        {
+            const auto input = std::next(inputs.begin(), index);
+            BOOST_REQUIRE_EQUAL(instance.signature_hash(input, sub, 0, flags, script_version::unversioned, false), one_hash);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__initialize_sighash_cache__few_legacy_inputs__not_cached)
+{
+    const auto instance = get_legacy<accessor>(15, 20);
+    instance.initialize_sighash_cache();
+    BOOST_REQUIRE(!instance.is_sighash_cached());
+}
+
+BOOST_AUTO_TEST_CASE(transaction__connect__many_legacy_inputs__cache_released)
+{
+    const auto instance = get_legacy<accessor>(40, 20);
+    instance.initialize_sighash_cache();
+    BOOST_REQUIRE(instance.is_sighash_cached());
+    BOOST_REQUIRE_EQUAL(instance.connect(context{}), error::transaction_success);
+    BOOST_REQUIRE(!instance.is_sighash_cached());
+}
+
+// Taproot (segregated) transaction of distinct inputs spending taproot outputs.
+template <typename Transaction = transaction>
+static Transaction get_taproot(size_t inputs, size_t outputs)
+{
+    const script prevout{ script::to_pay_witness_pattern(1, null_hash) };
+
+    chain::inputs ins{};
+    ins.reserve(inputs);
+    for (size_t index = 0; index < inputs; ++index)
+    {
+        const auto value = possible_narrow_cast<uint32_t>(index);
+        ins.emplace_back(point{ sha256_hash(to_little_endian(value)), value },
+            script{}, witness{ "[" + encode_base16(data_chunk(64, 0x42)) + "]" },
+            add1(value));
+        ins.back().prevout = to_shared<output>(add1(index), prevout);
+    }
+
+    chain::outputs outs{};
+    outs.reserve(outputs);
+    for (size_t index = 0; index < outputs; ++index)
+        outs.emplace_back(index, script{ { { opcode::push_positive_1 } } });
+
+    return Transaction{ 2, std::move(ins), std::move(outs), 0 };
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__cached_taproot__expected)
+{
+    // Connect populates the taproot hash cache, copy does not copy it.
+    const auto instance = get_taproot(10, 5);
+    const transaction uncached{ instance };
+    BOOST_REQUIRE(instance.is_segregated());
+    instance.connect(context{});
+
+    const auto leaf = sha256_hash(data_chunk{ 0x51 });
+    const auto annex = base16_chunk("50deadbeef");
+    const auto& inputs = *instance.inputs_ptr();
+    const auto& uncached_inputs = *uncached.inputs_ptr();
+
+    for (const uint8_t flags: { 0x00, 0x01, 0x02, 0x03, 0x81, 0x82, 0x83 })
+    {
+        for (size_t index = 0; index < 5; ++index)
+        {
+            hash_digest cached{};
+            hash_digest expected{};
+            const auto input = std::next(inputs.begin(), index);
+            const auto other = std::next(uncached_inputs.begin(), index);
+            BOOST_REQUIRE(instance.signature_hash(cached, input, flags, annex, &leaf, 1));
+            BOOST_REQUIRE(uncached.signature_hash(expected, other, flags, annex, &leaf, 1));
+            BOOST_REQUIRE_EQUAL(cached, expected);
+            BOOST_REQUIRE(instance.signature_hash(cached, input, flags, {}, nullptr, max_uint32));
+            BOOST_REQUIRE(uncached.signature_hash(expected, other, flags, {}, nullptr, max_uint32));
+            BOOST_REQUIRE_EQUAL(cached, expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__initialize_sighash_cache__many_taproot_inputs__not_cached)
+{
+    const auto instance = get_taproot<accessor>(40, 20);
+    BOOST_REQUIRE(instance.is_segregated());
+    instance.initialize_sighash_cache();
+    BOOST_REQUIRE(!instance.is_sighash_cached());
+}
+
+static data_chunk decode_chunk(const std::string& text)
+{
+    data_chunk out{};
+    BOOST_REQUIRE(decode_base16(out, text));
+    return out;
+}
+
+static hash_digest decode_digest(const std::string& text)
+{
+    hash_digest out{};
+    BOOST_REQUIRE(decode_base16(out, text));
+    return out;
+}
+
+// bip341 keyPathSpending unsigned transaction, with prevouts populated.
+static transaction get_key_path_transaction()
+{
+    const transaction tx{ decode_chunk(key_path_unsigned_tx), true };
+    BOOST_REQUIRE(tx.is_valid());
+
+    const auto& ins = *tx.inputs_ptr();
+    BOOST_REQUIRE_EQUAL(ins.size(), key_path_prevouts.size());
+    for (size_t index = 0; index < ins.size(); ++index)
+    {
+        const auto& prevout = key_path_prevouts[index];
+        ins[index]->prevout = to_shared<output>(prevout.value,
+            script{ decode_chunk(prevout.script), false });
+    }
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__bip341_key_path__expected)
+{
+    // Connect populates the taproot hash cache, copy does not copy it.
+    const auto instance = get_key_path_transaction();
+    const transaction uncached{ instance };
+    instance.connect(context{});
+
+    const auto& inputs = *instance.inputs_ptr();
+    const auto& uncached_inputs = *uncached.inputs_ptr();
+    for (const auto& test: key_path_tests)
+    {
+        // The vector message (sigMsg) is prefixed by epoch (zero) and flags.
+        const auto message = decode_chunk(test.message);
+        const auto expected = decode_digest(test.sighash);
+        BOOST_REQUIRE_EQUAL(message[0], 0x00);
+        BOOST_REQUIRE_EQUAL(message[1], test.flags);
+        BOOST_REQUIRE_EQUAL(tagged_hash("TapSighash", message), expected);
+
+        hash_digest cached{};
+        hash_digest computed{};
+        const auto input = std::next(inputs.begin(), test.index);
+        const auto other = std::next(uncached_inputs.begin(), test.index);
+        BOOST_REQUIRE(instance.signature_hash(cached, input, test.flags, {}, nullptr, max_uint32));
+        BOOST_REQUIRE(uncached.signature_hash(computed, other, test.flags, {}, nullptr, max_uint32));
+        BOOST_REQUIRE_EQUAL(cached, expected);
+        BOOST_REQUIRE_EQUAL(computed, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__bip341_key_path_signatures__expected)
+{
+    const auto instance = get_key_path_transaction();
+    const auto& inputs = *instance.inputs_ptr();
+    for (const auto& test: key_path_tests)
+    {
+        // Internal key and tweak (bip341).
+        ec_compressed point{};
+        BOOST_REQUIRE(secret_to_public(point, decode_digest(test.internal_secret)));
+        const auto internal = to_array<ec_xonly_size>({ std::next(point.begin()), point.end() });
+        BOOST_REQUIRE_EQUAL(internal, decode_digest(test.internal_key));
+
+        auto preimage = to_chunk(internal);
+        const auto root = decode_chunk(test.merkle_root);
+        preimage.insert(preimage.end(), root.begin(), root.end());
+        const auto tweak = tagged_hash("TapTweak", preimage);
+        BOOST_REQUIRE_EQUAL(tweak, decode_digest(test.tweak));
+
+        // Output key (prevout witness program) is the tweaked internal key.
+        auto odd = false;
+        ec_xonly tweaked{};
+        const auto& prevout = inputs[test.index]->prevout->script();
+        BOOST_REQUIRE(schnorr::tweak(tweaked, odd, internal, tweak));
+        BOOST_REQUIRE(schnorr::verify_tweak(tweaked, odd, internal, tweak));
+        BOOST_REQUIRE_EQUAL(to_chunk(tweaked), prevout.ops().back().data());
+
+        // Signature (zero auxiliary randomness) and flags as witness element.
+        hash_digest sighash{};
+        ec_signature signature{};
+        const auto input = std::next(inputs.begin(), test.index);
+        BOOST_REQUIRE(instance.signature_hash(sighash, input, test.flags, {}, nullptr, max_uint32));
+        BOOST_REQUIRE(schnorr::sign(signature, decode_digest(test.tweaked_secret), sighash, null_hash));
+        BOOST_REQUIRE(schnorr::verify_signature(tweaked, sighash, signature));
+
+        auto endorsement = to_chunk(signature);
+        if (test.flags != coverage::hash_default)
+            endorsement.push_back(test.flags);
+
+        BOOST_REQUIRE_EQUAL(endorsement, decode_chunk(test.witness));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__taproot_invalid__false)
+{
+    hash_digest sighash{};
+    const auto instance = get_taproot(3, 2);
+    const auto first = instance.inputs_ptr()->begin();
+    const auto last = std::prev(instance.inputs_ptr()->end());
+
+    // Undefined flags are invalid (bip341).
+    BOOST_REQUIRE(!instance.signature_hash(sighash, first, 0x04, {}, nullptr, max_uint32));
+    BOOST_REQUIRE(!instance.signature_hash(sighash, first, 0x80, {}, nullptr, max_uint32));
+    BOOST_REQUIRE(!instance.signature_hash(sighash, first, 0x84, {}, nullptr, max_uint32));
+
+    // hash_single without corresponding output is invalid (bip341).
+    BOOST_REQUIRE(instance.signature_hash(sighash, first, coverage::hash_single, {}, nullptr, max_uint32));
+    BOOST_REQUIRE(!instance.signature_hash(sighash, last, coverage::hash_single, {}, nullptr, max_uint32));
+
+    // All prevouts are committed, so must be populated.
+    (*last)->prevout.reset();
+    BOOST_REQUIRE(!instance.signature_hash(sighash, first, coverage::hash_all, {}, nullptr, max_uint32));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__taproot_anyone_can_pay__excludes_other_inputs)
+{
+    hash_digest all{};
+    hash_digest anyone{};
+    hash_digest changed_all{};
+    hash_digest changed_anyone{};
+    const auto instance = get_taproot(2, 2);
+    const auto first = instance.inputs_ptr()->begin();
+    const auto last = std::prev(instance.inputs_ptr()->end());
+
+    BOOST_REQUIRE(instance.signature_hash(all, first, coverage::hash_default, {}, nullptr, max_uint32));
+    BOOST_REQUIRE(instance.signature_hash(anyone, first, coverage::all_anyone_can_pay, {}, nullptr, max_uint32));
+
+    // The amount of each prevout is committed unless anyone_can_pay.
+    (*last)->prevout = to_shared<output>(42, (*last)->prevout->script());
+    BOOST_REQUIRE(instance.signature_hash(changed_all, first, coverage::hash_default, {}, nullptr, max_uint32));
+    BOOST_REQUIRE(instance.signature_hash(changed_anyone, first, coverage::all_anyone_can_pay, {}, nullptr, max_uint32));
+    BOOST_REQUIRE_NE(all, changed_all);
+    BOOST_REQUIRE_EQUAL(anyone, changed_anyone);
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__legacy_inputs__timed)
+{
+    using namespace std::chrono;
+    const script sub(std::string{ "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig" });
+
+    for (const size_t count: { 1000u, 5000u, 10000u })
+    {
+        const auto instance = get_legacy(count, count);
+        const transaction uncached{ instance };
+        const auto& inputs = *instance.inputs_ptr();
+        const auto& uncached_inputs = *uncached.inputs_ptr();
+        hash_digest cached_hash{};
+        hash_digest uncached_hash{};
+
+        auto start = steady_clock::now();
+        for (auto input = uncached_inputs.begin(); input != uncached_inputs.end(); ++input)
+            uncached_hash = uncached.signature_hash(input, sub, 0,
+                coverage::hash_all, script_version::unversioned, false);
+
+        const auto uncached_time = duration_cast<microseconds>(
+            steady_clock::now() - start).count();
+
+        // Includes cache construction.
+        start = steady_clock::now();
+        BOOST_REQUIRE_EQUAL(instance.connect(context{}), error::transaction_success);
+        for (auto input = inputs.begin(); input != inputs.end(); ++input)
+            cached_hash = instance.signature_hash(input, sub, 0,
+                coverage::hash_all, script_version::unversioned, false);
+
+        const auto cached_time = duration_cast<microseconds>(
+            steady_clock::now() - start).count();
+
+        std::cout << "inputs   : " << count << std::endl
+            << "uncached : " << uncached_time << "us" << std::endl
+            << "cached   : " << cached_time << "us" << std::endl;
+
+        BOOST_REQUIRE_EQUAL(cached_hash, uncached_hash);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(transaction__signature_hash__taproot_inputs__timed)
+{
+    using namespace std::chrono;
+
+    // Uncached hashing is quadratic in the number of inputs.
+    for (const size_t count: { 100u, 1000u, 2000u })
+    {
+        const auto instance = get_taproot(count, count);
+        const transaction uncached{ instance };
+        const auto& inputs = *instance.inputs_ptr();
+        const auto& uncached_inputs = *uncached.inputs_ptr();
+        hash_digest cached_hash{};
+        hash_digest uncached_hash{};
+
+        auto start = steady_clock::now();
+        for (auto input = uncached_inputs.begin(); input != uncached_inputs.end(); ++input)
+            BOOST_REQUIRE(uncached.signature_hash(uncached_hash, input,
+                coverage::hash_default, {}, nullptr, max_uint32));
+
+        const auto uncached_time = duration_cast<microseconds>(
+            steady_clock::now() - start).count();
+
+        // Includes cache construction.
+        start = steady_clock::now();
+        instance.connect(context{});
+        for (auto input = inputs.begin(); input != inputs.end(); ++input)
+            BOOST_REQUIRE(instance.signature_hash(cached_hash, input,
+                coverage::hash_default, {}, nullptr, max_uint32));
+
+        const auto cached_time = duration_cast<microseconds>(
+            steady_clock::now() - start).count();
+
+        std::cout << "inputs   : " << count << std::endl
+            << "uncached : " << uncached_time << "us" << std::endl
+            << "cached   : " << cached_time << "us" << std::endl;
+
+        BOOST_REQUIRE_EQUAL(cached_hash, uncached_hash);
+    }
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 // json
 // ----------------------------------------------------------------------------
 
@@ -145,6 +145,46 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signature__negative__expected)
     BOOST_REQUIRE(!verify_signature(compressed2, sighash2, signature));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__empty__true)
+{
+    boost::asio::thread_pool pool(4);
+    BOOST_REQUIRE(verify_signatures({}, pool));
+    pool.join();
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__positive__expected)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+    const ec_signature_check check{ to_chunk(compressed2), sighash2, signature };
+    const ec_signature_checks checks{ check, check, check };
+
+    for (const size_t threads: { 1u, 4u })
+    {
+        boost::asio::thread_pool pool(threads);
+        BOOST_REQUIRE(verify_signatures(checks, pool));
+        pool.join();
+    }
+}
+
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__negative__expected)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature2, false));
+    const ec_signature_check check{ to_chunk(compressed2), sighash2, signature };
+    auto checks = ec_signature_checks{ check, check, check };
+
+    // Invalidate one check.
+    checks[1].signature[10] = 110;
+
+    for (const size_t threads: { 1u, 4u })
+    {
+        boost::asio::thread_pool pool(threads);
+        BOOST_REQUIRE(!verify_signatures(checks, pool));
+        pool.join();
+    }
+}
+
 // addition
 
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__positive__expected)
@@ -177,6 +217,37 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__negative__expected)
     BOOST_REQUIRE(!ec_add(public1, secret_two));
 }
 
+BOOST_AUTO_TEST_CASE(elliptic_curve__ec_add__list__expected)
+{
+    const ec_secret secret{ { 1, 2, 3 } };
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    // n - 1 added to G * (n - 1) is the point at infinity (failed sum).
+    const auto negative = base16_array("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140");
+    ec_compressed negative_point;
+    BOOST_REQUIRE(secret_to_public(negative_point, negative));
+
+    ec_secret one{ { 0 } };
+    one[31] = 1;
+    const secret_list scalars{ { { 3, 2, 1 } }, one, secret };
+
+    compressed_list sums;
+    BOOST_REQUIRE(ec_add(sums, point, scalars));
+    BOOST_REQUIRE_EQUAL(sums.size(), scalars.size());
+
+    for (size_t index = 0; index < scalars.size(); ++index)
+    {
+        auto expected = point;
+        BOOST_REQUIRE(ec_add(expected, scalars[index]));
+        BOOST_REQUIRE_EQUAL(sums[index], expected);
+    }
+
+    BOOST_REQUIRE(ec_add(sums, negative_point, { one }));
+    BOOST_REQUIRE_EQUAL(sums.front(), null_ec_compressed);
+    BOOST_REQUIRE(!ec_add(sums, null_ec_compressed, scalars));
+}
+
 BOOST_AUTO_TEST_CASE(elliptic_curve__ec_sum__expected)
 {
     const compressed_list points
@@ -211,4 +282,58 @@ BOOST_AUTO_TEST_CASE(elliptic_curve__ec_multiply__expected)
     BOOST_REQUIRE_EQUAL(public1, public2);
 }
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Approximates the signature load of a full mainnet block (~4k p2pkh spends).
+BOOST_AUTO_TEST_CASE(elliptic_curve__verify_signatures__block_load__inline_versus_batched)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 4'000;
+
+    ec_signature_checks checks(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        ec_compressed point;
+        auto& check = checks[index];
+        const auto secret = sha256_hash(to_little_endian(index));
+        check.hash = bitcoin_hash(to_little_endian(index));
+        BOOST_REQUIRE(secret_to_public(point, secret));
+        BOOST_REQUIRE(sign(check.signature, secret, check.hash));
+        check.point = to_chunk(point);
+    }
+
+    auto start = steady_clock::now();
+    for (const auto& check: checks)
+    {
+        BOOST_REQUIRE(verify_signature(check.point, check.hash,
+            check.signature));
+    }
+
+    const auto inline_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    // Posted tasks are never run by an empty pool, so the caller does all.
+    boost::asio::thread_pool caller(0);
+    start = steady_clock::now();
+    BOOST_REQUIRE(verify_signatures(checks, caller));
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    boost::asio::thread_pool pool{};
+    start = steady_clock::now();
+    BOOST_REQUIRE(verify_signatures(checks, pool));
+    const auto concurrent_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    caller.join();
+    pool.join();
+
+    std::cout << "signatures  : " << count << std::endl
+        << "inline      : " << inline_time << "us" << std::endl
+        << "batched     : " << batched_time << "us" << std::endl
+        << "concurrent  : " << concurrent_time << "us" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,256 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(signature_cache_tests)
+
+const ec_compressed point1 = base16_array("03bc88a1bd6ebac38e9a9ed58eda735352ad10650e235499b7318315cc26c9b55b");
+const hash_digest hash1 = base16_hash("ed8f9b40c2d349c8a7e58cebe79faa25c21b6bb85b874901f72a1b3f1ad0a67f");
+const der_signature der_signature1 = base16_chunk("3045022100bc494fbd09a8e77d8266e2abdea9aef08b9e71b451c7d8de9f63cda33a62437802206b93edd6af7c659db42c579eb34a3a4cb60c28b5a6bc86fd5266d42f6b8bb67d");
+
+BOOST_AUTO_TEST_CASE(signature_cache__construct__capacity__expected)
+{
+    const signature_cache cache{ 42 };
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 42u);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__instance__default_capacity)
+{
+    BOOST_REQUIRE_EQUAL(signature_cache::instance().capacity(),
+        signature_cache::default_capacity);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__empty__false_miss)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    const signature_cache cache{ 42 };
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__inserted__true_hit)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 42 };
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(cache.contains(point1, hash1, signature));
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__distinct_hash__false)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 42 };
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(!cache.contains(point1, null_hash, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__distinct_signature__false)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 42 };
+    cache.insert(point1, hash1, signature);
+    signature[10] = 110;
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__contains__distinct_point__false)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 42 };
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(!cache.contains(ec_compressed_generator, hash1, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__zero_capacity__not_cached)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 0 };
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__oversized_point__not_cached)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    const data_chunk point(add1(ec_uncompressed_size), 0x42);
+    signature_cache cache{ 42 };
+    cache.insert(point, hash1, signature);
+    BOOST_REQUIRE(!cache.contains(point, hash1, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__insert__over_capacity__bounded)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    // Single entry capacity retains only the most recent insert.
+    signature_cache cache{ 1 };
+    cache.insert(point1, hash1, signature);
+    cache.insert(point1, null_hash, signature);
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+    BOOST_REQUIRE(cache.contains(point1, null_hash, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__clear__inserted__reset)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 42 };
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(cache.contains(point1, hash1, signature));
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 0u);
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+}
+
+BOOST_AUTO_TEST_CASE(signature_cache__resize__inserted__cleared_capacity)
+{
+    ec_signature signature;
+    BOOST_REQUIRE(parse_signature(signature, der_signature1, false));
+
+    signature_cache cache{ 42 };
+    cache.insert(point1, hash1, signature);
+    cache.resize(7);
+    BOOST_REQUIRE_EQUAL(cache.capacity(), 7u);
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(cache.contains(point1, hash1, signature));
+
+    cache.resize(0);
+    cache.insert(point1, hash1, signature);
+    BOOST_REQUIRE(!cache.contains(point1, hash1, signature));
+}
+
+// Block of single input p2pkh spends, each by a distinct key.
+static chain::block get_block(size_t count)
+{
+    using namespace chain;
+    constexpr uint64_t value = 42;
+    transactions txs{};
+    txs.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        ec_compressed key{};
+        const auto secret = sha256_hash(to_little_endian(index));
+        BOOST_REQUIRE(secret_to_public(key, secret));
+        const script prevout{ script::to_pay_key_hash_pattern(bitcoin_short_hash(key)) };
+        const point outpoint{ sha256_hash(to_big_endian(index)), 0 };
+        const outputs outs{ { sub1(value), script{ "return" } } };
+
+        endorsement endorsed{};
+        const transaction unsigned_tx{ 1, { { outpoint, script{}, witness{}, max_uint32 } }, outs, 0 };
+        BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed, secret, prevout, 0, value, coverage::hash_all, script_version::unversioned, false));
+
+        const script input_script{ { { endorsed, true }, { to_chunk(key), true } } };
+        txs.emplace_back(1, inputs{ { outpoint, input_script, witness{}, max_uint32 } }, outs, 0);
+        txs.back().inputs_ptr()->front()->prevout = to_shared<output>(value, prevout);
+    }
+
+    return { header{}, std::move(txs) };
+}
+
+// Connect verifies (miss) and caches a signature, then finds it (hit).
+BOOST_AUTO_TEST_CASE(signature_cache__connect__verify_then_hit__counters_incremented)
+{
+    chain::context state{};
+    state.forks = chain::forks::all_rules;
+    const auto block = get_block(1);
+    const auto& tx = *block.transactions_ptr()->front();
+    auto& cache = signature_cache::instance();
+
+    cache.clear();
+    BOOST_REQUIRE_EQUAL(tx.connect(state), error::transaction_success);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+
+    BOOST_REQUIRE_EQUAL(tx.connect(state), error::transaction_success);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 1u);
+    cache.clear();
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Block connect where 90% of txs were validated by the tx pool (cached).
+BOOST_AUTO_TEST_CASE(signature_cache__block_connect__ninety_percent_prevalidated__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 4'000;
+    constexpr size_t pooled = count * 9 / 10;
+
+    chain::context state{};
+    state.forks = chain::forks::all_rules;
+    const auto block = get_block(count);
+    const auto& txs = *block.transactions_ptr();
+    auto& cache = signature_cache::instance();
+
+    cache.clear();
+    auto start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(block.connect(state), error::block_success);
+    const auto uncached_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    // Pool validation caches verified signatures.
+    cache.clear();
+    for (size_t index = 0; index < pooled; ++index)
+    {
+        BOOST_REQUIRE_EQUAL(txs[index]->connect(state), error::transaction_success);
+    }
+
+    start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(block.connect(state), error::block_success);
+    const auto cached_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    std::cout << "transactions: " << count << std::endl
+        << "prevalidated: " << pooled << std::endl
+        << "uncached    : " << uncached_time << "us" << std::endl
+        << "cached      : " << cached_time << "us" << std::endl
+        << "hits        : " << cache.hits() << std::endl
+        << "misses      : " << cache.misses() << std::endl;
+
+    cache.clear();
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,4 +25,64 @@ BOOST_AUTO_TEST_CASE(memory_test)
     BOOST_REQUIRE(true);
 }
 
+// to_allocated
+
+// Counts allocations passed through to the heap.
+class counting_resource
+  : public std::pmr::memory_resource
+{
+public:
+    size_t allocations{};
+
+private:
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* ptr, size_t bytes, size_t align) override
+    {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const memory_resource& other) const NOEXCEPT override
+    {
+        return &other == this;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(memory__to_allocated__null_arena__expected)
+{
+    const auto pointer = to_allocated<std::string>(nullptr, 3u, 'a');
+    BOOST_REQUIRE(pointer);
+    BOOST_REQUIRE_EQUAL(*pointer, "aaa");
+    BOOST_REQUIRE_EQUAL(pointer.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(memory__to_allocated__arena__single_allocation)
+{
+    counting_resource arena{};
+    {
+        const auto pointer = to_allocated<data_chunk>(&arena, 3u, 0x2a);
+        BOOST_REQUIRE(pointer);
+        BOOST_REQUIRE_EQUAL(*pointer, (data_chunk{ 0x2a, 0x2a, 0x2a }));
+
+        // Object and control block are allocated together from the arena.
+        // The vector buffer is allocated from the default (heap) allocator.
+        BOOST_REQUIRE_EQUAL(arena.allocations, 1u);
+    }
+
+    BOOST_REQUIRE_EQUAL(arena.allocations, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(memory__to_allocated__const_type__expected)
+{
+    counting_resource arena{};
+    const std::shared_ptr<const uint32_t> pointer =
+        to_allocated<const uint32_t>(&arena, 42u);
+    BOOST_REQUIRE_EQUAL(*pointer, 42u);
+    BOOST_REQUIRE_EQUAL(arena.allocations, 1u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
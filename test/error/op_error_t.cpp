@@ -839,4 +839,85 @@ BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_sequence_verify5__true_exected_m
     BOOST_REQUIRE_EQUAL(ec.message(), "op_check_sequence_verify5");
 }
 
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_schnorr_sig1__true_exected_message)
+{
+    constexpr auto value = error::op_check_schnorr_sig1;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_schnorr_sig1");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_schnorr_sig2__true_exected_message)
+{
+    constexpr auto value = error::op_check_schnorr_sig2;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_schnorr_sig2");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_schnorr_sig3__true_exected_message)
+{
+    constexpr auto value = error::op_check_schnorr_sig3;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_schnorr_sig3");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_schnorr_sig4__true_exected_message)
+{
+    constexpr auto value = error::op_check_schnorr_sig4;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_schnorr_sig4");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_schnorr_sig5__true_exected_message)
+{
+    constexpr auto value = error::op_check_schnorr_sig5;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_schnorr_sig5");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_schnorr_sig_verify__true_exected_message)
+{
+    constexpr auto value = error::op_check_schnorr_sig_verify;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_schnorr_sig_verify");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_sig_add1__true_exected_message)
+{
+    constexpr auto value = error::op_check_sig_add1;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_sig_add1");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_sig_add2__true_exected_message)
+{
+    constexpr auto value = error::op_check_sig_add2;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_sig_add2");
+}
+
+BOOST_AUTO_TEST_CASE(op_error_t__code__op_check_multisig_tapscript__true_exected_message)
+{
+    constexpr auto value = error::op_check_multisig_tapscript;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "op_check_multisig_tapscript");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -166,4 +166,31 @@ BOOST_AUTO_TEST_CASE(script_error_t__code__stack_false__true_exected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "stack false");
 }
 
+BOOST_AUTO_TEST_CASE(script_error_t__code__invalid_control_block__true_exected_message)
+{
+    constexpr auto value = error::invalid_control_block;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "invalid control block");
+}
+
+BOOST_AUTO_TEST_CASE(script_error_t__code__invalid_taproot_commitment__true_exected_message)
+{
+    constexpr auto value = error::invalid_taproot_commitment;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "invalid taproot commitment");
+}
+
+BOOST_AUTO_TEST_CASE(script_error_t__code__invalid_schnorr_signature__true_exected_message)
+{
+    constexpr auto value = error::invalid_schnorr_signature;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "invalid schnorr signature");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -246,6 +246,28 @@ BOOST_AUTO_TEST_CASE(accumulator__bitcoin_short__null_one__expected)
     BOOST_CHECK_EQUAL(bitcoin_short_chunk(to_chunk(null_hash)), to_chunk(expected));
 }
 
+BOOST_AUTO_TEST_CASE(accumulator__bitcoin_short_hashes__mixed_sizes__expected)
+{
+    // Mixed sizes span one and two sha256 blocks (e.g. pubkeys and scripts).
+    std_vector<data_chunk> chunks{};
+    for (size_t index = 0; index < 42; ++index)
+        chunks.emplace_back(index % 3 == 0 ? 65u : 33u, narrow_cast<uint8_t>(index));
+
+    const std_vector<data_slice> set(chunks.begin(), chunks.end());
+    const auto hashes = bitcoin_short_hashes(set);
+    BOOST_REQUIRE_EQUAL(hashes.size(), chunks.size());
+
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index], bitcoin_short_hash(chunks[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(accumulator__bitcoin_short_hashes__empty__empty)
+{
+    BOOST_REQUIRE(bitcoin_short_hashes({}).empty());
+}
+
 // bitcoin_hash
 // ----------------------------------------------------------------------------
 
@@ -316,6 +338,24 @@ BOOST_AUTO_TEST_CASE(functions__merkle_root__eight_expected)
     BOOST_REQUIRE_EQUAL(merkle_root({ { 0 }, { 1 }, { 2 }, { 3 } }), expected);
 }
 
+// tagged_hash
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(functions__tagged_hash__empty__expected)
+{
+    const auto tag = sha256_hash(std::string{ "TapTweak" });
+    const auto expected = sha256_hash(splice(tag, tag));
+    BOOST_REQUIRE_EQUAL(tagged_hash("TapTweak", {}), expected);
+    BOOST_REQUIRE_EQUAL(tagged_hash("TapTweak", {}), base16_array("8aa4229474ab0100b2d6f0687f031d1fc9d8eef92a042ad97d279bff456b15e4"));
+}
+
+BOOST_AUTO_TEST_CASE(functions__tagged_hash__tapleaf__expected)
+{
+    // Leaf version 0xc0, script [op_true] (compact size prefixed).
+    constexpr auto leaf = base16_array("c00151");
+    BOOST_REQUIRE_EQUAL(tagged_hash("TapLeaf", leaf), base16_array("a85b2107f791b26a84e7586c28cec7cb61202ed3d01944d832500f363782d675"));
+}
+
 // scrypt_hash
 // ----------------------------------------------------------------------------
 
@@ -325,6 +365,18 @@ BOOST_AUTO_TEST_CASE(functions__scrypt__empty__expected)
     BOOST_REQUIRE_EQUAL(scrypt_hash(""), expected);
 }
 
+BOOST_AUTO_TEST_CASE(functions__scrypt_hashes__set__expected)
+{
+    const std_vector<data_slice> set{ "", "a", "abc", "", "a", "abc", "", "a", "abc" };
+    const auto hashes = scrypt_hashes(set);
+    BOOST_REQUIRE_EQUAL(hashes.size(), set.size());
+
+    for (size_t index = 0; index < set.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index], scrypt_hash(set[index]));
+    }
+}
+
 // non-cryptographic hash functions
 // ----------------------------------------------------------------------------
 
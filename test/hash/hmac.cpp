@@ -69,4 +69,50 @@ BOOST_AUTO_TEST_CASE(hmac__sha512__test_vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(hmac__sha512__codes__expected)
+{
+    for (const auto& test: hmac_sha512_tests)
+    {
+        const std_vector<data_slice> set{ test.data, test.data };
+        const auto hashes = hmac<sha512>::codes(set, test.key);
+        BOOST_REQUIRE_EQUAL(hashes.size(), 2u);
+        BOOST_REQUIRE_EQUAL(hashes.front(), test.expected);
+        BOOST_REQUIRE_EQUAL(hashes.back(), test.expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hmac__sha512__codes_one_key__expected)
+{
+    // Parent chain code and child derivation data (bip32 sizes).
+    const auto key = base16_array("000102030405060708090a0b0c0d0e0f000102030405060708090a0b0c0d0e0f");
+    std_vector<data_chunk> data{};
+    for (uint8_t child = 0; child < 10; ++child)
+        data.emplace_back(37u, child);
+
+    const std_vector<data_slice> set(data.begin(), data.end());
+    const auto hashes = hmac<sha512>::codes(set, key);
+    BOOST_REQUIRE_EQUAL(hashes.size(), data.size());
+
+    for (size_t child = 0; child < data.size(); ++child)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[child], hmac<sha512>::code(data[child], key));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hmac__sha512__midstates__expected)
+{
+    for (const auto& test: hmac_sha512_tests)
+    {
+        sha512::state_t inner{};
+        sha512::state_t outer{};
+        hmac<sha512>::midstates(inner, outer, test.key);
+
+        accumulator<sha512> inner_hash{ inner, one };
+        inner_hash.write(test.data);
+        accumulator<sha512> outer_hash{ outer, one };
+        outer_hash.write(inner_hash.flush());
+        BOOST_REQUIRE_EQUAL(outer_hash.flush(), test.expected);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
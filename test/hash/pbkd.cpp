@@ -21,6 +21,43 @@
 
 BOOST_AUTO_TEST_SUITE(pbkd_tests)
 
+BOOST_AUTO_TEST_CASE(pbkd__sha512__keys__expected)
+{
+    // Passwords count exercises all lane widths and the normal form remainder.
+    std_vector<std::string> sentences{};
+    for (size_t index = 0; index < 19; ++index)
+        sentences.push_back("sentence " + std::to_string(index));
+
+    const std_vector<data_slice> passwords(sentences.begin(), sentences.end());
+    const std_vector<data_slice> salts(passwords.size(), "mnemonic");
+
+    for (const size_t count: { 0u, 1u, 2u, 100u })
+    {
+        const auto keys = pbkd<sha512>::keys<long_hash_size>(passwords, salts, count);
+        BOOST_REQUIRE_EQUAL(keys.size(), passwords.size());
+
+        for (size_t index = 0; index < keys.size(); ++index)
+        {
+            BOOST_REQUIRE_EQUAL(keys[index], pbkd<sha512>::key<long_hash_size>(
+                passwords[index], salts[index], count));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(pbkd__sha256__keys_multiple_blocks__expected)
+{
+    const std_vector<data_slice> passwords{ "a", "bb", "ccc", "dddd", "eeeee" };
+    const std_vector<data_slice> salts{ "1", "22", "333", "4444", "55555" };
+    const auto keys = pbkd<sha256>::keys<80>(passwords, salts, 10);
+    BOOST_REQUIRE_EQUAL(keys.size(), passwords.size());
+
+    for (size_t index = 0; index < keys.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(keys[index], pbkd<sha256>::key<80>(passwords[index],
+            salts[index], 10));
+    }
+}
+
 // 8+ seconds of test here.
 #if defined(HAVE_SLOW_TESTS)
 
@@ -72,6 +109,16 @@ BOOST_AUTO_TEST_CASE(pbkd__sha512__test_vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(pbkd__sha512__keys_test_vectors__expected)
+{
+    for (const auto& test: pbkd_sha512_tests)
+    {
+        const auto keys = pbkd<sha512>::keys<long_hash_size>({ test.passphrase },
+            { test.salt }, test.count);
+        BOOST_REQUIRE_EQUAL(keys.front(), test.expected);
+    }
+}
+
 #endif // HAVE_SLOW_TESTS
 
 BOOST_AUTO_TEST_SUITE_END()
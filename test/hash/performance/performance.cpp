@@ -91,6 +91,334 @@ BOOST_AUTO_TEST_CASE(performance__sha256a_vect__merkle)
     BOOST_CHECK(complete);
 }
 
+// Exposes single lane width merkle hashing, for comparison of lane widths.
+// Widths unsupported by the CPU fall through to the normal form.
+class merkle_lanes
+  : public sha_algorithm<256, false, true, true>
+{
+public:
+    template <typename xWord>
+    static digest_t root(digests_t&& digests) NOEXCEPT
+    {
+        while (!is_one(digests.size()))
+        {
+            if (is_odd(digests.size()))
+                digests.push_back(digests.back());
+
+            auto offset = zero;
+            if constexpr (!is_same_type<xWord, word_t>)
+            {
+                const auto data = digests.front().data();
+                const auto size = digests.size() * array_count<digest_t>;
+                auto iblocks = iblocks_t{ size, data };
+                auto idigests = idigests_t{ to_half(size), data };
+                const auto blocks = iblocks.size();
+                merkle_hash_v_<xWord>(idigests, iblocks);
+                offset = blocks - iblocks.size();
+            }
+
+            merkle_hash_(digests, offset);
+        }
+
+        return digests.front();
+    }
+};
+
+template <typename xWord, size_t Leaves>
+static void merkle_root_lanes(const std::string& name)
+{
+    using namespace std::chrono;
+    constexpr size_t rounds = 100;
+    merkle_lanes::digests_t leaves(Leaves);
+    for (size_t leaf = 0; leaf < Leaves; ++leaf)
+        leaves[leaf] = sha256_hash(to_little_endian(leaf));
+
+    const auto expected = sha_algorithm<256, false, false, true>::merkle_root(
+        merkle_lanes::digests_t{ leaves });
+
+    uint64_t time = zero;
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        auto digests = leaves;
+        const auto start = steady_clock::now();
+        const auto root = merkle_lanes::root<xWord>(std::move(digests));
+        time += duration_cast<microseconds>(steady_clock::now() - start).count();
+        BOOST_CHECK_EQUAL(root, expected);
+    }
+
+    std::cout << "leaves : " << Leaves << ", lanes : " << name << ", "
+        << time / rounds << "us" << std::endl;
+}
+
+template <size_t Leaves>
+static void merkle_root_lanes()
+{
+    merkle_root_lanes<uint32_t, Leaves>("1");
+
+    if constexpr (merkle_lanes::have_x128)
+        merkle_root_lanes<xint128_t, Leaves>(have_sse41() ? "4" : "4 (cpu)");
+    if constexpr (merkle_lanes::have_x256)
+        merkle_root_lanes<xint256_t, Leaves>(have_avx2() ? "8" : "8 (cpu)");
+    if constexpr (merkle_lanes::have_x512)
+        merkle_root_lanes<xint512_t, Leaves>(have_avx512() ? "16" : "16 (cpu)");
+}
+
+BOOST_AUTO_TEST_CASE(performance__sha256__merkle_root__lane_widths)
+{
+    merkle_root_lanes<1024>();
+    merkle_root_lanes<4096>();
+    merkle_root_lanes<16384>();
+}
+
+// Approximates txid hashing of a full block (3000 txs of 200-700 bytes).
+BOOST_AUTO_TEST_CASE(performance__sha256__block_txids__streamed_versus_batched)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 3'000;
+    constexpr size_t rounds = 100;
+
+    std_vector<data_chunk> txs{};
+    for (size_t tx = 0; tx < count; ++tx)
+        txs.emplace_back(200u + (tx * 37u) % 500u, static_cast<uint8_t>(tx));
+
+    const sha256::messages_t messages(txs.begin(), txs.end());
+    sha256::digests_t streamed(count);
+    sha256::digests_t batched{};
+
+    auto start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        for (size_t tx = 0; tx < count; ++tx)
+        {
+            hash::sha256x2::copy sink(streamed[tx]);
+            sink.write_bytes(txs[tx]);
+            sink.flush();
+        }
+    }
+
+    const auto streamed_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        batched = sha256::double_hashes(messages);
+
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_CHECK(streamed == batched);
+    std::cout << "blocks   : " << rounds << std::endl
+        << "txs      : " << count << std::endl
+        << "streamed : " << streamed_time << "us" << std::endl
+        << "batched  : " << batched_time << "us" << std::endl;
+}
+
+// Approximates p2pkh/p2wpkh matching of a compressed public key set.
+BOOST_AUTO_TEST_CASE(performance__bitcoin_short_hash__scalar_versus_batched)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 10'000;
+    constexpr size_t rounds = 100;
+
+    std_vector<data_chunk> keys{};
+    for (size_t key = 0; key < count; ++key)
+        keys.emplace_back(33u, static_cast<uint8_t>(key));
+
+    const std_vector<data_slice> set(keys.begin(), keys.end());
+    short_hashes scalar(count);
+    short_hashes batched{};
+
+    auto start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (size_t key = 0; key < count; ++key)
+            scalar[key] = bitcoin_short_hash(keys[key]);
+
+    const auto scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        batched = bitcoin_short_hashes(set);
+
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    // rmd160 stage only (scalar versus lanes).
+    const auto halves = sha256::hashes(set);
+    rmd160::digests_t rmd_scalar(count);
+    rmd160::digests_t rmd_batched{};
+
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (size_t key = 0; key < count; ++key)
+            rmd_scalar[key] = rmd160::hash(halves[key]);
+
+    const auto rmd_scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        rmd_batched = rmd160::hashes(halves);
+
+    const auto rmd_batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_CHECK(scalar == batched);
+    BOOST_CHECK(rmd_scalar == rmd_batched);
+    BOOST_CHECK(rmd_batched == batched);
+    std::cout << "rounds         : " << rounds << std::endl
+        << "keys           : " << count << std::endl
+        << "rmd160 lanes   : " << rmd160::min_lanes << std::endl
+        << "hash160 scalar : " << scalar_time << "us" << std::endl
+        << "hash160 batched: " << batched_time << "us" << std::endl
+        << "rmd160 scalar  : " << rmd_scalar_time << "us" << std::endl
+        << "rmd160 batched : " << rmd_batched_time << "us" << std::endl;
+}
+
+// Approximates bip39 seeding of a mnemonic set (pbkdf2-hmac-sha512 x 2048).
+BOOST_AUTO_TEST_CASE(performance__pbkd_sha512__scalar_versus_batched)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 64;
+    constexpr size_t iterations = 2048;
+
+    std_vector<std::string> sentences{};
+    for (size_t index = 0; index < count; ++index)
+        sentences.push_back("abandon abandon abandon abandon abandon abandon "
+            "abandon abandon abandon abandon abandon " + std::to_string(index));
+
+    const std_vector<data_slice> passwords(sentences.begin(), sentences.end());
+    const std_vector<data_slice> salts(count, "mnemonic");
+    std_vector<long_hash> scalar(count);
+
+    auto start = steady_clock::now();
+    for (size_t index = 0; index < count; ++index)
+        scalar[index] = pbkd<sha512>::key<long_hash_size>(passwords[index],
+            salts[index], iterations);
+
+    const auto scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto batched = pbkd<sha512>::keys<long_hash_size>(passwords, salts,
+        iterations);
+
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_CHECK(scalar == batched);
+    std::cout << "seeds          : " << count << std::endl
+        << "sha512 lanes   : " << sha512::min_lanes << std::endl
+        << "scalar         : " << scalar_time << "us ("
+        << (count * 1'000'000u / add1(scalar_time)) << "/s)" << std::endl
+        << "batched        : " << batched_time << "us ("
+        << (count * 1'000'000u / add1(batched_time)) << "/s)" << std::endl;
+}
+
+// Approximates the hmac stage of bip32 derivation of a child set.
+BOOST_AUTO_TEST_CASE(performance__hmac_sha512__code_versus_codes)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 100'000;
+    const auto key = base16_array("000102030405060708090a0b0c0d0e0f000102030405060708090a0b0c0d0e0f");
+
+    std_vector<data_chunk> data{};
+    for (size_t child = 0; child < count; ++child)
+        data.emplace_back(37u, static_cast<uint8_t>(child));
+
+    const std_vector<data_slice> set(data.begin(), data.end());
+    std_vector<long_hash> scalar(count);
+
+    auto start = steady_clock::now();
+    for (size_t child = 0; child < count; ++child)
+        scalar[child] = hmac<sha512>::code(set[child], key);
+
+    const auto scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto batched = hmac<sha512>::codes(set, key);
+
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_CHECK(scalar == batched);
+    std::cout << "children       : " << count << std::endl
+        << "code           : " << scalar_time << "us" << std::endl
+        << "codes          : " << batched_time << "us" << std::endl;
+}
+
+// Approximates litecoin header proof of work (scrypt 1024/1/1) checking.
+BOOST_AUTO_TEST_CASE(performance__scrypt_1024_1_1__scalar_versus_batched)
+{
+    using namespace std::chrono;
+    using normal = scrypt<1024, 1, 1, true, false>;
+    using vectorized = scrypt<1024, 1, 1, true, true>;
+    constexpr size_t count = 1024;
+
+    std_vector<data_chunk> headers{};
+    for (size_t index = 0; index < count; ++index)
+        headers.emplace_back(80u, static_cast<uint8_t>(index));
+
+    const std_vector<data_slice> set(headers.begin(), headers.end());
+    std_vector<hash_digest> scalar(count);
+
+    auto start = steady_clock::now();
+    for (size_t index = 0; index < count; ++index)
+        scalar[index] = normal::hash<hash_size>(set[index], set[index]);
+
+    const auto scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto batched = vectorized::hashes<hash_size>(set, set);
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_CHECK(scalar == batched);
+    std::cout << "headers        : " << count << std::endl
+        << "scrypt lanes   : " << vectorized::min_lanes << std::endl
+        << "scalar         : " << scalar_time << "us ("
+        << (count * 1'000'000u / add1(scalar_time)) << "/s)" << std::endl
+        << "batched        : " << batched_time << "us ("
+        << (count * 1'000'000u / add1(batched_time)) << "/s)" << std::endl;
+}
+
+// Approximates bip38 decryption (scrypt 16384/8/8), vectorized across P.
+BOOST_AUTO_TEST_CASE(performance__scrypt_16384_8_8__normal_versus_vectorized)
+{
+    using namespace std::chrono;
+    using normal = scrypt<16384, 8, 8, true, false>;
+    using vectorized = scrypt<16384, 8, 8, true, true>;
+    constexpr size_t count = 8;
+
+    std_vector<hash_digest> scalar(count);
+    std_vector<hash_digest> vector(count);
+
+    auto start = steady_clock::now();
+    for (size_t index = 0; index < count; ++index)
+        scalar[index] = normal::hash<hash_size>("passphrase",
+            to_little_endian(index));
+
+    const auto scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t index = 0; index < count; ++index)
+        vector[index] = vectorized::hash<hash_size>("passphrase",
+            to_little_endian(index));
+
+    const auto vector_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_CHECK(scalar == vector);
+    std::cout << "passphrases    : " << count << std::endl
+        << "normal         : " << scalar_time << "us ("
+        << (count * 1'000'000u / add1(scalar_time)) << "/s)" << std::endl
+        << "vectorized     : " << vector_time << "us ("
+        << (count * 1'000'000u / add1(vector_time)) << "/s)" << std::endl;
+}
+
 // !using shax (see performahce.hpp)
 
 BOOST_AUTO_TEST_CASE(performance__base_sha256a)
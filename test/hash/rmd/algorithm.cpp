@@ -67,6 +67,60 @@ BOOST_AUTO_TEST_CASE(rmd__rmd160_hash__test_vectors__expected)
     }
 }
 
+// hashes (vectorized across halves)
+// ----------------------------------------------------------------------------
+
+template <typename Algorithm>
+static auto get_halves(size_t count)
+{
+    typename Algorithm::halves_t halves(count);
+    for (size_t half = 0; half < count; ++half)
+        for (size_t byte = 0; byte < array_count<typename Algorithm::half_t>; ++byte)
+            halves[half][byte] = narrow_cast<uint8_t>(half * 3 + byte);
+
+    return halves;
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hashes__halves__expected)
+{
+    // Counts exercise all lane widths and the normal form remainder.
+    for (const size_t count: { 0u, 1u, 4u, 7u, 8u, 16u, 29u, 100u })
+    {
+        const auto halves = get_halves<rmd160>(count);
+        const auto digests = rmd160::hashes(halves);
+        BOOST_REQUIRE_EQUAL(digests.size(), count);
+
+        for (size_t half = 0; half < count; ++half)
+        {
+            BOOST_REQUIRE_EQUAL(digests[half], rmd160::hash(halves[half]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd128_hashes__halves__expected)
+{
+    for (const size_t count: { 0u, 1u, 4u, 7u, 8u, 16u, 29u, 100u })
+    {
+        const auto halves = get_halves<rmd128>(count);
+        const auto digests = rmd128::hashes(halves);
+        BOOST_REQUIRE_EQUAL(digests.size(), count);
+
+        for (size_t half = 0; half < count; ++half)
+        {
+            BOOST_REQUIRE_EQUAL(digests[half], rmd128::hash(halves[half]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rmd__rmd160_hashes__null_halves__expected)
+{
+    const rmd160::halves_t halves(17);
+    for (const auto& digest: rmd160::hashes(halves))
+    {
+        BOOST_REQUIRE_EQUAL(digest, rmd_half160);
+    }
+}
+
 // Verify types.
 // ----------------------------------------------------------------------------
 
@@ -85,6 +85,60 @@ BOOST_AUTO_TEST_CASE(scrypt__rfc7914__hash_1__expected)
     BOOST_REQUIRE_EQUAL(hash, expected);
 }
 
+BOOST_AUTO_TEST_CASE(scrypt__hashes__empty__empty)
+{
+    using test = scrypt<16, 1, 1, true>;
+    std_vector<long_hash> out{};
+    BOOST_REQUIRE(test::hashes(out, {}, {}));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hashes__rfc7914_hash_1__expected)
+{
+    // Count exercises 16/8/4 lanes and normal form.
+    using test = scrypt<16, 1, 1, true>;
+    constexpr auto expected = base16_array("77d6576238657b203b19ca42c18a0497f16b4844e3074ae8dfdffa3fede21442fcd0069ded0948f8326a753a0fc81f17e8d3e0fb2e0d3628cf35e20c38d18906");
+    constexpr auto size = size_of<decltype(expected)>();
+    const std_vector<data_slice> set(29, "");
+    const auto hashes = test::hashes<size>(set, set);
+    BOOST_REQUIRE_EQUAL(hashes.size(), set.size());
+
+    for (const auto& hash: hashes)
+    {
+        BOOST_REQUIRE_EQUAL(hash, expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hashes__distinct__expected_hash)
+{
+    // Not concurrent, so hash() does not vectorize, but hashes() does.
+    using test = scrypt<32, 2, 3, false>;
+    std_vector<std::string> passwords{};
+    for (size_t index = 0; index < 11; ++index)
+        passwords.push_back("password" + std::to_string(index));
+
+    const std_vector<data_slice> set(passwords.begin(), passwords.end());
+    const std_vector<data_slice> salts(set.size(), "NaCl");
+    const auto hashes = test::hashes<hash_size>(set, salts);
+    BOOST_REQUIRE_EQUAL(hashes.size(), set.size());
+
+    for (size_t index = 0; index < set.size(); ++index)
+    {
+        BOOST_REQUIRE_EQUAL(hashes[index],
+            test::hash<hash_size>(set[index], salts[index]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(scrypt__hash__concurrent_vectorized__expected_normal)
+{
+    // Concurrent hash vectorizes across P blocks.
+    using vectorized = scrypt<16, 2, 8, true, true>;
+    using normal = scrypt<16, 2, 8, true, false>;
+    static_assert(!normal::vectorization);
+    BOOST_REQUIRE_EQUAL(vectorized::hash<long_hash_size>("password", "NaCl"),
+        normal::hash<long_hash_size>("password", "NaCl"));
+}
+
 // 6+ seconds of test here.
 #if defined(HAVE_SLOW_TESTS)
 
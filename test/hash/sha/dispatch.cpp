@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../hash.hpp"
+
+BOOST_AUTO_TEST_SUITE(sha_dispatch_tests)
+
+// Not compressed, not vectorized, so never dispatched.
+using normal = sha::algorithm<sha::h256<>, false, false, false>;
+static_assert(!normal::dispatched);
+static_assert(!normal::dispatched_merkle);
+static_assert(sha256::dispatched == !sha256::compression);
+static_assert(!sha512::dispatched);
+
+static std_vector<sha256::block_t> get_blocks(size_t count)
+{
+    std_vector<sha256::block_t> blocks(count);
+    for (size_t block = 0; block < count; ++block)
+        for (size_t byte = 0; byte < array_count<sha256::block_t>; ++byte)
+            blocks[block][byte] = narrow_cast<uint8_t>(block * 7 + byte);
+
+    return blocks;
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__have_compress__merkle__implied)
+{
+    BOOST_REQUIRE(!sha::dispatch::have_compress() || sha::dispatch::have_merkle());
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__compress__blocks__expected)
+{
+    const auto blocks = get_blocks(5);
+    auto state = sha256::H::get;
+    if (!sha::dispatch::compress(state.data(), blocks.front().data(),
+        blocks.size()))
+    {
+        BOOST_REQUIRE(!sha::dispatch::have_compress());
+        return;
+    }
+
+    auto expected = sha256::H::get;
+    for (const auto& block: blocks)
+        normal::accumulate(expected, block);
+
+    BOOST_REQUIRE_EQUAL(state, expected);
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__merkle__blocks__expected)
+{
+    // Counts exercise eight/two/one block kernels and in place hashing.
+    for (const size_t count: { 1u, 2u, 3u, 8u, 9u, 17u, 42u })
+    {
+        const auto blocks = get_blocks(count);
+        sha256::digests_t digests(count);
+        const auto hashed = sha::dispatch::merkle(digests.front().data(),
+            blocks.front().data(), count);
+
+        auto in_place = blocks;
+        const auto data = in_place.front().data();
+        BOOST_REQUIRE_EQUAL(sha::dispatch::merkle(data, data, count), hashed);
+        BOOST_REQUIRE(is_zero(hashed) || sha::dispatch::have_merkle());
+
+        for (size_t block = 0; block < hashed; ++block)
+        {
+            const auto expected = normal::double_hash(blocks[block]);
+            BOOST_REQUIRE_EQUAL(digests[block], expected);
+            BOOST_REQUIRE(std::equal(expected.begin(), expected.end(),
+                std::next(data, block * array_count<sha256::digest_t>)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__headers__headers__expected)
+{
+    constexpr size_t size = 80;
+
+    // Counts exercise eight/one header kernels.
+    for (const size_t count: { 1u, 7u, 8u, 9u, 17u, 42u })
+    {
+        data_chunk headers(count * size);
+        for (size_t byte = 0; byte < headers.size(); ++byte)
+            headers[byte] = narrow_cast<uint8_t>(byte * 13 + 7);
+
+        sha256::digests_t digests(count);
+        const auto hashed = sha::dispatch::headers(digests.front().data(),
+            headers.data(), count);
+
+        BOOST_REQUIRE(is_zero(hashed) || sha::dispatch::have_merkle());
+
+        for (size_t header = 0; header < hashed; ++header)
+        {
+            const auto data = std::next(headers.begin(), header * size);
+            const data_chunk message(data, std::next(data, size));
+            BOOST_REQUIRE_EQUAL(digests[header], bitcoin_hash(message));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__sha256__merkle_root__expected)
+{
+    for (const size_t leaves: { 1u, 2u, 3u, 15u, 16u, 17u, 1000u })
+    {
+        sha256::digests_t digests(leaves);
+        for (size_t leaf = 0; leaf < leaves; ++leaf)
+            digests[leaf] = sha256_hash(to_big_endian(leaf));
+
+        auto copy = digests;
+        BOOST_REQUIRE_EQUAL(sha256::merkle_root(std::move(copy)),
+            normal::merkle_root(std::move(digests)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sha_dispatch__sha256__double_hash_block__expected)
+{
+    for (const auto& block: get_blocks(3))
+    {
+        BOOST_REQUIRE_EQUAL(sha256::double_hash(block),
+            normal::double_hash(block));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -259,4 +259,50 @@ BOOST_AUTO_TEST_CASE(sha256__merkle_root__four__expected)
     BOOST_CHECK_EQUAL(sha256::merkle_root({ { 0 }, { 1 }, { 2 }, { 3 } }), expected);
 }
 
+BOOST_AUTO_TEST_CASE(sha256__merkle_root__all_lanes__expected)
+{
+    // Leaf counts exercise 16/8/4 lane widths and the normal form remainder.
+    using sha_256 = sha::algorithm<sha::h256<>, false, true, true>;
+    using normal = sha::algorithm<sha::h256<>, false, false, true>;
+    static_assert(sha_256::vectorization == vectorized);
+    static_assert(!normal::vectorization);
+
+    for (const size_t leaves: { 31u, 32u, 63u, 1000u })
+    {
+        sha256::digests_t digests(leaves);
+        for (size_t leaf = 0; leaf < leaves; ++leaf)
+            digests[leaf] = sha256_hash(to_big_endian(leaf));
+
+        auto copy = digests;
+        BOOST_CHECK_EQUAL(sha_256::merkle_root(std::move(copy)), normal::merkle_root(std::move(digests)));
+    }
+}
+
+// sha256::hashes
+BOOST_AUTO_TEST_CASE(sha256__hashes__empty__empty)
+{
+    BOOST_CHECK(sha256::hashes({}).empty());
+    BOOST_CHECK(sha256::double_hashes({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(sha256__hashes__variable_lengths__expected)
+{
+    // Lengths span pad and counter block boundaries, exceeding all lanes.
+    std_vector<data_chunk> chunks{};
+    for (size_t size = 0; size < 200; ++size)
+        chunks.emplace_back(size, static_cast<uint8_t>(size));
+
+    const sha256::messages_t messages(chunks.begin(), chunks.end());
+    const auto singles = sha256::hashes(messages);
+    const auto doubles = sha256::double_hashes(messages);
+    BOOST_REQUIRE_EQUAL(singles.size(), chunks.size());
+    BOOST_REQUIRE_EQUAL(doubles.size(), chunks.size());
+
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        BOOST_CHECK_EQUAL(singles[index], sha256_hash(chunks[index]));
+        BOOST_CHECK_EQUAL(doubles[index], bitcoin_hash(chunks[index]));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
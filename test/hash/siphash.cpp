@@ -74,4 +74,36 @@ BOOST_AUTO_TEST_CASE(siphash__key__vectors__expected)
     }
 }
 
+BOOST_AUTO_TEST_CASE(siphash__siphashes__empty__empty)
+{
+    BOOST_REQUIRE(siphashes({}, {}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(siphash__siphashes__vectors__expected)
+{
+    half_hash hash{};
+    BOOST_REQUIRE(decode_base16(hash, hash_test_key));
+
+    // Reversed and repeated, so that lanes mix message lengths and order.
+    std_vector<data_chunk> messages{};
+    std_vector<uint64_t> expected{};
+    for (size_t repeat = 0; repeat < 3; ++repeat)
+    {
+        for (auto it = siphash_hash_tests.rbegin();
+            it != siphash_hash_tests.rend(); ++it)
+        {
+            data_chunk data;
+            BOOST_REQUIRE(decode_base16(data, it->message));
+            messages.push_back(std::move(data));
+
+            data_chunk encoded_expected;
+            BOOST_REQUIRE(decode_base16(encoded_expected, it->result));
+            expected.push_back(from_little_endian<uint64_t>(encoded_expected));
+        }
+    }
+
+    const std_vector<data_slice> set(messages.begin(), messages.end());
+    BOOST_REQUIRE(siphashes(to_siphash_key(hash), set) == expected);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
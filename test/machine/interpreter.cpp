@@ -17,13 +17,648 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "../chain/taproot.hpp"
 
 
 BOOST_AUTO_TEST_SUITE(interpreter_tests)
 
+using namespace system::chain;
+using namespace system::machine;
+
+class accessor
+  : public interpreter<contiguous_stack>
+{
+public:
+    using interpreter<contiguous_stack>::connect_scripts;
+    using interpreter<contiguous_stack>::connect_standard;
+    using interpreter<contiguous_stack>::tapleaf_hash;
+    using interpreter<contiguous_stack>::check_commitment;
+};
+
 BOOST_AUTO_TEST_CASE(interpreter__construct__todo__todo)
 {
     BOOST_REQUIRE(true);
 }
 
+constexpr uint64_t value = 42;
+const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+const ec_secret other_secret = base16_hash("0000000000000000000000000000000000000000000000000000000000000001");
+
+static data_chunk public_key(const ec_secret& key)
+{
+    ec_compressed point{};
+    BOOST_REQUIRE(secret_to_public(point, key));
+    return to_chunk(point);
+}
+
+static const script& key_hash_prevout()
+{
+    static const script prevout{ script::to_pay_key_hash_pattern(bitcoin_short_hash(public_key(secret))) };
+    return prevout;
+}
+
+static const script& witness_key_hash_prevout()
+{
+    static const script prevout{ script::to_pay_witness_key_hash_pattern(bitcoin_short_hash(public_key(secret))) };
+    return prevout;
+}
+
+// One input spend of the prevout, signed (hash_all) with the given secret.
+// The sighash flags byte may be replaced, so that the signature is invalid.
+static transaction spend(const script& prevout, bool witnessed,
+    const ec_secret& signer, uint8_t flags = coverage::hash_all)
+{
+    const point previous{ null_hash, 0 };
+    const outputs outs{ { sub1(value), script{ "return" } } };
+    const transaction unsigned_tx{ 1, inputs{ { previous, script{}, witness{}, 0 } }, outs, 0 };
+
+    const auto key = public_key(signer);
+    const auto version = witnessed ? script_version::zero : script_version::unversioned;
+    const script sub{ witnessed ? script{ script::to_pay_key_hash_pattern(bitcoin_short_hash(key)) } : prevout };
+
+    endorsement endorsed{};
+    BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed, signer, sub, 0, value, coverage::hash_all, version, witnessed));
+    endorsed.back() = flags;
+
+    const transaction tx
+    {
+        1,
+        inputs
+        {
+            witnessed ?
+                input{ previous, script{}, witness{ data_stack{ endorsed, key } }, 0 } :
+                input{ previous, script{ { { endorsed, true }, { key, true } } }, witness{}, 0 }
+        },
+        outs,
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(value, prevout);
+    return tx;
+}
+
+// Compares the result of connect (standard templates) to generic evaluation.
+static code differential(const transaction& tx, uint32_t forks, bool standard)
+{
+    context state{};
+    state.forks = forks;
+    const auto it = tx.inputs_ptr()->begin();
+
+    signature_cache::instance().clear();
+    BOOST_REQUIRE_EQUAL(accessor::connect_standard(state, tx, it, nullptr), standard);
+
+    signature_cache::instance().clear();
+    const auto expected = accessor::connect_scripts(state, tx, it, nullptr);
+
+    signature_cache::instance().clear();
+    BOOST_REQUIRE_EQUAL(interpreter<contiguous_stack>::connect(state, tx, it), expected);
+    BOOST_REQUIRE_EQUAL(interpreter<linked_stack>::connect(state, tx, it), expected);
+    return expected;
+}
+
+// standard templates
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__key_hash__success)
+{
+    const auto tx = spend(key_hash_prevout(), false, secret);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, true), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__key_hash_other_key__same_failure)
+{
+    const auto tx = spend(key_hash_prevout(), false, other_secret);
+    BOOST_REQUIRE_NE(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__key_hash_invalid_signature__same_failure)
+{
+    const auto tx = spend(key_hash_prevout(), false, secret, coverage::hash_none);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__key_hash_unexpected_witness__same_failure)
+{
+    const auto tx = spend(key_hash_prevout(), false, secret);
+    const auto& in = *tx.inputs_ptr()->front();
+    const transaction witnessed
+    {
+        1,
+        inputs{ { in.point(), in.script(), witness{ "[42]" }, 0 } },
+        outputs{ { sub1(value), script{ "return" } } },
+        0
+    };
+
+    witnessed.inputs_ptr()->front()->prevout = in.prevout;
+    BOOST_REQUIRE_EQUAL(differential(witnessed, forks::all_rules, false), error::unexpected_witness);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__witness_key_hash__success)
+{
+    const auto tx = spend(witness_key_hash_prevout(), true, secret);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, true), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__witness_key_hash_other_key__same_failure)
+{
+    const auto tx = spend(witness_key_hash_prevout(), true, other_secret);
+    BOOST_REQUIRE_NE(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__witness_key_hash_invalid_signature__same_failure)
+{
+    const auto tx = spend(witness_key_hash_prevout(), true, secret, coverage::hash_none);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__witness_key_hash_without_bip143__same_result)
+{
+    const auto tx = spend(witness_key_hash_prevout(), true, secret);
+    const auto forks = bit_and<uint32_t>(forks::all_rules, bit_not<uint32_t>(forks::bip143_rule));
+    differential(tx, forks, false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__witness_key_hash_without_bip141__same_result)
+{
+    const auto tx = spend(witness_key_hash_prevout(), true, secret);
+    const auto forks = bit_and<uint32_t>(forks::all_rules, bit_not<uint32_t>(forks::bip141_rule));
+    BOOST_REQUIRE_EQUAL(differential(tx, forks, false), error::unexpected_witness);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_without_bip341__success)
+{
+    const script prevout{ "1 [0101010101010101010101010101010101010101010101010101010101010101]" };
+    const auto tx = spend(prevout, true, secret);
+    const auto forks = bit_and<uint32_t>(forks::all_rules, bit_not<uint32_t>(forks::taproot_group));
+    BOOST_REQUIRE_EQUAL(differential(tx, forks, true), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_ecdsa_witness__same_failure)
+{
+    // The two element witness is evaluated as a script path spend (bip341).
+    const script prevout{ "1 [0101010101010101010101010101010101010101010101010101010101010101]" };
+    const auto tx = spend(prevout, true, secret);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::invalid_taproot_commitment);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_false_program__same_failure)
+{
+    const script prevout{ "1 [0000000000000000000000000000000000000000000000000000000000000000]" };
+    const auto tx = spend(prevout, true, secret);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::stack_false);
+}
+
+// taproot
+
+static ec_xonly xonly_key(const ec_secret& key)
+{
+    const auto point = public_key(key);
+    return to_array<ec_xonly_size>({ std::next(point.begin()), point.end() });
+}
+
+// One input spend of a taproot prevout, with the witness stack produced by
+// the signer from the signature hash of the unsigned transaction.
+template <typename Signer>
+static transaction taproot_spend(const data_chunk& program, Signer&& signer,
+    const point& previous=point{ null_hash, 0 })
+{
+    const outputs outs{ { sub1(value), script{ "return" } } };
+    const auto prevout = to_shared<output>(value, script{ script::to_pay_witness_pattern(1, program) });
+    const transaction unsigned_tx{ 1, inputs{ { previous, script{}, witness{}, 0 } }, outs, 0 };
+    unsigned_tx.inputs_ptr()->front()->prevout = prevout;
+
+    const transaction tx{ 1, inputs{ { previous, script{}, witness{ signer(unsigned_tx) }, 0 } }, outs, 0 };
+    tx.inputs_ptr()->front()->prevout = prevout;
+    return tx;
+}
+
+static data_chunk schnorr_endorse(const transaction& tx, const ec_secret& signer,
+    uint8_t flags, const hash_digest* tapleaf = nullptr)
+{
+    hash_digest sighash{};
+    ec_signature signature{};
+    BOOST_REQUIRE(tx.signature_hash(sighash, tx.inputs_ptr()->begin(), flags, {}, tapleaf, max_uint32));
+    BOOST_REQUIRE(schnorr::sign(signature, signer, sighash, null_hash));
+
+    auto endorsed = to_chunk(signature);
+    if (flags != coverage::hash_default)
+        endorsed.push_back(flags);
+
+    return endorsed;
+}
+
+static transaction key_path_spend(const ec_secret& signer, uint8_t flags = coverage::hash_default)
+{
+    return taproot_spend(to_chunk(xonly_key(secret)), [&](const transaction& tx)
+    {
+        return data_stack{ schnorr_endorse(tx, signer, flags) };
+    });
+}
+
+// Single leaf tree, the control block is version/parity and internal key.
+static transaction script_path_spend(const data_chunk& leaf, data_stack stack, bool sign)
+{
+    const auto internal = xonly_key(other_secret);
+    data_chunk preimage{ tapscript_leaf_version, narrow_cast<uint8_t>(leaf.size()) };
+    preimage.insert(preimage.end(), leaf.begin(), leaf.end());
+    const auto tapleaf = tagged_hash("TapLeaf", preimage);
+    const auto tweak = tagged_hash("TapTweak", splice(internal, tapleaf));
+
+    auto odd = false;
+    ec_xonly program{};
+    BOOST_REQUIRE(schnorr::tweak(program, odd, internal, tweak));
+    const auto control = to_chunk(splice(to_array(bit_or<uint8_t>(tapscript_leaf_version, odd ? 1 : 0)), internal));
+
+    return taproot_spend(to_chunk(program), [&](const transaction& tx)
+    {
+        if (sign)
+            stack.insert(stack.begin(), schnorr_endorse(tx, secret, coverage::hash_default, &tapleaf));
+
+        stack.push_back(leaf);
+        stack.push_back(control);
+        return stack;
+    });
+}
+
+static data_chunk checksig_leaf()
+{
+    return to_chunk(splice(to_array(0x20), xonly_key(secret), to_array(0xac)));
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_key_path__success)
+{
+    const auto tx = key_path_spend(secret);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, true), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_key_path_hash_all__success)
+{
+    const auto tx = key_path_spend(secret, coverage::hash_all);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, true), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_key_path_other_key__same_failure)
+{
+    const auto tx = key_path_spend(other_secret);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::invalid_schnorr_signature);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_key_path_undefined_flags__same_failure)
+{
+    const auto tx = key_path_spend(secret, 0x04);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::invalid_schnorr_signature);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_script_path__success)
+{
+    const auto tx = script_path_spend(checksig_leaf(), {}, true);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_script_path_empty_signature__stack_false)
+{
+    const auto tx = script_path_spend(checksig_leaf(), { {} }, false);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::stack_false);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_script_path_success_code__success)
+{
+    // op_cat (disabled) is a success code in tapscript (bip342).
+    const auto tx = script_path_spend({ 0x7e }, {}, false);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_script_path_multisig__same_failure)
+{
+    const auto tx = script_path_spend({ 0x00, 0x00, 0x00, 0xae }, {}, false);
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::op_check_multisig_tapscript);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_script_path_invalid_control__same_failure)
+{
+    const auto tx = script_path_spend({ 0x51 }, {}, false);
+    const auto& in = *tx.inputs_ptr()->front();
+    auto stack = in.witness().stack();
+    stack.back() = to_shared<data_chunk>(data_chunk(34, 0xc0));
+
+    data_stack elements{};
+    for (const auto& element: stack)
+        elements.push_back(*element);
+
+    const transaction invalid{ 1, inputs{ { in.point(), script{}, witness{ elements }, 0 } }, outputs{ { sub1(value), script{ "return" } } }, 0 };
+    invalid.inputs_ptr()->front()->prevout = in.prevout;
+    BOOST_REQUIRE_EQUAL(differential(invalid, forks::all_rules, false), error::invalid_control_block);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__deferred_checks__same_checks)
+{
+    const auto tx = spend(witness_key_hash_prevout(), true, secret);
+    const auto it = tx.inputs_ptr()->begin();
+    context state{};
+    state.forks = forks::all_rules;
+
+    signature_cache::instance().clear();
+    ec_signature_checks generic{};
+    BOOST_REQUIRE_EQUAL(accessor::connect_scripts(state, tx, it, &generic), error::script_success);
+
+    signature_cache::instance().clear();
+    ec_signature_checks standard{};
+    BOOST_REQUIRE_EQUAL(interpreter<contiguous_stack>::connect(state, tx, it, standard), error::script_success);
+    BOOST_REQUIRE_EQUAL(standard.size(), one);
+    BOOST_REQUIRE_EQUAL(generic.size(), one);
+    BOOST_REQUIRE_EQUAL(standard.front().point, generic.front().point);
+    BOOST_REQUIRE_EQUAL(standard.front().hash, generic.front().hash);
+
+    boost::asio::thread_pool pool(1);
+    BOOST_REQUIRE(verify_signatures(standard, pool));
+    pool.join();
+}
+
+// bip341 vectors
+
+static data_chunk decode_chunk(const std::string& text)
+{
+    data_chunk out{};
+    BOOST_REQUIRE(decode_base16(out, text));
+    return out;
+}
+
+// bip341 keyPathSpending transaction, with vector witnesses (signatures) on
+// the taproot inputs and all prevouts populated.
+static transaction get_key_path_signed()
+{
+    const transaction unsigned_tx{ decode_chunk(key_path_unsigned_tx), true };
+    BOOST_REQUIRE(unsigned_tx.is_valid());
+
+    inputs ins{};
+    for (const auto& in: *unsigned_tx.inputs_ptr())
+        ins.emplace_back(in->point(), in->script(), witness{}, in->sequence());
+
+    for (const auto& test: key_path_tests)
+    {
+        auto& in = ins[test.index];
+        in = { in.point(), in.script(), witness{ data_stack{ decode_chunk(test.witness) } }, in.sequence() };
+    }
+
+    outputs outs{};
+    for (const auto& out: *unsigned_tx.outputs_ptr())
+        outs.push_back(*out);
+
+    const transaction tx{ unsigned_tx.version(), std::move(ins), std::move(outs), unsigned_tx.locktime() };
+    const auto& populated = *tx.inputs_ptr();
+    for (size_t index = 0; index < populated.size(); ++index)
+    {
+        const auto& prevout = key_path_prevouts[index];
+        populated[index]->prevout = to_shared<output>(prevout.value,
+            script{ decode_chunk(prevout.script), false });
+    }
+
+    return tx;
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__bip341_key_path__success)
+{
+    const auto tx = get_key_path_signed();
+    context state{};
+    state.forks = forks::all_rules;
+
+    boost::asio::thread_pool pool(1);
+    for (const auto& test: key_path_tests)
+    {
+        const auto it = std::next(tx.inputs_ptr()->begin(), test.index);
+
+        signature_cache::instance().clear();
+        BOOST_REQUIRE(accessor::connect_standard(state, tx, it, nullptr));
+
+        signature_cache::instance().clear();
+        BOOST_REQUIRE_EQUAL(accessor::connect_scripts(state, tx, it, nullptr), error::script_success);
+
+        signature_cache::instance().clear();
+        ec_signature_checks checks{};
+        BOOST_REQUIRE_EQUAL(interpreter<contiguous_stack>::connect(state, tx, it, checks), error::script_success);
+        BOOST_REQUIRE_EQUAL(checks.size(), one);
+        BOOST_REQUIRE(checks.front().schnorr);
+        BOOST_REQUIRE(verify_signatures(checks, pool));
+    }
+
+    pool.join();
+    signature_cache::instance().clear();
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__check_commitment__bip341_script_trees__expected)
+{
+    for (const auto& test: script_tree_tests)
+    {
+        const auto leaf = accessor::tapleaf_hash(test.leaf_version, decode_chunk(test.leaf_script));
+        BOOST_REQUIRE_EQUAL(to_chunk(leaf), decode_chunk(test.leaf_hash));
+
+        // The merkle root of a single leaf tree is the leaf hash.
+        const auto internal = decode_chunk(test.internal_key);
+        const auto tweak = tagged_hash("TapTweak", splice(internal, leaf));
+        BOOST_REQUIRE_EQUAL(to_chunk(tweak), decode_chunk(test.tweak));
+
+        const auto program = decode_chunk(test.tweaked_key);
+        const auto control = decode_chunk(test.control_block);
+        BOOST_REQUIRE_EQUAL(control.size(), taproot_control_base_size);
+        BOOST_REQUIRE(accessor::check_commitment(program, control, leaf));
+
+        // The control block commits to the parity of the output key.
+        auto parity = control;
+        parity.front() ^= 0x01;
+        BOOST_REQUIRE(!accessor::check_commitment(program, parity, leaf));
+    }
+}
+
+// deferred
+
+const ec_secret third_secret = base16_hash("0000000000000000000000000000000000000000000000000000000000000002");
+
+static const script& multisig_prevout()
+{
+    static const script prevout{ script::to_pay_multisig_pattern(2, data_stack{ public_key(secret), public_key(other_secret), public_key(third_secret) }) };
+    return prevout;
+}
+
+// One input spend of the 2-of-3 multisig prevout, signed in signer order.
+static transaction multisig_spend(const std::vector<ec_secret>& signers)
+{
+    const point previous{ null_hash, 0 };
+    const outputs outs{ { sub1(value), script{ "return" } } };
+    const transaction unsigned_tx{ 1, inputs{ { previous, script{}, witness{}, 0 } }, outs, 0 };
+
+    operations ops{ { opcode::push_size_0 } };
+    for (const auto& signer: signers)
+    {
+        endorsement endorsed{};
+        BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed, signer, multisig_prevout(), 0, value, coverage::hash_all, script_version::unversioned, false));
+        ops.emplace_back(endorsed, true);
+    }
+
+    const transaction tx{ 1, inputs{ { previous, script{ std::move(ops) }, witness{}, 0 } }, outs, 0 };
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(value, multisig_prevout());
+    return tx;
+}
+
+// Connects with deferred checks, returning the code and collected checks.
+static code deferred(const transaction& tx, ec_signature_checks& checks)
+{
+    context state{};
+    state.forks = forks::all_rules;
+    signature_cache::instance().clear();
+    return interpreter<contiguous_stack>::connect(state, tx, tx.inputs_ptr()->begin(), checks);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__deferred_multisig_leading_keys__success)
+{
+    const auto tx = multisig_spend({ secret, other_secret });
+    ec_signature_checks checks{};
+    BOOST_REQUIRE_EQUAL(deferred(tx, checks), error::script_success);
+    BOOST_REQUIRE(checks.empty());
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+// Signatures for other than the leading keys require ordered key matching,
+// so multisig signatures are verified during evaluation (not deferred).
+BOOST_AUTO_TEST_CASE(interpreter__connect__deferred_multisig_trailing_keys__success)
+{
+    const auto tx = multisig_spend({ other_secret, third_secret });
+    ec_signature_checks checks{};
+    BOOST_REQUIRE_EQUAL(deferred(tx, checks), error::script_success);
+    BOOST_REQUIRE(checks.empty());
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__deferred_multisig_skipped_key__success)
+{
+    const auto tx = multisig_spend({ secret, third_secret });
+    ec_signature_checks checks{};
+    BOOST_REQUIRE_EQUAL(deferred(tx, checks), error::script_success);
+    BOOST_REQUIRE(checks.empty());
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::script_success);
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__deferred_multisig_reversed_keys__same_failure)
+{
+    // Endorsements must be in key order.
+    const auto tx = multisig_spend({ third_secret, other_secret });
+    ec_signature_checks checks{};
+    const auto expected = differential(tx, forks::all_rules, false);
+    BOOST_REQUIRE_NE(expected, error::script_success);
+    BOOST_REQUIRE_EQUAL(deferred(tx, checks), expected);
+    BOOST_REQUIRE(checks.empty());
+}
+
+BOOST_AUTO_TEST_CASE(interpreter__connect__deferred_invalid_signature__assumed_valid)
+{
+    // Valid encoding, but the signature is for hash_all (not hash_none).
+    const auto tx = spend(key_hash_prevout(), false, secret, coverage::hash_none);
+    ec_signature_checks checks{};
+    BOOST_REQUIRE_EQUAL(deferred(tx, checks), error::script_success);
+    BOOST_REQUIRE_EQUAL(checks.size(), one);
+
+    boost::asio::thread_pool pool(1);
+    BOOST_REQUIRE(!verify_signatures(checks, pool));
+    pool.join();
+    BOOST_REQUIRE_EQUAL(differential(tx, forks::all_rules, false), error::stack_false);
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Signatures are cached after the first round, so this isolates the cost of
+// evaluation (program construction and stack operations) from verification.
+BOOST_AUTO_TEST_CASE(interpreter__connect__standard_templates__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t rounds = 100'000;
+    const std::vector<transaction> txs
+    {
+        spend(key_hash_prevout(), false, secret),
+        spend(witness_key_hash_prevout(), true, secret)
+    };
+
+    context state{};
+    state.forks = forks::all_rules;
+
+    auto start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (const auto& tx: txs)
+            BOOST_REQUIRE(!accessor::connect_scripts(state, tx, tx.inputs_ptr()->begin(), nullptr));
+
+    const auto generic_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        for (const auto& tx: txs)
+            BOOST_REQUIRE(!interpreter<contiguous_stack>::connect(state, tx, tx.inputs_ptr()->begin()));
+
+    const auto standard_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    std::cout << "inputs   : " << rounds * txs.size() << std::endl
+        << "generic  : " << generic_time << "us" << std::endl
+        << "standard : " << standard_time << "us" << std::endl;
+}
+
+// Single input key path spend by a key and outpoint distinct to index.
+static transaction distinct_key_path_spend(size_t index)
+{
+    const auto signer = sha256_hash(to_little_endian(index));
+    const point previous{ sha256_hash(to_big_endian(index)), 0 };
+    return taproot_spend(to_chunk(xonly_key(signer)), [&](const transaction& tx)
+    {
+        return data_stack{ schnorr_endorse(tx, signer, is_odd(index) ?
+            coverage::hash_all : coverage::hash_default) };
+    }, previous);
+}
+
+// A block of distinct key path spends (no signature cache hits), comparing
+// immediate (sequential) verification to deferred (batched) verification.
+BOOST_AUTO_TEST_CASE(interpreter__connect__taproot_key_path_block__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t spends = 2'000;
+    transactions txs{};
+    txs.reserve(spends);
+    for (size_t spend = 0; spend < spends; ++spend)
+        txs.push_back(distinct_key_path_spend(spend));
+
+    const block instance{ header{}, std::move(txs) };
+    auto& cache = signature_cache::instance();
+    context state{};
+    state.forks = forks::all_rules;
+
+    cache.clear();
+    auto start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.connect(state), error::block_success);
+    const auto immediate_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    // Posted tasks are never run by an empty pool, so the caller does all.
+    boost::asio::thread_pool caller(0);
+    cache.clear();
+    start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.connect(state, caller), error::block_success);
+    const auto deferred_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    boost::asio::thread_pool pool{};
+    cache.clear();
+    start = steady_clock::now();
+    BOOST_REQUIRE_EQUAL(instance.connect(state, pool), error::block_success);
+    const auto concurrent_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    caller.join();
+    pool.join();
+
+    std::cout << "spends     : " << spends << std::endl
+        << "immediate  : " << immediate_time << "us" << std::endl
+        << "deferred   : " << deferred_time << "us" << std::endl
+        << "concurrent : " << concurrent_time << "us" << std::endl;
+
+    cache.clear();
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
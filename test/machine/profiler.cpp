@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(profiler_tests)
+
+using namespace system::chain;
+using namespace system::machine;
+namespace json = boost::json;
+
+using profiled = interpreter<contiguous_stack, profiler>;
+
+constexpr uint64_t value = 42;
+const ec_secret secret = base16_hash("ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+const ec_secret secret2 = base16_hash("9ff2a6f1de6bc7fa2e4c3c81ae0f5b0e45cfd3d9a1c1b2e4f7e3a5c8d6b4a291");
+
+// One input spend of the prevout by the input script.
+static transaction spend(const script& input_script, const script& prevout)
+{
+    const transaction tx
+    {
+        1,
+        inputs{ { point{ null_hash, 0 }, input_script, witness{}, 0 } },
+        outputs{ { sub1(value), script{ "return" } } },
+        0
+    };
+
+    tx.inputs_ptr()->front()->prevout = to_shared<output>(value, prevout);
+    return tx;
+}
+
+static code connect(const transaction& tx)
+{
+    context state{};
+    state.forks = forks::all_rules;
+    return profiled::connect(state, tx, tx.inputs_ptr()->begin());
+}
+
+static size_t to_index(opcode code)
+{
+    return static_cast<size_t>(code);
+}
+
+static uint64_t count(const profile& profile, opcode code)
+{
+    return profile.operations.at(to_index(code)).count;
+}
+
+static size_t allocations{};
+static size_t count_allocation()
+{
+    return ++allocations;
+}
+
+// unprofiled
+
+BOOST_AUTO_TEST_CASE(unprofiled__hooks__empty)
+{
+    BOOST_REQUIRE(std::is_empty_v<unprofiled::timer>);
+    BOOST_REQUIRE(std::is_empty_v<unprofiled::scope>);
+    BOOST_REQUIRE(std::is_empty_v<unprofiled::embedded>);
+    BOOST_REQUIRE(std::is_empty_v<unprofiled>);
+}
+
+// profiler
+
+BOOST_AUTO_TEST_CASE(profiler__clear__default__zeroed)
+{
+    profiler::clear();
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ "1 2" }, script{ "add 3 equal" })), error::script_success);
+    profiler::clear();
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.runs, 0u);
+    BOOST_REQUIRE_EQUAL(profile.stack_high_water, 0u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::add), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__arithmetic__expected_counts)
+{
+    profiler::clear();
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ "1 2" }, script{ "add 3 equal" })), error::script_success);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.runs, 2u);
+    BOOST_REQUIRE_EQUAL(profile.embedded_runs, 0u);
+    BOOST_REQUIRE_EQUAL(profile.sighashes, 0u);
+    BOOST_REQUIRE_EQUAL(profile.verifications, 0u);
+    BOOST_REQUIRE_EQUAL(profile.stack_high_water, 2u);
+    BOOST_REQUIRE_EQUAL(profile.allocations, 0u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::push_positive_1), 1u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::push_positive_2), 1u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::push_positive_3), 1u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::add), 1u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::equal), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__skipped_branch__not_counted)
+{
+    profiler::clear();
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ "0" }, script{ "if return endif 1" })), error::script_success);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::if_), 1u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::op_return), 0u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::endif), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__check_sig__sighash_and_verification)
+{
+    ec_compressed key{};
+    BOOST_REQUIRE(secret_to_public(key, secret));
+    const script prevout{ "[" + encode_base16(key) + "] checksig" };
+
+    const auto unsigned_tx = spend(script{}, prevout);
+    endorsement endorsed{};
+    BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed, secret, prevout, 0, value, coverage::hash_all, script_version::unversioned, false));
+
+    signature_cache::instance().clear();
+    profiler::clear();
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ { { endorsed, true } } }, prevout)), error::script_success);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.sighashes, 1u);
+    BOOST_REQUIRE_EQUAL(profile.verifications, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__multisig_shared_flags__one_sighash)
+{
+    ec_compressed key1{};
+    ec_compressed key2{};
+    BOOST_REQUIRE(secret_to_public(key1, secret));
+    BOOST_REQUIRE(secret_to_public(key2, secret2));
+    const script prevout{ "2 [" + encode_base16(key1) + "] [" + encode_base16(key2) + "] 2 checkmultisig" };
+
+    const auto unsigned_tx = spend(script{}, prevout);
+    endorsement endorsed1{};
+    endorsement endorsed2{};
+    BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed1, secret, prevout, 0, value, coverage::hash_all, script_version::unversioned, false));
+    BOOST_REQUIRE(unsigned_tx.create_endorsement(endorsed2, secret2, prevout, 0, value, coverage::hash_all, script_version::unversioned, false));
+
+    // The signature hash is computed once for both (same flags).
+    signature_cache::instance().clear();
+    profiler::clear();
+    const script input{ { { opcode::push_size_0 }, { endorsed1, true }, { endorsed2, true } } };
+    BOOST_REQUIRE_EQUAL(connect(spend(input, prevout)), error::script_success);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.sighashes, 1u);
+    BOOST_REQUIRE_EQUAL(profile.verifications, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__connect__pay_to_script_hash__embedded_run)
+{
+    const script embedded{ "1 2 add 3 equal" };
+    const auto redeem = embedded.to_data(false);
+    const script prevout{ "hash160 [" + encode_base16(bitcoin_short_hash(redeem)) + "] equal" };
+
+    profiler::clear();
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ { { redeem, true } } }, prevout)), error::script_success);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.runs, 2u);
+    BOOST_REQUIRE_EQUAL(profile.embedded_runs, 1u);
+    BOOST_REQUIRE_EQUAL(count(profile, opcode::add), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__set_allocation_counter__embedded__attributed_once)
+{
+    const script embedded{ "1 2 add 3 equal" };
+    const auto redeem = embedded.to_data(false);
+    const script prevout{ "hash160 [" + encode_base16(bitcoin_short_hash(redeem)) + "] equal" };
+
+    // Two runs sample twice each, the embedded connection (not its run) twice.
+    allocations = 0;
+    profiler::clear();
+    profiler::set_allocation_counter(&count_allocation);
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ { { redeem, true } } }, prevout)), error::script_success);
+    profiler::set_allocation_counter(nullptr);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.allocations, 2u);
+    BOOST_REQUIRE_EQUAL(profile.embedded_allocations, 1u);
+    BOOST_REQUIRE_EQUAL(allocations, 6u);
+}
+
+BOOST_AUTO_TEST_CASE(profiler__set_allocation_counter__counted__one_per_run)
+{
+    // The counter increments per sample, and each run samples it twice.
+    allocations = 0;
+    profiler::clear();
+    profiler::set_allocation_counter(&count_allocation);
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ "1 2" }, script{ "add 3 equal" })), error::script_success);
+    profiler::set_allocation_counter(nullptr);
+
+    const auto profile = profiler::snapshot();
+    BOOST_REQUIRE_EQUAL(profile.runs, 2u);
+    BOOST_REQUIRE_EQUAL(profile.allocations, 2u);
+    BOOST_REQUIRE_EQUAL(allocations, 4u);
+}
+
+// json
+
+BOOST_AUTO_TEST_CASE(profile_json__conversions__expected)
+{
+    profiler::clear();
+    BOOST_REQUIRE_EQUAL(connect(spend(script{ "1 2" }, script{ "add 3 equal" })), error::script_success);
+
+    const auto instance = profiler::snapshot();
+    const auto value = json::value_from(instance);
+    const auto& operations = value.at("operations").as_array();
+    BOOST_REQUIRE_EQUAL(operations.size(), 5u);
+    BOOST_REQUIRE_EQUAL(value.at("runs").to_number<uint64_t>(), 2u);
+
+    const auto add = std::find_if(operations.begin(), operations.end(), [](const json::value& element)
+    {
+        return element.at("opcode").as_string() == "add";
+    });
+
+    BOOST_REQUIRE(add != operations.end());
+    BOOST_REQUIRE_EQUAL(add->at("code").to_number<size_t>(), static_cast<size_t>(opcode::add));
+    BOOST_REQUIRE_EQUAL(add->at("count").to_number<uint64_t>(), 1u);
+
+    const auto copy = json::value_to<profile>(value);
+    BOOST_REQUIRE(json::value_from(copy) == value);
+    BOOST_REQUIRE_EQUAL(copy.runs, instance.runs);
+    BOOST_REQUIRE_EQUAL(copy.embedded_runs, instance.embedded_runs);
+    BOOST_REQUIRE_EQUAL(copy.stack_high_water, instance.stack_high_water);
+    BOOST_REQUIRE_EQUAL(copy.operations.at(to_index(opcode::add)).nanoseconds,
+        instance.operations.at(to_index(opcode::add)).nanoseconds);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
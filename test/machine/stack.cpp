@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(stack_tests)
+
+using namespace system::machine;
+
+// chunk_tether
+
+BOOST_AUTO_TEST_CASE(chunk_tether__push__many__stable_values)
+{
+    chunk_tether instance{};
+    std::vector<chunk_xptr> pointers{};
+
+    // Spans multiple blocks.
+    for (uint8_t value = 0; value < 42; ++value)
+        pointers.push_back(instance.push(data_chunk(20, value)));
+
+    for (uint8_t value = 0; value < 42; ++value)
+    {
+        BOOST_REQUIRE(pointers[value]);
+        BOOST_REQUIRE_EQUAL(*pointers[value], data_chunk(20, value));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(chunk_tether__copy__shared_store__stable_values)
+{
+    auto instance = std::make_unique<chunk_tether>();
+    const auto first = instance->push({ 0x01 });
+    const chunk_tether copy{ *instance };
+    const auto second = instance->push({ 0x02 });
+    instance.reset();
+
+    // Copy retains the store, including values pushed after copy.
+    BOOST_REQUIRE_EQUAL(*first, data_chunk{ 0x01 });
+    BOOST_REQUIRE_EQUAL(*second, data_chunk{ 0x02 });
+}
+
+// stack
+
+template <typename Container>
+static void copy_push_pop()
+{
+    const data_chunk key(33, 0x42);
+    stack<Container> original{};
+    original.emplace_chunk(chunk_xptr{ &key });
+    original.emplace_integer(42);
+
+    // Conversion tethers to the original, and is retained by the copy.
+    const auto converted = original.peek_chunk();
+    auto copy = std::make_unique<stack<Container>>(original);
+    copy->push(data_chunk(20, 0x24));
+    BOOST_REQUIRE_EQUAL(copy->size(), 3u);
+    BOOST_REQUIRE_EQUAL(original.size(), 2u);
+
+    const auto computed = copy->peek_chunk();
+    copy->drop();
+    copy->drop();
+    BOOST_REQUIRE(copy->peek_chunk().get() == &key);
+
+    // The original retains the store of the copy.
+    copy.reset();
+    BOOST_REQUIRE_EQUAL(*computed, data_chunk(20, 0x24));
+    BOOST_REQUIRE_EQUAL(*converted, data_chunk{ 42 });
+    BOOST_REQUIRE_EQUAL(original.pop().index(), 1u);
+    BOOST_REQUIRE(original.peek_chunk().get() == &key);
+}
+
+BOOST_AUTO_TEST_CASE(stack__copy__contiguous__independent_elements)
+{
+    copy_push_pop<contiguous_stack>();
+}
+
+BOOST_AUTO_TEST_CASE(stack__copy__linked__independent_elements)
+{
+    copy_push_pop<linked_stack>();
+}
+
+BOOST_AUTO_TEST_CASE(stack__push__beyond_initial_capacity__expected)
+{
+    stack<contiguous_stack> instance{};
+    for (int64_t value = 0; value < 100; ++value)
+        instance.emplace_integer(value);
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 100u);
+    for (int64_t value = 0; value < 100; ++value)
+        BOOST_REQUIRE_EQUAL(std::get<int64_t>(instance.peek(value)), 99 - value);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2022 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(limbs_tests)
+
+// wide
+static_assert(multiply_high(max_uint64, max_uint64) == sub1(max_uint64));
+static_assert(multiply_high(power2<uint64_t>(32u), power2<uint64_t>(32u)) == 1);
+static_assert(multiply_high(42, 42) == 0);
+
+constexpr uint64_t wide_high(uint64_t left, uint64_t right)
+{
+    uint64_t high{};
+    multiply_wide_native(left, right, high);
+    return high;
+}
+
+constexpr uint64_t wide_low(uint64_t left, uint64_t right)
+{
+    uint64_t high{};
+    return multiply_wide_native(left, right, high);
+}
+
+static_assert(wide_high(max_uint64, max_uint64) == sub1(max_uint64));
+static_assert(wide_low(max_uint64, max_uint64) == 1);
+static_assert(wide_high(0x0123456789abcdef, 0xfedcba9876543210) == 0x0121fa00ad77d742);
+static_assert(wide_low(0x0123456789abcdef, 0xfedcba9876543210) == 0x2236d88fe5618cf0);
+
+constexpr uint64_t carried(uint64_t left, uint64_t right, bool carry)
+{
+    add_carry_native(left, right, carry);
+    return carry ? 1 : 0;
+}
+
+constexpr uint64_t borrowed(uint64_t left, uint64_t right, bool borrow)
+{
+    subtract_borrow_native(left, right, borrow);
+    return borrow ? 1 : 0;
+}
+
+static_assert(carried(max_uint64, 0, false) == 0);
+static_assert(carried(max_uint64, 0, true) == 1);
+static_assert(carried(max_uint64, max_uint64, true) == 1);
+static_assert(borrowed(0, 0, false) == 0);
+static_assert(borrowed(0, 0, true) == 1);
+static_assert(borrowed(1, 1, true) == 1);
+static_assert(borrowed(2, 1, true) == 0);
+
+// construct
+static_assert(!limbs256{});
+static_assert(limbs256{ 42 } == limbs256{ limbs256::words_t{ 42, 0, 0, 0 } });
+static_assert(limbs256{ 42 }.bit_width() == 6);
+static_assert(limbs256{ limbs256::words_t{ 0, 0, 0, 1 } }.bit_width() == 193);
+static_assert(static_cast<uint64_t>(limbs256{ 42 }) == 42);
+
+// compare
+static_assert(limbs256{ 1 } < limbs256{ limbs256::words_t{ 0, 1, 0, 0 } });
+static_assert(limbs256{ limbs256::words_t{ max_uint64, 0, 0, 0 } } < limbs256{ limbs256::words_t{ 0, 0, 0, 1 } });
+static_assert(limbs256{ limbs256::words_t{ 0, 0, 0, 1 } } > limbs256{ limbs256::words_t{ max_uint64, max_uint64, max_uint64, 0 } });
+static_assert(limbs128{ 7 } != limbs128{ 8 });
+
+// arithmetic (modulo 2^Bits)
+static_assert(~limbs256{} + 1 == limbs256{});
+static_assert(limbs256{} - 1 == ~limbs256{});
+static_assert(limbs256{ max_uint64 } + 1 == limbs256{ limbs256::words_t{ 0, 1, 0, 0 } });
+static_assert(limbs256{ limbs256::words_t{ 0, 1, 0, 0 } } - 1 == limbs256{ max_uint64 });
+static_assert(limbs256{ 6 } * limbs256{ 7 } == limbs256{ 42 });
+static_assert(limbs256{ max_uint64 } * limbs256{ max_uint64 } == limbs256{ limbs256::words_t{ 1, sub1(max_uint64), 0, 0 } });
+static_assert(~limbs256{} * ~limbs256{} == limbs256{ 1 });
+static_assert(limbs256{ 42 } / limbs256{ 5 } == limbs256{ 8 });
+static_assert(limbs256{ 42 } % limbs256{ 5 } == limbs256{ 2 });
+static_assert(limbs256{ 42 } / limbs256{ 43 } == limbs256{});
+static_assert(limbs256{ 42 } / limbs256{} == limbs256{});
+static_assert(limbs256{ 42 } % limbs256{} == limbs256{});
+static_assert(~limbs256{} / ~limbs256{} == limbs256{ 1 });
+static_assert(~limbs256{} / limbs256{ 2 } == ~limbs256{} >> 1);
+
+// shift
+static_assert(limbs256{ 1 } << 255 == limbs256{ limbs256::words_t{ 0, 0, 0, power2<uint64_t>(63u) } });
+static_assert(limbs256{ 1 } << 256 == limbs256{});
+static_assert((limbs256{ 1 } << 255) >> 255 == limbs256{ 1 });
+static_assert(limbs256{ max_uint64 } << 4 == limbs256{ limbs256::words_t{ 0xfffffffffffffff0, 0x0f, 0, 0 } });
+static_assert(limbs256{ limbs256::words_t{ 0, 1, 0, 0 } } >> 1 == limbs256{ power2<uint64_t>(63u) });
+static_assert(~limbs256{} >> 256 == limbs256{});
+
+// increment/decrement
+static_assert(++limbs256{ max_uint64 } == limbs256{ limbs256::words_t{ 0, 1, 0, 0 } });
+static_assert(--limbs256{ limbs256::words_t{ 0, 1, 0, 0 } } == limbs256{ max_uint64 });
+
+// bytes
+static_assert(limbs256{ limbs256::bytes_t{ 0x01, 0x02 } } == limbs256{ 0x0201 });
+static_assert(limbs256{ 0x0201 }.to_bytes() == limbs256::bytes_t{ 0x01, 0x02 });
+
+BOOST_AUTO_TEST_CASE(limbs__hash__to_uintx__expected)
+{
+    const auto hash = base16_hash("000000000000000003ddc1e929e2944b8b0039af9aa0d826c480a83d8b39c373");
+    const limbs256 value{ hash };
+    BOOST_REQUIRE_EQUAL(value.to_bytes(), hash);
+    BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(value), to_uintx(hash));
+    BOOST_REQUIRE(limbs256{ to_uintx(hash) } == value);
+}
+
+BOOST_AUTO_TEST_CASE(limbs__operators__uint256_t__expected)
+{
+    // Deterministic pseudorandom operands of varying width.
+    uint64_t seed = 42;
+    const auto next = [&]()
+    {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        return seed;
+    };
+
+    for (size_t round = 0; round < 1000; ++round)
+    {
+        limbs256::words_t left{}, right{};
+        for (auto& word: left) word = next();
+        for (auto& word: right) word = next();
+
+        const auto x = limbs256{ left } >> (next() % 256);
+        const auto y = limbs256{ right } >> (next() % 256);
+        const auto shift = possible_narrow_cast<size_t>(next() % 256);
+        const auto big_x = static_cast<uint256_t>(x);
+        const auto big_y = static_cast<uint256_t>(y);
+
+        BOOST_REQUIRE(limbs256{ big_x } == x);
+        BOOST_REQUIRE_EQUAL(x < y, big_x < big_y);
+        BOOST_REQUIRE_EQUAL(x.bit_width(), bit_width(big_x));
+        BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x + y), uint256_t(big_x + big_y));
+        BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x - y), uint256_t(big_x - big_y));
+        BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x * y), uint256_t(big_x * big_y));
+        BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x << shift), uint256_t(big_x << shift));
+        BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x >> shift), uint256_t(big_x >> shift));
+
+        if (y)
+        {
+            BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x / y), uint256_t(big_x / big_y));
+            BOOST_REQUIRE_EQUAL(static_cast<uint256_t>(x % y), uint256_t(big_x % big_y));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
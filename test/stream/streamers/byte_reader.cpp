@@ -149,6 +149,24 @@ BOOST_AUTO_TEST_CASE(byte_reader__invalidate__not_empty__stream_invalid)
     BOOST_REQUIRE(!stream);
 }
 
+// arena
+
+BOOST_AUTO_TEST_CASE(byte_reader__get_arena__default__null)
+{
+    std::istringstream stream;
+    read::bytes::istream reader(stream);
+    BOOST_REQUIRE(is_null(reader.get_arena()));
+}
+
+BOOST_AUTO_TEST_CASE(byte_reader__set_arena__resource__expected)
+{
+    std::istringstream stream;
+    read::bytes::istream reader(stream);
+    std::pmr::monotonic_buffer_resource arena{};
+    reader.set_arena(&arena);
+    BOOST_REQUIRE(reader.get_arena() == &arena);
+}
+
 // skip
 
 BOOST_AUTO_TEST_CASE(byte_reader__skip_byte__default_empty__invalid)
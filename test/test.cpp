@@ -18,6 +18,35 @@
  */
 #include "test.hpp"
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> heap_allocations{};
+
+void* operator new(size_t size)
+{
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto pointer = std::malloc(size == 0u ? 1u : size))
+        return pointer;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 namespace std {
 
 std::ostream& operator<<(std::ostream& stream,
@@ -77,4 +106,13 @@ bool remove(const std::filesystem::path& file_path) NOEXCEPT
     BC_POP_WARNING()
 }
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+size_t allocations() NOEXCEPT
+{
+    return heap_allocations.load(std::memory_order_relaxed);
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 } // namespace test
\ No newline at end of file
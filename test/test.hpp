@@ -26,6 +26,7 @@
 #include <iostream>
 #include <vector>
 #include <filesystem>
+#include <thread>
 #include <bitcoin/system.hpp>
 
 /// Have slow test execution (scrypt is slow by design).
@@ -100,6 +101,13 @@ bool create(const std::filesystem::path& file_path) NOEXCEPT;
 bool exists(const std::filesystem::path& file_path) NOEXCEPT;
 bool remove(const std::filesystem::path& file_path) NOEXCEPT;
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Heap allocations made by the test process (replaces global new).
+size_t allocations() NOEXCEPT;
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 } // namespace test
 
 #endif
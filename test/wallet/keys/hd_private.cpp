@@ -54,6 +54,35 @@ BOOST_AUTO_TEST_CASE(hd_private__derive_private__short_seed__expected)
     BOOST_REQUIRE_EQUAL(m0h12h2x.encoded(), "xprvA41z7zogVVwxVSgdKUHDy1SKmdb533PjDz7J6N6mV6uS3ze1ai8FHa8kmHScGpWmj4WggLyQjgPie1rFSruoUihUZREPSL39UNdE3BBDu76");
 }
 
+BOOST_AUTO_TEST_CASE(hd_private__derive_private_range__across_hardened__expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const auto first = hd_first_hardened_key - 3u;
+    const auto children = m.derive_private_range(first, 6);
+    BOOST_REQUIRE_EQUAL(children.size(), 6u);
+
+    for (uint32_t child = 0; child < children.size(); ++child)
+    {
+        BOOST_REQUIRE(children[child] == m.derive_private(first + child));
+    }
+
+    BOOST_REQUIRE_EQUAL(children[3].encoded(), "xprv9uHRZZhk6KAJC1avXpDAp4MDc3sQKNxDiPvvkX8Br5ngLNv1TxvUxt4cV1rGL5hj6KCesnDYUhd7oWgT11eZG7XnxHrnYeSvkzY7d2bhkJ7");
+}
+
+BOOST_AUTO_TEST_CASE(hd_private__derive_private_range__overflow__empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    BOOST_REQUIRE(m.derive_private_range(max_uint32, 2).empty());
+    BOOST_REQUIRE(m.derive_private_range(0, 0).empty());
+    BOOST_REQUIRE_EQUAL(m.derive_private_range(max_uint32, 1).size(), 1u);
+}
+
 BOOST_AUTO_TEST_CASE(hd_private__derive_public__short_seed__expected)
 {
     data_chunk seed;
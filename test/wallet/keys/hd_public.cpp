@@ -37,6 +37,37 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__invalid__false)
     BOOST_REQUIRE(!m_pub.derive_public(hd_first_hardened_key));
 }
 
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__hardened__empty)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const hd_public m_pub = m;
+    BOOST_REQUIRE(m_pub.derive_public_range(hd_first_hardened_key, 1).empty());
+    BOOST_REQUIRE(m_pub.derive_public_range(sub1(hd_first_hardened_key), 2).empty());
+    BOOST_REQUIRE(m_pub.derive_public_range(0, 0).empty());
+    BOOST_REQUIRE_EQUAL(m_pub.derive_public_range(sub1(hd_first_hardened_key), 1).size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__short_seed__expected)
+{
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, SHORT_SEED));
+
+    const hd_private m(seed, hd_private::mainnet);
+    const auto m0h_pub = m.derive_public(hd_first_hardened_key);
+    const auto children = m0h_pub.derive_public_range(0, 20);
+    BOOST_REQUIRE_EQUAL(children.size(), 20u);
+
+    for (uint32_t index = 0; index < children.size(); ++index)
+    {
+        BOOST_REQUIRE(children[index] == m0h_pub.derive_public(index));
+    }
+
+    BOOST_REQUIRE_EQUAL(children[1].encoded(), "xpub6ASuArnXKPbfEwhqN6e3mwBcDTgzisQN1wXN9BJcM47sSikHjJf3UFHKkNAWbWMiGj7Wf5uMash7SyYq527Hqck2AxYysAA7xmALppuCkwQ");
+}
+
 BOOST_AUTO_TEST_CASE(hd_public__encoded__round_trip__expected)
 {
     static const auto encoded = "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8";
@@ -93,4 +124,40 @@ BOOST_AUTO_TEST_CASE(hd_public__derive_public__long_seed__expected)
     BOOST_REQUIRE_EQUAL(m0xH1yH2_pub.encoded(), "xpub6FnCn6nSzZAw5Tw7cgR9bi15UV96gLZhjDstkXXxvCLsUXBGXPdSnLFbdpq8p9HmGsApME5hQTZ3emM2rnY5agb9rXpVGyy3bdW6EEgAtqt");
 }
 
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Approximates gap limit scanning of an account (100k receive addresses).
+BOOST_AUTO_TEST_CASE(hd_public__derive_public_range__100k__individual_versus_range)
+{
+    using namespace std::chrono;
+    constexpr uint32_t count = 100'000;
+
+    data_chunk seed;
+    BOOST_REQUIRE(decode_base16(seed, LONG_SEED));
+    const hd_public account = hd_private(seed, hd_private::mainnet)
+        .derive_public(0);
+
+    std::vector<hd_public> individual{};
+    individual.reserve(count);
+
+    auto start = steady_clock::now();
+    for (uint32_t index = 0; index < count; ++index)
+        individual.push_back(account.derive_public(index));
+
+    const auto individual_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto range = account.derive_public_range(0, count);
+    const auto range_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_REQUIRE(individual == range);
+    std::cout << "children   : " << count << std::endl
+        << "individual : " << individual_time << "us" << std::endl
+        << "range      : " << range_time << "us" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()
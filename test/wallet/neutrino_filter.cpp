@@ -82,6 +82,70 @@ bool add_metadata(const prevout_data::list& metadata, const chain::block& block)
     return result;
 }
 
+// Block of count transactions, each with a p2pkh prevout and two outputs.
+// Every tenth output script repeats, so that the filter set is deduplicated.
+chain::block get_block(size_t count)
+{
+    const auto p2pkh = [](size_t index)
+    {
+        return chain::script{ chain::script::to_pay_key_hash_pattern(
+            bitcoin_short_hash(to_little_endian(index))) };
+    };
+
+    const auto p2wpkh = [](size_t index)
+    {
+        return chain::script{ chain::script::to_pay_witness_key_hash_pattern(
+            bitcoin_short_hash(to_big_endian(index))) };
+    };
+
+    chain::transactions txs{};
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto repeat = is_zero(index % 10) ? zero : index;
+        txs.emplace_back(1u,
+            chain::inputs
+            {
+                { { sha256_hash(to_little_endian(index)), 0 }, {}, 0 }
+            },
+            chain::outputs
+            {
+                { 1u, p2pkh(add1(index) * count) },
+                { 2u, p2wpkh(repeat) }
+            }, 0u);
+
+        txs.back().inputs_ptr()->front()->prevout =
+            to_shared<chain::output>(3u, p2pkh(index));
+    }
+
+    return { chain::header{ 1, {}, {}, 0, 0, 0 }, std::move(txs) };
+}
+
+// The filter of scripts serialized, ordered and deduplicated as chunks.
+data_chunk get_filter(const chain::block& block)
+{
+    data_stack scripts{};
+    for (const auto& tx: *block.transactions_ptr())
+    {
+        for (const auto& input: *tx->inputs_ptr())
+            scripts.push_back(input->prevout->script().to_data(false));
+
+        for (const auto& output: *tx->outputs_ptr())
+            scripts.push_back(output->script().to_data(false));
+    }
+
+    distinct(scripts);
+    const auto hash = block.hash();
+    const auto key = to_siphash_key(slice<zero, to_half(hash_size)>(hash));
+
+    data_chunk filter{};
+    stream::out::data stream(filter);
+    write::bytes::ostream writer(stream);
+    writer.write_variable(scripts.size());
+    golomb::construct(stream, scripts, 19, key, 784931);
+    stream.flush();
+    return filter;
+}
+
 BOOST_AUTO_TEST_CASE(compute__first_11_blocks__success)
 {
 
@@ -108,6 +172,13 @@ BOOST_AUTO_TEST_CASE(compute__first_11_blocks__success)
         data_chunk filter;
         BOOST_REQUIRE(neutrino::compute_filter(block, filter));
         const auto header = neutrino::compute_filter_header(previous_filter_header, filter);
+
+        data_chunk view_filter;
+        hash_digest view_header;
+        const chain::block_view view(data);
+        BOOST_REQUIRE(neutrino::compute_filter(view, {}, previous_filter_header, view_filter, view_header));
+        BOOST_REQUIRE_EQUAL(view_filter, filter);
+        BOOST_REQUIRE_EQUAL(view_header, header);
         ////std::cout << "header: " << encode_base16(header) << std::endl;
         ////std::cout << "filter: " << encode_base16(filter) << std::endl;
         previous_filter_header = header;
@@ -3150,6 +3221,20 @@ BOOST_AUTO_TEST_CASE(neutrino__compute_filter__block_49291__success)
     data_chunk result;
     BOOST_REQUIRE(neutrino::compute_filter(validated_block, result));
     BOOST_REQUIRE_EQUAL(result, expected_filter);
+
+    // Zero copy form, prevout scripts in (arbitrary) metadata order.
+    std_vector<data_slice> prevouts{};
+    for (const auto& meta: metadata)
+        prevouts.emplace_back(meta.script);
+
+    data_chunk view_result;
+    const chain::block_view view(raw_block);
+    BOOST_REQUIRE(neutrino::compute_filter(view, prevouts, view_result));
+    BOOST_REQUIRE_EQUAL(view_result, expected_filter);
+
+    // All prevouts are required.
+    prevouts.pop_back();
+    BOOST_REQUIRE(!neutrino::compute_filter(view, prevouts, view_result));
 }
 
 BOOST_AUTO_TEST_CASE(neutrino__compute_filter__block_180480__success)
@@ -3594,4 +3679,231 @@ BOOST_AUTO_TEST_CASE(neutrino__match_filter_2__unrelated_address__false)
     BOOST_REQUIRE(!neutrino::match_filter(filter, addresses));
 }
 
+BOOST_AUTO_TEST_CASE(neutrino__compute_filter__duplicate_scripts__expected)
+{
+    const auto block = get_block(100);
+    const auto expected = get_filter(block);
+
+    data_chunk filter;
+    BOOST_REQUIRE(neutrino::compute_filter(block, filter));
+    BOOST_REQUIRE_EQUAL(filter, expected);
+
+    data_stack scripts{};
+    for (const auto& tx: *block.transactions_ptr())
+        scripts.push_back(tx->inputs_ptr()->front()->prevout->script()
+            .to_data(false));
+
+    const std_vector<data_slice> prevouts(scripts.begin(), scripts.end());
+    const auto data = block.to_data(true);
+    const chain::block_view view(data);
+
+    data_chunk view_filter;
+    hash_digest header;
+    BOOST_REQUIRE(neutrino::compute_filter(view, prevouts, null_hash,
+        view_filter, header));
+    BOOST_REQUIRE_EQUAL(view_filter, expected);
+    BOOST_REQUIRE_EQUAL(header, neutrino::compute_filter_header(null_hash,
+        expected));
+}
+
+BOOST_AUTO_TEST_CASE(neutrino__golomb_matches__members_and_truncation__expected)
+{
+    constexpr uint8_t bits = 19;
+    constexpr uint64_t rate = 784931;
+    const siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+    data_stack items{};
+    for (size_t index = 0; index < 100; ++index)
+        items.push_back(sha256_chunk(to_little_endian(index)));
+
+    const auto filter = golomb::construct(items, bits, key, rate);
+    const data_stack targets
+    {
+        items[42],
+        base16_chunk("deadbeef"),
+        items[0],
+        items[99]
+    };
+
+    const auto found = golomb::matches(targets, filter, items.size(), key,
+        bits, rate);
+    BOOST_REQUIRE_EQUAL(found.size(), targets.size());
+    BOOST_REQUIRE(found[0]);
+    BOOST_REQUIRE(!found[1]);
+    BOOST_REQUIRE(found[2]);
+    BOOST_REQUIRE(found[3]);
+    BOOST_REQUIRE(golomb::match(targets, filter, items.size(), key, bits,
+        rate));
+    BOOST_REQUIRE(!golomb::match(targets[1], filter, items.size(), key,
+        bits, rate));
+
+    // A truncated set matches no member beyond its end.
+    const data_slice truncated{ filter.begin(), std::next(filter.begin()) };
+    const auto none = golomb::matches(targets, truncated, items.size(), key,
+        bits, rate);
+    BOOST_REQUIRE(std::none_of(none.begin(), none.end(), [](bool found)
+    {
+        return found;
+    }));
+}
+
+#if defined(HAVE_PERFORMANCE_TESTS)
+
+// Approximates bip158 filter construction for a block of 5k outputs.
+BOOST_AUTO_TEST_CASE(neutrino__golomb_construct__5k_scripts__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 5'000;
+    constexpr uint8_t bits = 19;
+    constexpr uint64_t rate = 784931;
+
+    // P2WPKH, P2PKH, P2SH and P2WSH script sizes.
+    constexpr std_array<size_t, 4> sizes{ 22, 25, 23, 34 };
+    data_stack scripts{};
+    for (size_t index = 0; index < count; ++index)
+        scripts.push_back(sha256_chunk(to_little_endian(index)));
+
+    for (size_t index = 0; index < count; ++index)
+        scripts[index].resize(sizes[index % sizes.size()], 0x42);
+
+    const siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+    const std_vector<data_slice> set(scripts.begin(), scripts.end());
+
+    // Prior form, scalar siphash and comparison sort of the set.
+    auto start = steady_clock::now();
+    std::vector<uint64_t> hashes(count);
+    std::transform(set.begin(), set.end(), hashes.begin(),
+        [&](const data_slice& script) NOEXCEPT
+        {
+            return siphash(key, script);
+        });
+    std::sort(hashes.begin(), hashes.end());
+    const auto scalar_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto batched = siphashes(key, set);
+    const auto batched_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    start = steady_clock::now();
+    const auto filter = golomb::construct(scripts, bits, key, rate);
+    const auto construct_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_REQUIRE(golomb::match(scripts.front(), filter, count, key, bits,
+        rate));
+    std::cout << "scripts        : " << count << std::endl
+        << "scalar + sort  : " << scalar_time << "us" << std::endl
+        << "siphashes      : " << batched_time << "us" << std::endl
+        << "construct      : " << construct_time << "us" << std::endl;
+}
+
+// Approximates a light client scan of 5k output filters for ten scripts.
+BOOST_AUTO_TEST_CASE(neutrino__golomb_match__5k_filters__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t count = 5'000;
+    constexpr size_t filters = 100;
+    constexpr uint8_t bits = 19;
+    constexpr uint64_t rate = 784931;
+    const siphash_key key{ 0x0706050403020100, 0x0f0e0d0c0b0a0908 };
+
+    data_stack items{};
+    for (size_t index = 0; index < count; ++index)
+        items.push_back(sha256_chunk(to_little_endian(index)));
+
+    data_stack targets{};
+    for (size_t index = 0; index < 10; ++index)
+        targets.push_back(sha256_chunk(to_big_endian(index)));
+
+    const auto filter = golomb::construct(items, bits, key, rate);
+
+    // Prior form, bit reader over an input stream.
+    size_t streamed{};
+    auto start = steady_clock::now();
+    for (size_t scan = 0; scan < filters; ++scan)
+    {
+        stream::in::copy stream(filter);
+        streamed += to_int<size_t>(golomb::match(targets, stream, count, key, bits,
+            rate));
+    }
+
+    const auto stream_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    size_t sliced{};
+    start = steady_clock::now();
+    for (size_t scan = 0; scan < filters; ++scan)
+        sliced += to_int<size_t>(golomb::match(targets, filter, count, key, bits,
+            rate));
+
+    const auto slice_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_REQUIRE_EQUAL(streamed, sliced);
+    std::cout << "filters        : " << filters << std::endl
+        << "stream match   : " << stream_time << "us" << std::endl
+        << "slice match    : " << slice_time << "us" << std::endl
+        << "filters/second : " << (filters * 1'000'000u) /
+            std::max<uint64_t>(one, slice_time) << std::endl;
+}
+
+// Approximates bip158 filter construction for a block of 2k transactions.
+BOOST_AUTO_TEST_CASE(neutrino__compute_filter__2k_transactions__timed)
+{
+    using namespace std::chrono;
+    constexpr size_t rounds = 10;
+    const auto block = get_block(2'000);
+
+    data_stack scripts{};
+    for (const auto& tx: *block.transactions_ptr())
+        scripts.push_back(tx->inputs_ptr()->front()->prevout->script()
+            .to_data(false));
+
+    const std_vector<data_slice> prevouts(scripts.begin(), scripts.end());
+    const auto data = block.to_data(true);
+    const chain::block_view view(data);
+
+    // Prior form, scripts copied to chunks and deduplicated as chunks.
+    data_chunk expected{};
+    auto start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        expected = get_filter(block);
+
+    const auto chunk_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    data_chunk filter{};
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        filter.clear();
+        BOOST_REQUIRE(neutrino::compute_filter(block, filter));
+    }
+
+    const auto block_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    data_chunk view_filter{};
+    start = steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        view_filter.clear();
+        BOOST_REQUIRE(neutrino::compute_filter(view, prevouts, view_filter));
+    }
+
+    const auto view_time = duration_cast<microseconds>(
+        steady_clock::now() - start).count();
+
+    BOOST_REQUIRE_EQUAL(filter, expected);
+    BOOST_REQUIRE_EQUAL(view_filter, expected);
+    std::cout << "blocks         : " << rounds << std::endl
+        << "chunk filters  : " << chunk_time << "us" << std::endl
+        << "block filters  : " << block_time << "us" << std::endl
+        << "view filters   : " << view_time << "us" << std::endl;
+}
+
+#endif // HAVE_PERFORMANCE_TESTS
+
 BOOST_AUTO_TEST_SUITE_END()